@@ -1,7 +1,7 @@
 /*
  *
  * Author: Jeffrey Leung
- * Last edited: 2016-01-01
+ * Last edited: 2026-10-14
  *
  * This C++ header file contains the implementation of a Coordinate struct
  * used by the Labyrinth and LabyrinthMap classes.
@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include <cstddef>
+
 struct Coordinate
 {
   size_t x;
@@ -30,6 +32,13 @@ struct Coordinate
     y = y_coordinate;
   }
 
+  // Copy constructor
+  Coordinate( const Coordinate& c )
+  {
+    x = c.x;
+    y = c.y;
+  }
+
   // Operator overload for ==
   bool operator==( const Coordinate& c ) const
   {
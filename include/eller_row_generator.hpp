@@ -0,0 +1,65 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ header file contains the EllerRowGenerator class, which generates
+ * a perfect maze one row at a time with Eller's algorithm.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// Each row is returned as one byte per Room, giving the Walls which are
+// removed in the layout of Room::kWallMask (bit 0 north, 1 east, 2 south,
+// 3 west).
+//
+// Only the current and next rows are kept, so memory use is proportional to
+// the x size no matter how many rows are generated.
+class EllerRowGenerator
+{
+  public:
+
+    // This method starts a new maze of the given size.
+    // An exception is thrown if:
+    //   A size of 0 is given (domain_error)
+    void Reset( const size_t x_size, const size_t y_size );
+
+    // This method returns true if every row has been generated.
+    bool Done() const;
+
+    // This method returns the y-coordinate of the next row to be generated.
+    size_t NextY() const;
+
+    // This method generates the next row and returns its removed Walls.
+    // The returned array holds x_size bytes and is valid until the next call.
+    // An exception is thrown if:
+    //   Every row has already been generated (logic_error)
+    const std::uint8_t* NextRow( std::mt19937_64& rng );
+
+    // This method returns the number of bytes of scratch space in use.
+    size_t ScratchBytes() const;
+
+  private:
+
+    size_t x_size_ = 0;
+    size_t y_size_ = 0;
+    size_t y_ = 0;
+
+    // Rooms of the current row which are already connected (through earlier
+    // rows) share a set, tracked by a union-find over the columns of the row.
+    std::vector<size_t> parent_;
+    std::vector<size_t> root_;   // Root of each column
+    std::vector<size_t> first_;  // Last column of each set, then the first
+                                 // column of each set in the next row
+    std::vector<std::uint8_t> current_;
+    std::vector<std::uint8_t> next_;
+
+    // This private method returns the union-find root of column x, halving
+    // paths along the way.
+    size_t FindRoot( size_t x );
+};
@@ -0,0 +1,203 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ header file contains the FixedLabyrinth class template, a
+ * Labyrinth whose size is fixed at compile time and whose Rooms are stored
+ * inside the object.
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "room_properties.hpp"
+#include "room.hpp"
+#include "coordinate.hpp"
+#include "labyrinth.hpp"
+
+// This class holds the Rooms of a FixedLabyrinth. It is a base class so
+// that the Rooms are constructed before the Labyrinth which uses them.
+template <size_t X, size_t Y>
+class FixedLabyrinthRooms
+{
+  protected:
+
+    std::array<Room, X * Y> fixed_rooms_;
+};
+
+// A LabyrinthMode::kSmall Labyrinth of X x Y Rooms, e.g.
+// FixedLabyrinth<16, 16>. Constructing one allocates nothing: the Rooms are
+// a member, rather than a separate allocation reached through a pointer.
+//
+// It is a Labyrinth, so it has the whole Labyrinth API and can be given to
+// anything which takes a Labyrinth (e.g. LabyrinthGenerator::Generate(), a
+// LabyrinthMap, LabyrinthFile::Save() or a TurnEngine). Its size and FAST
+// PATH methods hide those of Labyrinth: they are defined here, use the
+// sizes as constants and index the Rooms directly, so the bounds checks fold
+// into comparisons with constants and no storage mode is chosen at run
+// time. Through a Labyrinth& the Labyrinth methods give the same results.
+//
+// A FixedLabyrinth cannot be copied or moved, since its Rooms would move
+// with it; keep boards in place, e.g. in a std::deque. Moving it into a
+// Labyrinth copies the Rooms into a Labyrinth of its own, and Clone()
+// returns an ordinary Labyrinth.
+template <size_t X, size_t Y>
+class FixedLabyrinth : private FixedLabyrinthRooms<X, Y>, public Labyrinth
+{
+  static_assert( X > 0 && Y > 0, "A FixedLabyrinth must have Rooms." );
+  static_assert( X <= 20 && Y <= 20,
+                 "A FixedLabyrinth is at most 20 x 20 Rooms, the maximum of "
+                 "LabyrinthMode::kSmall." );
+
+  public:
+
+    // Sizes of the Labyrinth
+    static constexpr size_t kXSize = X;
+    static constexpr size_t kYSize = Y;
+
+    // Default constructor
+    // Every Room is walled and empty.
+    FixedLabyrinth();
+
+    FixedLabyrinth( const FixedLabyrinth& ) = delete;
+    FixedLabyrinth& operator=( const FixedLabyrinth& ) = delete;
+
+    // These methods return the number of Rooms along each axis.
+    static constexpr size_t XSize();
+    static constexpr size_t YSize();
+
+    // This method returns true if the Room is within the bounds of the
+    // Labyrinth, and false otherwise.
+    static bool WithinBounds( const Coordinate rm ) noexcept;
+
+    // These methods are the same as the FAST PATH methods of Labyrinth.
+    LabyrinthStatus TryGetInhabitant( const Coordinate rm,
+                                      Inhabitant& inh ) const noexcept;
+    LabyrinthStatus TryItemAt( const Coordinate rm,
+                               Item& itm ) const noexcept;
+    LabyrinthStatus TryDirectionCheck( const Coordinate rm,
+                                       const Direction d,
+                                       RoomBorder& rb ) const noexcept;
+    Inhabitant GetInhabitantUnchecked( const Coordinate rm ) const noexcept;
+    Item ItemAtUnchecked( const Coordinate rm ) const noexcept;
+    RoomBorder DirectionCheckUnchecked( const Coordinate rm,
+                                        const Direction d ) const noexcept;
+
+    // This method returns the Room at the given Coordinate without
+    // checking it. The Coordinate must be within the Labyrinth.
+    const Room& RoomAtUnchecked( const Coordinate rm ) const noexcept;
+};
+
+template <size_t X, size_t Y>
+constexpr size_t FixedLabyrinth<X, Y>::kXSize;
+
+template <size_t X, size_t Y>
+constexpr size_t FixedLabyrinth<X, Y>::kYSize;
+
+// Default constructor
+template <size_t X, size_t Y>
+FixedLabyrinth<X, Y>::FixedLabyrinth() :
+  FixedLabyrinthRooms<X, Y>(),
+  Labyrinth( X, Y, this->fixed_rooms_.data() )
+{
+}
+
+// These methods return the number of Rooms along each axis.
+template <size_t X, size_t Y>
+constexpr size_t FixedLabyrinth<X, Y>::XSize()
+{
+  return X;
+}
+
+template <size_t X, size_t Y>
+constexpr size_t FixedLabyrinth<X, Y>::YSize()
+{
+  return Y;
+}
+
+// This method returns true if the Room is within the bounds of the
+// Labyrinth, and false otherwise.
+template <size_t X, size_t Y>
+bool FixedLabyrinth<X, Y>::WithinBounds( const Coordinate rm ) noexcept
+{
+  return rm.x < X && rm.y < Y;
+}
+
+// These methods are the same as the FAST PATH methods of Labyrinth.
+template <size_t X, size_t Y>
+LabyrinthStatus FixedLabyrinth<X, Y>::TryGetInhabitant(
+  const Coordinate rm,
+  Inhabitant& inh ) const noexcept
+{
+  if( !WithinBounds(rm) )
+  {
+    return LabyrinthStatus::kOutOfBounds;
+  }
+  inh = RoomAtUnchecked(rm).GetInhabitant();
+  return LabyrinthStatus::kOk;
+}
+
+template <size_t X, size_t Y>
+LabyrinthStatus FixedLabyrinth<X, Y>::TryItemAt( const Coordinate rm,
+                                                 Item& itm ) const noexcept
+{
+  if( !WithinBounds(rm) )
+  {
+    return LabyrinthStatus::kOutOfBounds;
+  }
+  itm = RoomAtUnchecked(rm).GetItem();
+  return LabyrinthStatus::kOk;
+}
+
+template <size_t X, size_t Y>
+LabyrinthStatus FixedLabyrinth<X, Y>::TryDirectionCheck(
+  const Coordinate rm,
+  const Direction d,
+  RoomBorder& rb ) const noexcept
+{
+  if( !WithinBounds(rm) )
+  {
+    return LabyrinthStatus::kOutOfBounds;
+  }
+  else if( d == Direction::kNone )
+  {
+    return LabyrinthStatus::kInvalidArgument;
+  }
+  rb = RoomAtUnchecked(rm).DirectionCheckUnchecked(d);
+  return LabyrinthStatus::kOk;
+}
+
+template <size_t X, size_t Y>
+Inhabitant FixedLabyrinth<X, Y>::GetInhabitantUnchecked(
+  const Coordinate rm ) const noexcept
+{
+  return RoomAtUnchecked(rm).GetInhabitant();
+}
+
+template <size_t X, size_t Y>
+Item FixedLabyrinth<X, Y>::ItemAtUnchecked( const Coordinate rm ) const
+  noexcept
+{
+  return RoomAtUnchecked(rm).GetItem();
+}
+
+template <size_t X, size_t Y>
+RoomBorder FixedLabyrinth<X, Y>::DirectionCheckUnchecked(
+  const Coordinate rm,
+  const Direction d ) const noexcept
+{
+  return RoomAtUnchecked(rm).DirectionCheckUnchecked(d);
+}
+
+// This method returns the Room at the given Coordinate without
+// checking it.
+template <size_t X, size_t Y>
+const Room& FixedLabyrinth<X, Y>::RoomAtUnchecked( const Coordinate rm ) const
+  noexcept
+{
+  return this->fixed_rooms_[rm.y * X + rm.x];
+}
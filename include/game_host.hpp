@@ -0,0 +1,184 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ header file contains the GameHost class, which owns many game
+ * sessions, each with its own Labyrinth, and plays their turns on a
+ * WorkStealingPool.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "room_properties.hpp"
+#include "labyrinth.hpp"
+#include "work_stealing_pool.hpp"
+
+// A move by one player of a session.
+struct GameMove
+{
+  std::uint32_t player = 0;
+  Direction direction = Direction::kNone;  // kNone stays in the same Room
+  bool shoot = false;  // Shoot, rather than hold fire, at eyes in the
+                       // darkness in the Room which is entered
+};
+
+// This class is a template for the rules which a session plays its moves
+// with (e.g. the players of the session and their inventories).
+class GameSessionHandler
+{
+  public:
+
+    // Destructor
+    // Prevents error messages about non-virtual destructors
+    virtual ~GameSessionHandler()
+    {
+    }
+
+    // This method is called once per tick with every move queued for the
+    // session since its last turn, in the order in which they were
+    // submitted. Only one worker plays a session at a time, so neither the
+    // handler nor the Labyrinth needs to be locked.
+    virtual void Turn( Labyrinth& l, const std::vector<GameMove>& moves ) = 0;
+};
+
+// Counters of a GameHost since it was created. Times are in nanoseconds.
+struct GameHostStats
+{
+  size_t sessions = 0;
+  std::uint64_t ticks = 0;
+  std::uint64_t turns = 0;
+  std::uint64_t moves = 0;
+  std::uint64_t steals = 0;       // Turns played away from their worker
+  std::uint64_t turn_time = 0;    // Total time of every turn
+  std::uint64_t max_turn_time = 0;
+  std::uint64_t last_tick_time = 0;
+};
+
+// Each session is played by the same worker every tick (its affinity),
+// unless that worker is busy and another steals the turn. Moves are taken
+// from any thread without a lock shared between sessions.
+//
+// CreateSession(), CloseSession(), Tick(), Session() and Stats() must be
+// called from one thread at a time; SubmitMove() may be called from any
+// thread at any time, including during those. Tick() takes the queue of
+// every session before it plays any turn, so moves submitted during a tick
+// are played in the next one (a move submitted as the tick begins may be
+// played in either).
+//
+// Sessions are stored in blocks of kBlockSessions which are never moved or
+// freed while the host exists, so that SubmitMove() can find a session
+// while others are created or closed. A closed session keeps its place to
+// be reused; only its Labyrinth and handler are destroyed.
+class GameHost
+{
+  public:
+
+    // Parameterized constructor
+    // 0 workers uses one worker per hardware thread.
+    explicit GameHost( const size_t workers = 0 );
+
+    // This method adds a session which plays the given Labyrinth with the
+    // given handler, and returns its identifier. Identifiers of closed
+    // sessions are reused.
+    // An exception is thrown if:
+    //   handler is null (invalid_argument)
+    //   kMaxSessions sessions are open (length_error)
+    size_t CreateSession( Labyrinth&& l,
+                          std::unique_ptr<GameSessionHandler> handler );
+
+    // This method removes a session, discarding its queued moves. Moves
+    // submitted to it from then on throw an exception.
+    // An exception is thrown if:
+    //   The session does not exist (invalid_argument)
+    void CloseSession( const size_t session );
+
+    // This method queues a move for the next turn of the session.
+    // An exception is thrown if:
+    //   The session does not exist (invalid_argument)
+    void SubmitMove( const size_t session, const GameMove& move );
+
+    // This method plays one turn of every session with queued moves, in
+    // parallel, and returns the number of turns played.
+    // An exception is thrown if:
+    //   A handler threw an exception; the first one is thrown again, after
+    //     every turn of the tick has finished
+    size_t Tick();
+
+    // This method returns the Labyrinth of a session.
+    // An exception is thrown if:
+    //   The session does not exist (invalid_argument)
+    const Labyrinth& Session( const size_t session ) const;
+
+    // This method returns the counters of the host.
+    GameHostStats Stats() const;
+
+    // Number of sessions in each block of storage.
+    static constexpr size_t kBlockSessions = 256;
+
+    // Largest number of sessions which may be open at once.
+    static constexpr size_t kMaxSessions = 1 << 20;
+
+  private:
+
+    // The Labyrinth, handler and worker are only used by the host thread
+    // and the worker playing the turn; everything else may be used by any
+    // thread which submits a move.
+    struct GameSession
+    {
+      std::unique_ptr<Labyrinth> labyrinth;  // Null while closed
+      std::unique_ptr<GameSessionHandler> handler;
+      size_t worker = 0;                     // Affinity
+
+      std::mutex mutex;                      // Guards open and incoming
+      bool open = false;
+      std::vector<GameMove> incoming;
+      std::atomic<bool> pending{ false };    // Moves are in incoming
+      std::vector<GameMove> turn;  // Taken from incoming by Tick()
+    };
+
+    // Counters written by a single worker, padded to their own cache line.
+    struct WorkerStats
+    {
+      std::uint64_t turns = 0;
+      std::uint64_t moves = 0;
+      std::uint64_t turn_time = 0;
+      std::uint64_t max_turn_time = 0;
+      std::uint64_t steals = 0;
+      char padding[24];
+    };
+
+    WorkStealingPool pool_;
+
+    // kMaxSessions / kBlockSessions blocks, allocated as they are needed,
+    // and the number of identifiers given out: a block is allocated before
+    // sessions_ is increased past its first identifier.
+    std::unique_ptr< std::unique_ptr<GameSession[]>[] > blocks_;
+    std::atomic<size_t> sessions_{ 0 };
+    std::vector<size_t> closed_;
+    std::vector<WorkerStats> worker_stats_;
+    std::uint64_t ticks_ = 0;
+    std::uint64_t last_tick_time_ = 0;
+
+    // This private method returns the storage of the session with the
+    // given identifier, which may be closed, or null if it has never been
+    // given out.
+    GameSession* SlotAt( const size_t session ) const;
+
+    // This private method returns the open session with the given
+    // identifier. Only used by the host thread.
+    // An exception is thrown if:
+    //   The session does not exist (invalid_argument)
+    GameSession& SessionAt( const size_t session,
+                            const char* const caller ) const;
+
+    // This private method plays one turn of the session on the worker.
+    void PlayTurn( GameSession& s, const size_t worker );
+};
@@ -1,7 +1,7 @@
 /*
  *
  * Author: Jeffrey Leung
- * Last edited: 2016-02-01
+ * Last edited: 2026-10-14
  *
  * This C++ header file contains the implementation of the Labyrinth class,
  * which uses the Room class to create a 2-d mapping for a game.
@@ -10,13 +10,38 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "room_properties.hpp"
 #include "room.hpp"
 #include "coordinate.hpp"
+#include "room_row.hpp"
+#include "labyrinth_observer.hpp"
+#include "labyrinth_arena.hpp"
 
-// Rooms are indexed first with the y-coordinate, then with the x-coordinate.
+// Storage modes for the Rooms of a Labyrinth.
+enum class LabyrinthMode
+{
+  kSmall,  // Up to 20 x 20 Rooms in a single allocation
+  kLarge,  // Up to 65536 x 65536 Rooms in bands of rows, which are only
+           // allocated once a Room in the band is modified
+};
+
+// Results of the exception-free (Try*) methods of a Labyrinth. Each Try*
+// method returns the status for which its checked version would throw.
+enum class LabyrinthStatus
+{
+  kOk,
+  kOutOfBounds,      // A Room is outside the Labyrinth (domain_error)
+  kInvalidArgument,  // e.g. Direction::kNone (invalid_argument)
+  kInvalidState,     // e.g. an exit which is already set (logic_error)
+};
+
+// Rooms are stored contiguously in row-major order, i.e. indexed first with
+// the y-coordinate, then with the x-coordinate.
+// In LabyrinthMode::kLarge, each band of kBandRows rows is contiguous.
 class Labyrinth
 {
   public:
@@ -29,8 +54,30 @@ class Labyrinth
       // Parameterized constructor
       // An exception is thrown if:
       //   A size of 0 is given (domain_error)
-      //   An x or y size greater than the maximum is given (domain_error)
-      Labyrinth( const size_t x_size, const size_t y_size );
+      //   An x or y size greater than the maximum of the mode is given
+      //     (domain_error)
+      Labyrinth( const size_t x_size,
+                 const size_t y_size,
+                 const LabyrinthMode mode = LabyrinthMode::kSmall );
+
+      // Parameterized constructor
+      // A LabyrinthMode::kSmall Labyrinth whose Rooms are allocated from
+      // the arena, which must outlive it (and its moves, but not its
+      // Clone()s).
+      // An exception is thrown if:
+      //   A size of 0 is given (domain_error)
+      //   An x or y size greater than the maximum of LabyrinthMode::kSmall
+      //     is given (domain_error)
+      Labyrinth( const size_t x_size,
+                 const size_t y_size,
+                 LabyrinthArena& arena );
+
+      // Move constructor
+      // Observers and checkpoints are moved with the Labyrinth, so it
+      // should not be moved while it is observed. The Rooms of a
+      // FixedLabyrinth stay with it, so they are copied instead.
+      // Use Clone() to copy a Labyrinth.
+      Labyrinth( Labyrinth&& l );
 
     // SETUP:
 
@@ -54,6 +101,20 @@ class Labyrinth
       //   The Room is outside the Labyrinth (domain_error)
       void SetSpawn2( const Coordinate rm );
 
+      // These methods return the primary and secondary spawn Rooms.
+      Coordinate GetSpawn1() const;
+      Coordinate GetSpawn2() const;
+
+      // This method returns true if the exit has been set.
+      bool ExitSet() const;
+
+      // These methods return the Room with the exit and the Direction of
+      // the exit from that Room.
+      // An exception is thrown if:
+      //   The exit has not been set (logic_error)
+      Coordinate GetExit() const;
+      Direction GetExitDirection() const;
+
       // This method sets the exit of the Labyrinth on a Wall.
       // An exception is thrown if:
       //   The Room is outside the Labyrinth (domain_error)
@@ -82,6 +143,49 @@ class Labyrinth
       //     in another room (logic_error)
       void SetItem( Coordinate rm, Item itm );
 
+    // OBSERVERS:
+
+      // This method registers an observer to be notified of every change
+      // to the Rooms. Observers are not owned, and must be removed before
+      // they are destroyed.
+      // Observing does not change the Labyrinth, so it is allowed through
+      // a const Labyrinth.
+      // An exception is thrown if:
+      //   o is null (invalid_argument)
+      void AddObserver( LabyrinthObserver* const o ) const;
+
+      // This method unregisters an observer. Nothing is done if it is not
+      // registered.
+      void RemoveObserver( LabyrinthObserver* const o ) const;
+
+    // SNAPSHOTS:
+
+      // This method returns a copy of the Labyrinth, without its observers
+      // or checkpoints.
+      // In LabyrinthMode::kLarge, the copies share each band of Rooms until
+      // either one modifies it, so a clone costs O(bands) rather than
+      // O(Rooms); a LabyrinthMode::kSmall Labyrinth is copied (at most 800
+      // bytes). A mapped file is shared.
+      Labyrinth Clone() const;
+
+      // This method begins recording changes to the Rooms, exit and
+      // Treasure if they are not already recorded, and returns a checkpoint
+      // which Rollback() can return to. Spawns are not recorded.
+      // LabyrinthGenerator::Generate() discards every checkpoint.
+      size_t Checkpoint();
+
+      // This method undoes every change made since the given checkpoint,
+      // in time proportional to the number of changes, and notifies the
+      // observers of each Room restored. Checkpoints taken after it are
+      // discarded; it and earlier checkpoints remain valid.
+      // An exception is thrown if:
+      //   The checkpoint was not returned by Checkpoint(), or has been
+      //     discarded (invalid_argument)
+      void Rollback( const size_t checkpoint );
+
+      // This method stops recording changes and discards every checkpoint.
+      void ReleaseCheckpoints();
+
     // PLAY:
 
       // This method returns the current Inhabitant of the Room.
@@ -124,13 +228,129 @@ class Labyrinth
       RoomBorder DirectionCheck( const Coordinate rm,
                                  const Direction d ) const;
 
+      // This method returns true if the Treasure is in a Room, and false if
+      // it has not been placed or is held by a Player.
+      bool TreasureSet() const;
+
+      // This method returns the Room with the Treasure.
+      // An exception is thrown if:
+      //   The Treasure is not in a Room (logic_error)
+      Coordinate GetTreasure() const;
+
+    // FAST PATH:
+    // These methods never throw for invalid arguments or misuse, and are
+    // intended for hot loops where invalid probes (e.g. a Wall past the
+    // edge of the Labyrinth) are routine. The checked methods above are
+    // implemented on top of them.
+
+      // These methods are the same as the checked methods, but return a
+      // status instead of throwing. The result is only stored on kOk.
+      LabyrinthStatus TryGetInhabitant( const Coordinate rm,
+                                        Inhabitant& inh ) const noexcept;
+      LabyrinthStatus TryItemAt( const Coordinate rm,
+                                 Item& itm ) const noexcept;
+      LabyrinthStatus TryDirectionCheck( const Coordinate rm,
+                                         const Direction d,
+                                         RoomBorder& rb ) const noexcept;
+
+      // These methods are the same as the checked methods, but return a
+      // status instead of throwing for misuse. Nothing is changed unless
+      // kOk is returned.
+      // They may still throw std::bad_alloc in LabyrinthMode::kLarge, or
+      // pass on an exception thrown by an observer.
+      LabyrinthStatus TrySetExit( const Coordinate rm, const Direction d );
+      LabyrinthStatus TryAttackEnemy( const Coordinate rm );
+      LabyrinthStatus TryTakeItem( const Coordinate rm );
+
+      // These methods return the contents of a Room without checking.
+      // The Coordinate must be within the Labyrinth, and Direction d must
+      // not be kNone.
+      Inhabitant GetInhabitantUnchecked( const Coordinate rm ) const noexcept;
+      Item ItemAtUnchecked( const Coordinate rm ) const noexcept;
+      RoomBorder DirectionCheckUnchecked( const Coordinate rm,
+                                          const Direction d ) const noexcept;
+
+    // LAYOUT:
+
+      // This method returns the number of Rooms along the x-axis.
+      size_t XSize() const;
+
+      // This method returns the number of Rooms along the y-axis.
+      size_t YSize() const;
+
+      // This method returns the storage mode of the Labyrinth.
+      LabyrinthMode Mode() const;
+
+      // This method returns a read-only view of the row of Rooms with the
+      // given y-coordinate.
+      // An exception is thrown if:
+      //   The row is outside the Labyrinth (domain_error)
+      RoomRow RowAt( const size_t y ) const;
+
+      // This method returns the Room at the given Coordinate without
+      // checking it. The Coordinate must be within the Labyrinth.
+      const Room& RoomAtUnchecked( const Coordinate rm ) const noexcept;
+
+      // This method returns the number of Rooms which currently have
+      // storage allocated. Rooms without storage are walled and empty, or
+      // are read from a mapped file (see LabyrinthFile::Map()).
+      size_t ResidentRooms() const;
+
+      // This method returns true if any Rooms are read directly from a
+      // mapped file. A Room is copied out of the file, with the rest of its
+      // band (or the whole Labyrinth in LabyrinthMode::kSmall), the first
+      // time it is modified; the file itself is never changed.
+      bool Mapped() const;
+
+      // This method returns a number which changes whenever Rooms are
+      // connected, so that derived data can tell when it is out of date.
+      std::uint64_t TopologyVersion() const;
+
+      // Number of rows in each band of a LabyrinthMode::kLarge Labyrinth.
+      static constexpr size_t kBandRows = 64;
+
+  protected:
+
+    // Parameterized constructor
+    // Used by FixedLabyrinth: a LabyrinthMode::kSmall Labyrinth whose
+    // x_size * y_size Rooms are stored in rooms, which must outlive the
+    // Labyrinth. The sizes are not checked, and nothing is allocated.
+    Labyrinth( const size_t x_size,
+               const size_t y_size,
+               Room* const rooms );
+
   private:
 
-    std::unique_ptr< std::unique_ptr<Room[]>[] > rooms_;
+    // Generators write directly into the Room storage, and files and
+    // journals are loaded directly into it.
+    friend class LabyrinthGenerator;
+    friend class LabyrinthFile;
+    friend class LabyrinthJournal;
+
+    const LabyrinthMode mode_;
     const size_t x_size_;
     const size_t y_size_;
-    const size_t MAX_X_SIZE_ = 20;
-    const size_t MAX_Y_SIZE_ = 20;
+    static constexpr size_t MAX_X_SIZE_ = 20;
+    static constexpr size_t MAX_Y_SIZE_ = 20;
+    static constexpr size_t MAX_LARGE_SIZE_ = 65536;
+
+    // LabyrinthMode::kSmall: x_size_ * y_size_ Rooms, row-major, in
+    // owned_rooms_, a LabyrinthArena, or the storage of a FixedLabyrinth
+    // (inline_rooms_)
+    Room* rooms_ = nullptr;
+    std::unique_ptr<Room[]> owned_rooms_;
+    bool inline_rooms_ = false;
+
+    // LabyrinthMode::kLarge: bands of kBandRows rows, null until modified,
+    // and a single walled, empty row used to read unallocated bands
+    // Bands, and the blank row, may be shared with clones (see Clone()).
+    std::unique_ptr< std::shared_ptr<Room>[] > bands_;
+    std::shared_ptr<Room> blank_row_;
+
+    // Rooms of a mapped file, row-major, used where rooms_ or a band has not
+    // been allocated. mapping_ unmaps the file once the last user is gone.
+    const Room* mapped_rooms_ = nullptr;
+    std::shared_ptr<const void> mapping_;
 
     // Special rooms:
     //   Should be set before the game begins
@@ -138,18 +358,93 @@ class Labyrinth
     Coordinate spawn_1_;
     Coordinate spawn_2_;
     bool exit_set_ = false;
+    Coordinate exit_;
     bool treasure_set_ = false;  // Is also false when the treasure is held
                                  // by a Player
+    Coordinate treasure_;        // Only valid while treasure_set_ is true
+
+    std::uint64_t topology_version_ = 0;
+
+    mutable std::vector<LabyrinthObserver*> observers_;
+
+    // A change recorded for Rollback(): a Room, exit and Treasure as they
+    // were before it.
+    struct JournalEntry
+    {
+      Coordinate rm;
+      Room room;
+      bool exit_set;
+      Coordinate exit;
+      bool treasure_set;
+      Coordinate treasure;
+    };
+    bool journaling_ = false;
+    std::vector<JournalEntry> journal_;
+
+    // Copy constructor
+    // Used by Clone().
+    Labyrinth( const Labyrinth& l );
 
     // This private method returns a reference to the Room at the given
     // coordinate.
     // An exception is thrown if:
     //   The Room is outside the Labyrinth (domain_error)
-    Room& RoomAt( const Coordinate rm ) const;
+    const Room& RoomAt( const Coordinate rm ) const;
+
+    // This private method returns a modifiable reference to the Room at the
+    // given coordinate, allocating its band first in LabyrinthMode::kLarge.
+    // An exception is thrown if:
+    //   The Room is outside the Labyrinth (domain_error)
+    Room& RoomAt( const Coordinate rm );
+
+    // This private method returns a modifiable reference to the Room at
+    // the given coordinate, as RoomAt() does, and records the Room, exit
+    // and Treasure as they are before the change if checkpoints are in use.
+    // The Room must be within the Labyrinth.
+    Room& ModifyRoom( const Coordinate rm );
+
+    // This private method returns a pointer to the first Room of the given
+    // row, allocating its band first in LabyrinthMode::kLarge.
+    // The row must be within the Labyrinth.
+    Room* MutableRowAt( const size_t y );
+
+    // These private methods notify the observers of changed Rooms.
+    void NotifyRoomChanged( const Coordinate rm ) const;
+    void NotifyAllRoomsChanged() const;
+
+    // This private method notifies the observers of a changed spawn.
+    void NotifySpawnsChanged() const;
+
+    // This private method gives the given band (or every Room in
+    // LabyrinthMode::kSmall) storage of its own, holding the Rooms it read
+    // before: from a band shared with a clone, from a mapped file, or
+    // walled and empty.
+    void OwnRooms( const size_t band );
+
+    // This private method returns the number of rows in the given band.
+    size_t BandRows( const size_t band ) const;
+
+    // This private method throws if the sizes are not allowed in the mode.
+    // An exception is thrown if:
+    //   A size of 0 is given (domain_error)
+    //   An x or y size greater than the maximum of the mode is given
+    //     (domain_error)
+    static void CheckSizes( const size_t x_size,
+                            const size_t y_size,
+                            const LabyrinthMode mode );
 
     // This private method returns true if the Room is within the bounds of
     // the Labyrinth, and false otherwise.
-    bool WithinBounds( const Coordinate rm ) const;
+    bool WithinBounds( const Coordinate rm ) const noexcept;
+
+    // This private method returns true if the packed Room (see
+    // Room::Packed()) may be stored at the given Coordinate, and false
+    // otherwise: it has no unused bits or out-of-range fields, and every
+    // Wall it has broken on the edge of the Labyrinth is its exit. Used to
+    // check Rooms read from outside, which are stored without checking.
+    // The Coordinate must be within the Labyrinth.
+    bool PackedRoomFits( const Coordinate rm,
+                         const std::uint16_t packed ) const noexcept;
 
     // This private method returns true if the two Rooms are adjacent, and
     // false otherwise.
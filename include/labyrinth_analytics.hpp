@@ -0,0 +1,125 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ header file contains the LabyrinthAnalytics class, which
+ * measures the quality and difficulty of a maze, and the MazeStats struct
+ * which it fills.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "coordinate.hpp"
+#include "labyrinth.hpp"
+
+// The measurements of one maze. Connections are between Rooms; the exit is
+// not a connection.
+//
+// A corridor is a chain of Rooms with exactly 2 connections each, between
+// two Rooms which have another number of connections; its length is the
+// number of Rooms in the chain.
+//
+// The solution is the shortest path from spawn 1 to the Treasure, then from
+// the Treasure to the Room with the exit.
+struct MazeStats
+{
+  // Number of buckets of corridor_lengths.
+  static constexpr unsigned kCorridorBuckets = 8;
+
+  // Returned in solution_length if the maze has no solution.
+  static constexpr std::uint32_t kUnsolved = 0xFFFFFFFF;
+
+  std::uint32_t rooms;
+  std::uint32_t dead_ends;   // Rooms with a Wall in exactly 3 Directions
+  std::uint32_t junctions;   // Rooms with 3 or 4 connections
+  std::uint32_t corridors;
+  std::uint32_t longest_corridor;
+
+  // Number of corridors of each length: bucket b holds lengths 2^b to
+  // 2^(b + 1) - 1, and the last bucket every longer corridor too
+  std::uint32_t corridor_lengths[kCorridorBuckets];
+
+  std::uint32_t solution_length;     // Steps, or kUnsolved
+  std::uint32_t solution_rooms;      // Different Rooms on the solution
+  std::uint32_t solution_minotaurs;  // Live Minotaurs on the solution
+  std::uint32_t side_branches;       // Connections from the solution to
+                                     // Rooms which are not on it
+
+  // side_branches per Room of the solution: the wrong turns a player can
+  // take at each step
+  float branching_factor;
+
+  // Fraction of the Rooms which are in corridors: high in a maze of long,
+  // winding passages, low in one with many short branches and dead ends
+  float river;
+
+  // Fraction of the Rooms in corridors which turn (rather than go
+  // straight through)
+  float turn_ratio;
+};
+
+static_assert( sizeof(MazeStats) == 80,
+               "The stats of a maze must stay 80 bytes." );
+
+// Every measurement is made by one pass over the Rooms of the Labyrinth,
+// one walk along each corridor and one breadth-first search (from the
+// Treasure, which reaches both spawn 1 and the exit). Only the pass reads
+// the Labyrinth; the walk and search read a byte per Room copied by it.
+//
+// Scratch buffers are allocated once per Labyrinth size and reused, so that
+// analysing many mazes (e.g. to reject candidates) does not allocate. Each
+// thread should use its own LabyrinthAnalytics.
+//
+// A corridor which is a closed loop, touching no other Room, is not counted
+// (it cannot occur in a connected maze).
+class LabyrinthAnalytics
+{
+  public:
+
+    // This method returns the measurements of the maze.
+    // An exception is thrown if:
+    //   The Labyrinth has too many Rooms to be numbered in 32 bits
+    //     (length_error)
+    MazeStats Analyze( const Labyrinth& l );
+
+  private:
+
+    // Added to the index of a Room to step to the Room next to it in each
+    // direction, in the order of kOpenMask (north, east, south, west)
+    std::uint32_t steps_[4] = { 0, 0, 0, 0 };
+
+    // Scratch buffers, indexed by Room (y * x size + x): cells_ holds the
+    // OpenMask() of the Room and the flags below, parent_ the Room before
+    // it in the search (kNoParent if not reached)
+    std::vector<std::uint8_t> cells_;
+    std::vector<std::uint32_t> parent_;
+    std::vector<std::uint32_t> queue_;
+
+    static constexpr std::uint8_t  kOpenMask   = 0x0F;
+    static constexpr std::uint8_t  kMinotaur   = 0x10;
+    static constexpr std::uint8_t  kWalked     = 0x20;  // In a corridor
+    static constexpr std::uint8_t  kOnSolution = 0x40;
+    static constexpr std::uint32_t kNoParent   = 0xFFFFFFFF;
+
+    // This private method returns the index of the Room next to Room i in
+    // direction d (bit d of kOpenMask), which must be open.
+    std::uint32_t Neighbour( const std::uint32_t i, const unsigned d ) const;
+
+    // This private method measures every corridor which ends at a Room
+    // without 2 connections, walking each from one end to the other.
+    void MeasureCorridors( MazeStats& stats );
+
+    // This private method searches from the Treasure to every Room it
+    // reaches, leaving parent_ set.
+    void Search( const std::uint32_t treasure );
+
+    // This private method marks the path from Room i back to the Treasure
+    // as on the solution (appending each Room to queue_ the first time it
+    // is marked), and returns the number of steps.
+    std::uint32_t MarkPath( std::uint32_t i, MazeStats& stats );
+};
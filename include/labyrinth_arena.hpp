@@ -0,0 +1,174 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ header file contains the LabyrinthArena class, which hands out
+ * memory from large blocks and releases it all at once, and the
+ * ArenaAllocator class template, which lets containers allocate from it.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+
+// A bump allocator: each allocation is the next aligned bytes of the
+// current block, and memory is only given back by Release(), all at once.
+// When a block is full another is allocated, at least as large as the
+// block size, so an arena sized for a game (e.g. a Labyrinth and its
+// LabyrinthMap) serves the whole game from one block.
+//
+// Everything allocated from an arena must be destroyed before Release() or
+// the destruction of the arena. An arena must only be used by one thread
+// at a time.
+class LabyrinthArena
+{
+  public:
+
+    // Default size of each block, in bytes.
+    static constexpr size_t kDefaultBlockSize = 64 * 1024;
+
+    // Parameterized constructor
+    // No memory is allocated until the first allocation.
+    // An exception is thrown if:
+    //   The block size is 0 (invalid_argument)
+    explicit LabyrinthArena( const size_t block_size = kDefaultBlockSize );
+
+    // Parameterized constructor
+    // The first block is the given buffer, which is not owned and must
+    // outlive the arena; further blocks are allocated if it is full.
+    // An exception is thrown if:
+    //   buffer is null or size is 0 (invalid_argument)
+    LabyrinthArena( void* const buffer, const size_t size );
+
+    // Destructor
+    ~LabyrinthArena();
+
+    LabyrinthArena( const LabyrinthArena& ) = delete;
+    LabyrinthArena& operator=( const LabyrinthArena& ) = delete;
+
+    // This method returns bytes of memory with the given alignment (a power
+    // of 2 of at most alignof(std::max_align_t)).
+    // An exception is thrown if:
+    //   The alignment is not a power of 2, or is too large
+    //     (invalid_argument)
+    //   A block cannot be allocated (bad_alloc)
+    void* Allocate( const size_t bytes, const size_t alignment );
+
+    // This method makes every byte of the arena available again. Blocks
+    // after the first are freed, so an arena which grew past its first
+    // block returns to it; the first block is kept for reuse.
+    void Release();
+
+    // This method returns the number of bytes allocated since the last
+    // Release(), including padding for alignment.
+    size_t BytesUsed() const;
+
+    // This method returns the number of blocks currently held.
+    size_t Blocks() const;
+
+  private:
+
+    // The header at the start of each allocated block; blocks are freed in
+    // a list from the newest.
+    struct Block
+    {
+      Block* previous;
+      size_t size;  // Usable bytes after the header
+    };
+
+    const size_t block_size_;
+
+    // The first block, which is kept by Release(): the given buffer, or the
+    // first allocated block
+    unsigned char* first_ = nullptr;
+    size_t first_size_ = 0;
+    bool owns_first_ = false;
+
+    // Blocks allocated after the first, newest first
+    Block* extra_ = nullptr;
+    size_t blocks_ = 0;
+
+    // The current block, and the next free byte in it
+    unsigned char* begin_ = nullptr;
+    unsigned char* end_ = nullptr;
+    unsigned char* next_ = nullptr;
+
+    size_t used_ = 0;
+
+    // This private method makes a new block current, large enough for the
+    // given number of bytes at any supported alignment.
+    void Grow( const size_t bytes );
+
+    // This private method frees the blocks allocated after the first.
+    void FreeExtraBlocks();
+};
+
+// A standard allocator which allocates from a LabyrinthArena, or with
+// operator new if it has no arena (e.g. when default-constructed), so the
+// same container type can be used with or without an arena.
+// Deallocating arena memory does nothing; it is released with the arena.
+template <typename T>
+class ArenaAllocator
+{
+  public:
+
+    using value_type = T;
+
+    // Parameterized constructor
+    ArenaAllocator( LabyrinthArena* const arena = nullptr ) noexcept :
+      arena_(arena)
+    {
+    }
+
+    // Converting constructor
+    template <typename U>
+    ArenaAllocator( const ArenaAllocator<U>& a ) noexcept :
+      arena_(a.Arena())
+    {
+    }
+
+    // These methods allocate and deallocate memory for n objects.
+    T* allocate( const size_t n )
+    {
+      if( arena_ != nullptr )
+      {
+        return static_cast<T*>( arena_->Allocate(n * sizeof(T), alignof(T)) );
+      }
+      return static_cast<T*>( ::operator new(n * sizeof(T)) );
+    }
+
+    void deallocate( T* const p, const size_t )
+    {
+      if( arena_ == nullptr )
+      {
+        ::operator delete( p );
+      }
+    }
+
+    // This method returns the arena, or null.
+    LabyrinthArena* Arena() const noexcept
+    {
+      return arena_;
+    }
+
+  private:
+
+    LabyrinthArena* arena_;
+};
+
+// Allocators are equal if they use the same arena (or both use operator
+// new), i.e. if either can deallocate the memory of the other.
+template <typename T, typename U>
+bool operator==( const ArenaAllocator<T>& a, const ArenaAllocator<U>& b )
+{
+  return a.Arena() == b.Arena();
+}
+
+template <typename T, typename U>
+bool operator!=( const ArenaAllocator<T>& a, const ArenaAllocator<U>& b )
+{
+  return a.Arena() != b.Arena();
+}
@@ -0,0 +1,157 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ header file contains the LabyrinthConcurrentView class, a copy
+ * of the Rooms of a Labyrinth which other threads can read while the game
+ * thread changes the Labyrinth.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "room_properties.hpp"
+#include "room.hpp"
+#include "coordinate.hpp"
+#include "labyrinth.hpp"
+#include "labyrinth_observer.hpp"
+
+// A copy of every Room, the exit and the Treasure of a Labyrinth, taken
+// together by LabyrinthConcurrentView::Snapshot().
+struct LabyrinthViewSnapshot
+{
+  std::vector<Room> rooms;  // Row-major, as in the Labyrinth
+  bool exit_set = false;
+  Coordinate exit;
+  Direction exit_direction = Direction::kNone;
+  bool treasure_set = false;
+  Coordinate treasure;
+  std::uint64_t version = 0;
+};
+
+// A Labyrinth is not safe to read from one thread while another changes
+// it. A LabyrinthConcurrentView observes a Labyrinth and keeps a copy of
+// each Room in an atomic 16-bit word, so spectator and analytics threads
+// can read it without a lock while the game thread plays:
+//
+//   The game thread owns the Labyrinth and the view: it constructs and
+//   destroys the view, and every change it makes to the Labyrinth is
+//   copied into the view before the change returns. Nothing else is
+//   needed; the game thread never waits for readers.
+//
+//   Any number of other threads may call the const methods of the view at
+//   any time. A Room is read in one atomic load, so its Inhabitant, Item
+//   and Walls are always from the same moment, and reads never block;
+//   reads of different Rooms may see different moments. Snapshot() copies
+//   everything from a single moment: the view keeps a sequence number
+//   (a seqlock), and a copy which overlaps a change is retried.
+//
+// Memory use is 2 bytes per Room. Each change to the Labyrinth costs the
+// game thread a few atomic stores; generating a maze (or rolling back)
+// copies every Room.
+//
+// l_ does not use a smart pointer because it is simply a pointer to the
+// related Labyrinth, not a heap allocation.
+class LabyrinthConcurrentView : public LabyrinthObserver
+{
+  public:
+
+    // Parameterized constructor
+    // Only the game thread may construct the view, as it observes l.
+    // An exception is thrown if:
+    //   l is null (invalid_argument)
+    LabyrinthConcurrentView( const Labyrinth* const l );
+
+    // Destructor
+    // Only the game thread may destroy the view, after every reader has
+    // finished with it.
+    ~LabyrinthConcurrentView();
+
+    LabyrinthConcurrentView( const LabyrinthConcurrentView& ) = delete;
+    LabyrinthConcurrentView& operator=( const LabyrinthConcurrentView& ) =
+      delete;
+
+    // READERS:
+    // These methods may be called from any thread.
+
+      // These methods return the number of Rooms along each axis.
+      size_t XSize() const;
+      size_t YSize() const;
+
+      // This method returns a copy of the Room at the given Coordinate.
+      // An exception is thrown if:
+      //   The Room is outside the Labyrinth (domain_error)
+      Room RoomAt( const Coordinate rm ) const;
+
+      // These methods are the same as those of Labyrinth.
+      // An exception is thrown if:
+      //   The Room is outside the Labyrinth (domain_error)
+      //   Direction d is kNone (invalid_argument)
+      Inhabitant GetInhabitant( const Coordinate rm ) const;
+      Item ItemAt( const Coordinate rm ) const;
+      RoomBorder DirectionCheck( const Coordinate rm,
+                                 const Direction d ) const;
+
+      // This method stores the Room with the Treasure in rm and returns
+      // true if the Treasure is in a Room, and returns false otherwise.
+      bool TryGetTreasure( Coordinate& rm ) const;
+
+      // This method stores the Room with the exit and its Direction, and
+      // returns true if the exit is set, and returns false otherwise.
+      bool TryGetExit( Coordinate& rm, Direction& d ) const;
+
+      // This method returns the number of changes copied into the view.
+      std::uint64_t Version() const;
+
+      // This method copies the whole view, as it was at one moment, into
+      // snapshot (whose storage is reused).
+      void Snapshot( LabyrinthViewSnapshot& snapshot ) const;
+
+    // GAME THREAD:
+    // These methods are called by the Labyrinth as it changes.
+
+      // This method copies the given Room, the exit and the Treasure into
+      // the view.
+      void RoomChanged( const Coordinate rm ) override;
+
+      // This method copies every Room, the exit and the Treasure into the
+      // view.
+      void AllRoomsChanged() override;
+
+  private:
+
+    const Labyrinth* const l_;
+    const size_t x_size_;
+    const size_t y_size_;
+
+    // Room::Packed() of each Room, row-major
+    std::unique_ptr< std::atomic<std::uint16_t>[] > rooms_;
+
+    // The exit and the Treasure, each packed into one word so that whether
+    // it is set, its Room and (for the exit) its Direction are read together
+    std::atomic<std::uint64_t> exit_;
+    std::atomic<std::uint64_t> treasure_;
+
+    // Odd while the game thread is copying a change; increased by 2 for
+    // each change
+    std::atomic<std::uint64_t> sequence_;
+
+    // This private method returns the index of the given Room.
+    // An exception is thrown if:
+    //   The Room is outside the Labyrinth (domain_error)
+    size_t IndexOf( const Coordinate rm, const char* const caller ) const;
+
+    // These private methods begin and end a change, around which readers
+    // of Snapshot() retry.
+    void BeginWrite();
+    void EndWrite();
+
+    // This private method copies the exit and the Treasure into the view.
+    void CopySpecialRooms();
+};
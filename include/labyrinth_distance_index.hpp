@@ -0,0 +1,146 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ header file contains the LabyrinthDistanceIndex class, which
+ * precomputes distances between the Rooms of a Labyrinth so that repeated
+ * distance queries are fast.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "coordinate.hpp"
+#include "labyrinth.hpp"
+#include "labyrinth_graph.hpp"
+
+// The kind of index, chosen from the size and topology of the Labyrinth.
+enum class DistanceIndexKind
+{
+  kNone,       // Not built yet
+  kAllPairs,   // Small Labyrinths: every distance, O(1) queries
+  kTree,       // Perfect mazes: tree distance through the lowest common
+               // ancestor, O(log n) queries
+  kLandmarks,  // Other Labyrinths: A* guided by distances to landmark
+               // Rooms (ALT)
+};
+
+// The index is built on the first query, and is rebuilt on the next query
+// after Rooms of the Labyrinth are connected (see
+// Labyrinth::TopologyVersion()).
+//
+// Memory use is 2 bytes per pair of Rooms for kAllPairs, 12 bytes per Room
+// for kTree, and 4 bytes per Room per landmark (plus the search buffers)
+// for kLandmarks, plus the LabyrinthGraph which every kind searches.
+//
+// l_ does not use a smart pointer because it is simply a pointer to the
+// related Labyrinth, not a heap allocation.
+class LabyrinthDistanceIndex
+{
+  public:
+
+    // Parameterized constructor
+    // landmarks is the number of landmark Rooms used for kLandmarks.
+    // An exception is thrown if:
+    //   l is null (invalid_argument)
+    //   landmarks is 0 (invalid_argument)
+    //   The Labyrinth has too many Rooms to be numbered in 32 bits
+    //     (length_error)
+    LabyrinthDistanceIndex( const Labyrinth* const l,
+                            const size_t landmarks = 4 );
+
+    // This method builds the index now rather than on the next query.
+    void Build();
+
+    // This method returns the kind of index which was last built.
+    DistanceIndexKind Kind() const;
+
+    // This method returns true if the index has not been built for the
+    // current layout of the Labyrinth.
+    bool Stale() const;
+
+    // This method returns the number of steps between the given Rooms, or
+    // kUnreachable if there is no path.
+    // An exception is thrown if:
+    //   One or both Rooms are outside the Labyrinth (domain_error)
+    size_t Distance( const Coordinate start, const Coordinate goal );
+
+    // This method returns the number of steps from the given Room to the
+    // Room with the exit, or kUnreachable if there is no path.
+    // An exception is thrown if:
+    //   The Room is outside the Labyrinth (domain_error)
+    //   The exit has not been set (logic_error)
+    size_t DistanceToExit( const Coordinate start );
+
+    // This method returns the number of steps from the given Room to the
+    // closest of the targets, or kUnreachable if none can be reached.
+    // An exception is thrown if:
+    //   Any Room is outside the Labyrinth (domain_error)
+    size_t NearestDistance( const Coordinate start,
+                            const std::vector<Coordinate>& targets );
+
+    // Returned when there is no path.
+    static constexpr size_t kUnreachable = static_cast<size_t>( -1 );
+
+    // Labyrinths with at most this many Rooms use DistanceIndexKind::kAllPairs.
+    static constexpr size_t kAllPairsMaxRooms = 1024;
+
+  private:
+
+    const Labyrinth* const l_;
+    const size_t landmark_count_;
+    LabyrinthGraph graph_;  // Searched while building, and by kLandmarks
+    DistanceIndexKind kind_ = DistanceIndexKind::kNone;
+    std::uint64_t version_ = 0;
+
+    // kAllPairs: distance from Room i to Room j at [i * rooms + j]
+    std::vector<std::uint16_t> all_pairs_;
+
+    // kTree: heavy-path decomposition of the maze rooted at Room 0
+    std::vector<std::uint32_t> parent_;
+    std::vector<std::uint32_t> depth_;
+    std::vector<std::uint32_t> head_;  // Top Room of the heavy path
+
+    // kLandmarks: distance from landmark k to Room i at [k * rooms + i],
+    // and the buffers of the guided search
+    std::vector<std::uint32_t> landmarks_;
+    std::vector<std::uint32_t> active_;  // Landmarks which reach the goal
+    std::vector<std::uint32_t> seen_;
+    std::vector<std::uint32_t> cost_;
+    std::vector<std::uint64_t> heap_;
+    std::uint32_t query_ = 0;
+
+    // Breadth-first search buffer, used while building
+    std::vector<std::uint32_t> queue_;
+
+    // This private method rebuilds the index if it is stale.
+    void Refresh();
+
+    // This private method returns the distance between Rooms s and g.
+    size_t IndexDistance( const std::uint32_t s, const std::uint32_t g );
+
+    // These private methods build each kind of index.
+    void BuildAllPairs();
+    void BuildTree();
+    void BuildLandmarks();
+
+    // This private method searches from Room s with A*, using the
+    // landmarks for the estimate of the distance to Room g.
+    size_t LandmarkSearch( const std::uint32_t s, const std::uint32_t g );
+
+    // This private method stores the breadth-first distance from Room s to
+    // every Room in distance, with UINT32_MAX for unreachable Rooms, and
+    // leaves the reached Rooms in queue_ in the order they were reached.
+    // Returns the number of Rooms reached.
+    size_t BreadthFirst( const std::uint32_t s, std::uint32_t* distance );
+
+    // This private method returns the index of the given Room.
+    // An exception is thrown if:
+    //   The Room is outside the Labyrinth (domain_error)
+    std::uint32_t IndexOf( const Coordinate rm,
+                           const char* const caller ) const;
+};
@@ -0,0 +1,147 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ header file contains the LabyrinthFile class, which saves and
+ * loads Labyrinths in a compact binary format, and the LabyrinthFileSink
+ * class, which writes a streamed maze in the same format.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+#include "room_properties.hpp"
+#include "room.hpp"
+#include "coordinate.hpp"
+#include "labyrinth.hpp"
+#include "labyrinth_stream.hpp"
+
+// A Labyrinth file is a 64-byte header followed by every Room in row-major
+// order, as the packed 16-bit encoding of Room::Packed().
+//
+// The header holds, in order: the magic number, the version of the format,
+// the size of the header, the x and y sizes, the LabyrinthMode, a flag byte
+// (bit 0 exit set, bit 1 Treasure set), the Direction of the exit, one
+// reserved byte, the spawns, the exit and the Treasure (an x then a y of 32
+// bits each), then reserved bytes which are always 0.
+//
+// Every number is stored in the byte order of the machine which wrote it;
+// a file written with another byte order is rejected when it is read.
+class LabyrinthFile
+{
+  public:
+
+    // This method writes the Labyrinth to the file at the given path,
+    // replacing it if it exists. The path must not be a file which is
+    // mapped by a Labyrinth.
+    // An exception is thrown if:
+    //   The file cannot be written (runtime_error)
+    static void Save( const Labyrinth& l, const std::string& path );
+
+    // This method reads the file at the given path into a new Labyrinth.
+    // In LabyrinthMode::kLarge, bands of walled, empty Rooms are not
+    // allocated.
+    // An exception is thrown if:
+    //   The file cannot be read (runtime_error)
+    //   The file is not a Labyrinth file of this version, or is truncated
+    //     (runtime_error)
+    //   A Room has unused bits set or an invalid field, or a broken Wall
+    //     other than the exit on the edge of the Labyrinth (runtime_error)
+    //   The exit or Treasure of the header is not the only one in the
+    //     Rooms (runtime_error)
+    //   The header has an invalid size, spawn, exit or Treasure
+    //     (domain_error)
+    static Labyrinth Load( const std::string& path );
+
+    // This method maps the file at the given path into memory and returns a
+    // Labyrinth which reads its Rooms directly from the file, without
+    // copying them. Rooms are copied out of the file only when they are
+    // modified (see Labyrinth::Mapped()); the file is never changed.
+    // Only the Rooms on the edge of the Labyrinth, and those at the exit and
+    // Treasure, are checked.
+    // An exception is thrown if:
+    //   The file cannot be read or mapped (runtime_error)
+    //   The file is not a Labyrinth file of this version, or is truncated
+    //     (runtime_error)
+    //   A Room on the edge of the Labyrinth has unused bits set, an invalid
+    //     field, or a broken Wall other than the exit on the edge
+    //     (runtime_error)
+    //   The Room at the exit or Treasure of the header has no exit or
+    //     Treasure (runtime_error)
+    //   The header has an invalid size, spawn, exit or Treasure
+    //     (domain_error)
+    static Labyrinth Map( const std::string& path );
+
+    // Identifies a Labyrinth file: "LABY" in the byte order of the machine.
+    static constexpr std::uint32_t kMagic = 0x5942414C;
+
+    // Version of the format which is written, and the only one read.
+    static constexpr std::uint16_t kVersion = 1;
+
+    // Size of the header, in bytes, before the first Room.
+    static constexpr size_t kHeaderSize = 64;
+
+  private:
+
+    // These private methods write the header for a maze with the given
+    // description and storage mode, and the given Rooms.
+    // An exception is thrown if:
+    //   The file cannot be written (runtime_error)
+    static void WriteHeader( std::ofstream& file,
+                             const LabyrinthStreamInfo& info,
+                             const LabyrinthMode mode );
+    static void WriteRooms( std::ofstream& file,
+                            const Room* const rooms,
+                            const size_t count );
+
+    // This private method checks the header at the start of data, which
+    // holds size bytes, and returns the Labyrinth it describes without any
+    // Rooms connected.
+    // An exception is thrown if:
+    //   The header is invalid, or size is too small for every Room
+    //     (runtime_error or domain_error)
+    static Labyrinth ReadHeader( const unsigned char* const data,
+                                 const size_t size,
+                                 const char* const caller );
+
+    friend class LabyrinthFileSink;
+};
+
+// This class writes a maze from a LabyrinthStreamGenerator into a Labyrinth
+// file as it is generated, so that mazes too large to generate in memory
+// can later be mapped with LabyrinthFile::Map().
+// Mazes of up to 20 x 20 Rooms are written as LabyrinthMode::kSmall, and
+// others as LabyrinthMode::kLarge.
+class LabyrinthFileSink : public RoomRowSink
+{
+  public:
+
+    // Parameterized constructor
+    // The file is created when the maze begins.
+    LabyrinthFileSink( const std::string& path );
+
+    // An exception is thrown if:
+    //   The file cannot be written (runtime_error)
+    //   The maze is larger than a large Labyrinth (65536 x 65536)
+    //     (domain_error)
+    void Begin( const LabyrinthStreamInfo& info );
+
+    // An exception is thrown if:
+    //   The file cannot be written (runtime_error)
+    void Rows( const size_t y, const Room* const rooms, const size_t rows );
+
+    // An exception is thrown if:
+    //   The file cannot be written (runtime_error)
+    void End();
+
+  private:
+
+    const std::string path_;
+    std::ofstream file_;
+    size_t x_size_ = 0;
+};
@@ -0,0 +1,118 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ header file contains the LabyrinthGenerator class, which fills a
+ * Labyrinth with a randomly generated perfect maze and places its exit,
+ * Items and Inhabitants.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "coordinate.hpp"
+#include "labyrinth.hpp"
+#include "eller_row_generator.hpp"
+
+enum class GeneratorAlgorithm
+{
+  kRecursiveBacktracker,
+  kKruskal,
+  kWilson,
+  kEller,
+};
+
+// Options for a LabyrinthGenerator.
+// Spawns are placed in Rooms without Inhabitants; Items and Inhabitants are
+// each placed in distinct Rooms.
+struct GeneratorOptions
+{
+  GeneratorAlgorithm algorithm = GeneratorAlgorithm::kRecursiveBacktracker;
+  std::uint64_t seed = 0;
+
+  bool place_spawns   = true;
+  bool place_exit     = true;
+  bool place_treasure = true;
+  size_t bullets   = 0;
+  size_t minotaurs = 0;
+  size_t mirrors   = 0;
+};
+
+// The same options and seed always generate the same maze.
+// Mazes are written directly into the Room storage, so rooms are connected
+// without the per-edge validation of Labyrinth::ConnectRooms().
+//
+// Scratch memory is kept between calls so that repeated generation does not
+// allocate. kRecursiveBacktracker, kKruskal and kWilson need scratch space
+// proportional to the number of Rooms; kEller only needs scratch space
+// proportional to the x size, and is the best choice for large Labyrinths.
+class LabyrinthGenerator
+{
+  public:
+
+    // Parameterized constructor
+    explicit LabyrinthGenerator( const GeneratorOptions& options );
+
+    // This method generates a perfect maze (exactly one path between any
+    // two Rooms) in the given Labyrinth, then places its contents.
+    // The Labyrinth should not have any connected Rooms, an exit, or any
+    // Items or Inhabitants beforehand. Checkpoints of the Labyrinth are
+    // discarded.
+    // An exception is thrown if:
+    //   There are more Items or Inhabitants than Rooms (invalid_argument)
+    //   The exit or Treasure has already been set (logic_error)
+    void Generate( Labyrinth& l );
+
+    // This method changes the seed used by the next call to Generate().
+    void SetSeed( const std::uint64_t seed );
+
+    // This method returns the options of the generator.
+    const GeneratorOptions& Options() const;
+
+  private:
+
+    GeneratorOptions options_;
+    std::mt19937_64 rng_;
+
+    // Scratch space, reused between calls:
+    //   open_ holds the Directions opened from each Room as Room wall bits
+    std::vector<std::uint8_t> open_;
+    std::vector<size_t> stack_;
+    std::vector<size_t> parent_;
+    std::vector<size_t> edges_;
+    EllerRowGenerator eller_;
+
+    // This private method returns a random number in [0, n).
+    size_t RandomBelow( const size_t n );
+
+    // These private methods generate the maze into open_.
+    void RecursiveBacktracker( const size_t x_size, const size_t y_size );
+    void Kruskal( const size_t x_size, const size_t y_size );
+    void Wilson( const size_t x_size, const size_t y_size );
+
+    // This private method generates the maze row by row, writing each row to
+    // the Labyrinth as soon as it is complete.
+    void Eller( Labyrinth& l );
+
+    // This private method breaks the Walls given in open_ in the Labyrinth.
+    void CommitOpen( Labyrinth& l );
+
+    // This private method returns the union-find root of Room i, halving
+    // paths along the way.
+    size_t FindRoot( size_t i );
+
+    // This private method places the spawns, exit, Items and Inhabitants.
+    void PlaceContents( Labyrinth& l );
+
+    // This private method returns a random Room without an Item.
+    Coordinate RandomEmptyItemRoom( const Labyrinth& l );
+
+    // This private method returns a random Room without an Inhabitant which
+    // is not a spawn.
+    Coordinate RandomEmptyInhabitantRoom( const Labyrinth& l );
+};
@@ -0,0 +1,151 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ header file contains the LabyrinthGraph class, which stores the
+ * connections between the Rooms of a Labyrinth as adjacency lists so that
+ * searches can walk them without reading the Rooms.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "room_properties.hpp"
+#include "coordinate.hpp"
+#include "labyrinth.hpp"
+
+// The connected neighbours of one Room in a LabyrinthGraph, in the order
+// north, east, south, west. A NeighbourRange does not own its Rooms; it is
+// only valid until the graph is rebuilt.
+struct NeighbourRange
+{
+  const std::uint32_t* first;
+  const Direction* directions;
+  size_t length;
+
+  // Parameterized constructor
+  NeighbourRange( const std::uint32_t* const first_room,
+                  const Direction* const first_direction,
+                  const size_t range_length )
+  {
+    first = first_room;
+    directions = first_direction;
+    length = range_length;
+  }
+
+  // This method returns a pointer to the index of the first neighbour.
+  const std::uint32_t* begin() const
+  {
+    return first;
+  }
+
+  // This method returns a pointer past the index of the last neighbour.
+  const std::uint32_t* end() const
+  {
+    return first + length;
+  }
+
+  // This method returns the number of neighbours.
+  size_t size() const
+  {
+    return length;
+  }
+
+  // Operator overload for []
+  // Returns the index of neighbour k, which is not checked.
+  std::uint32_t operator[]( const size_t k ) const
+  {
+    return first[k];
+  }
+
+  // This method returns the Direction from the Room to neighbour k, which
+  // is not checked.
+  Direction DirectionOf( const size_t k ) const
+  {
+    return directions[k];
+  }
+};
+
+// Rooms are numbered in row-major order (y * x size + x), as in
+// LabyrinthSolver. The neighbours of every Room are stored one after
+// another (compressed sparse rows): the neighbours of Room i are entries
+// offsets_[i] to offsets_[i + 1] - 1, so walking them is a read of
+// adjacent memory with no Walls to test and no bounds to check. The exit
+// is not a neighbour.
+//
+// The graph is built on construction, and must be rebuilt after Rooms of
+// the Labyrinth are connected: Refresh() rebuilds it only if it is out of
+// date (see Labyrinth::TopologyVersion()). Neighbours() does not check, so
+// that hot loops pay nothing per Room; call Refresh() once before a search.
+//
+// Memory use is 4 bytes per Room, and 5 bytes per open Wall (twice the
+// number of connections).
+//
+// l_ does not use a smart pointer because it is simply a pointer to the
+// related Labyrinth, not a heap allocation.
+class LabyrinthGraph
+{
+  public:
+
+    // Parameterized constructor
+    // An exception is thrown if:
+    //   l is null (invalid_argument)
+    //   The Labyrinth has too many Rooms to be numbered in 32 bits
+    //     (length_error)
+    LabyrinthGraph( const Labyrinth* const l );
+
+    // This method builds the graph from the current layout of the
+    // Labyrinth.
+    // An exception is thrown if:
+    //   The Labyrinth has too many Rooms to be numbered in 32 bits
+    //     (length_error)
+    void Build();
+
+    // This method rebuilds the graph if it is out of date, and returns
+    // true if it was rebuilt.
+    bool Refresh();
+
+    // This method returns true if the graph has not been built for the
+    // current layout of the Labyrinth.
+    bool Stale() const;
+
+    // This method returns the number of Rooms in the graph.
+    size_t Rooms() const;
+
+    // This method returns the number of connections between Rooms.
+    size_t Connections() const;
+
+    // This method returns the index of the given Room.
+    // An exception is thrown if:
+    //   The Room is outside the Labyrinth (domain_error)
+    std::uint32_t IndexOf( const Coordinate rm ) const;
+
+    // This method returns the Coordinate of Room i, which is not checked.
+    Coordinate ToCoordinate( const std::uint32_t i ) const noexcept;
+
+    // This method returns the neighbours of Room i which are connected to
+    // it. Room i is not checked.
+    NeighbourRange Neighbours( const std::uint32_t i ) const noexcept;
+
+    // This method returns the number of neighbours of Room i, which is not
+    // checked.
+    unsigned Degree( const std::uint32_t i ) const noexcept;
+
+  private:
+
+    const Labyrinth* const l_;
+    size_t x_size_ = 0;
+    std::uint64_t version_ = 0;
+
+    // offsets_[i] is the first entry of Room i in neighbours_ and
+    // directions_; offsets_[Rooms()] is the number of entries.
+    std::vector<std::uint32_t> offsets_;
+    std::vector<std::uint32_t> neighbours_;
+    std::vector<Direction> directions_;
+};
+
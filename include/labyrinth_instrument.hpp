@@ -0,0 +1,125 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ header file contains the LabyrinthInstrument class, which counts
+ * and times the hot paths of Labyrinth and LabyrinthMap when the code is
+ * compiled with LABYRINTH_INSTRUMENT defined.
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+// The operations which are counted and timed.
+enum class InstrumentOp : std::uint8_t
+{
+  kConnectRooms,
+  kDirectionCheck,
+  kSetExit,
+  kTakeItem,
+  kDisplay,        // LabyrinthMap::Render(), and so every Display()
+  kUpdateBorders,
+  kUpdateRooms,
+};
+constexpr size_t kInstrumentOps = 7;
+
+// The events which are only counted.
+enum class InstrumentCounter : std::uint8_t
+{
+  kBoundsFailures,  // Coordinates outside a Labyrinth
+  kMapRebuilds,     // Maps built in full: when first rendered, or after
+                    // the whole Labyrinth changed
+  kRoomsRedrawn,    // Map Rooms updated from a single changed Room
+  kRenderBytes,     // Bytes of map text rendered
+};
+constexpr size_t kInstrumentCounters = 4;
+
+// Timings are kept in a histogram where bucket b holds the calls which took
+// [2^b, 2^(b + 1)) nanoseconds (bucket 0 also holds calls which took 0).
+constexpr size_t kInstrumentBuckets = 32;
+
+// The totals of one operation. Times are in nanoseconds.
+struct InstrumentOpStats
+{
+  std::uint64_t calls = 0;
+  std::uint64_t errors = 0;  // Calls which ended by throwing an exception
+  std::uint64_t total_time = 0;
+  std::array<std::uint64_t, kInstrumentBuckets> histogram = {};
+};
+
+// The totals of every thread, including threads which have exited.
+struct InstrumentSnapshot
+{
+  std::array<InstrumentOpStats, kInstrumentOps> ops = {};
+  std::array<std::uint64_t, kInstrumentCounters> counters = {};
+  size_t threads = 0;  // Threads which are running and have been counted
+};
+
+// Each thread counts into its own block of counters, which only it writes,
+// so counting never contends between threads. Snapshot() adds up every
+// block, and may be called from any thread at any time; the totals of a
+// thread which is counting at the same time may be up to date or not.
+//
+// Without LABYRINTH_INSTRUMENT, the macros below compile to nothing and
+// Snapshot() returns zeros, so code which scrapes the counters still
+// compiles. Instrumenting DirectionCheck() reads the clock twice per call,
+// which is several times the cost of the check itself.
+class LabyrinthInstrument
+{
+  public:
+
+    // This method returns true if the code was compiled with
+    // LABYRINTH_INSTRUMENT defined.
+    static bool Enabled();
+
+    // This method returns the totals of every thread.
+    static InstrumentSnapshot Snapshot();
+
+    // These methods return the name of an operation or counter.
+    static const char* Name( const InstrumentOp op );
+    static const char* Name( const InstrumentCounter counter );
+
+    // These methods add to the counters of the calling thread. They are
+    // used by the macros below rather than called directly.
+    static void Record( const InstrumentOp op,
+                        const std::uint64_t time,
+                        const bool failed );
+    static void Count( const InstrumentCounter counter,
+                       const std::uint64_t n );
+};
+
+// This class times an operation from its construction to its destruction,
+// and counts it as an error if it is destroyed by an exception.
+class InstrumentScope
+{
+  public:
+
+    // Parameterized constructor
+    explicit InstrumentScope( const InstrumentOp op );
+
+    // Destructor
+    ~InstrumentScope();
+
+    InstrumentScope( const InstrumentScope& ) = delete;
+    InstrumentScope& operator=( const InstrumentScope& ) = delete;
+
+  private:
+
+    const InstrumentOp op_;
+    const std::chrono::steady_clock::time_point start_;
+};
+
+#ifdef LABYRINTH_INSTRUMENT
+#define LABYRINTH_INSTRUMENT_SCOPE( op ) \
+  const InstrumentScope labyrinth_instrument_scope_( op )
+#define LABYRINTH_INSTRUMENT_COUNT( counter, n ) \
+  LabyrinthInstrument::Count( counter, n )
+#else
+#define LABYRINTH_INSTRUMENT_SCOPE( op ) ((void)0)
+#define LABYRINTH_INSTRUMENT_COUNT( counter, n ) ((void)0)
+#endif
@@ -0,0 +1,206 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ header file contains the LabyrinthJournal class, which records
+ * every change to a Labyrinth in an append-only binary file and replays it.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "room_properties.hpp"
+#include "room.hpp"
+#include "coordinate.hpp"
+#include "labyrinth.hpp"
+#include "labyrinth_observer.hpp"
+
+// Kinds of events in a journal, named after what changed in the Room.
+enum class JournalEventKind : std::uint8_t
+{
+  kRoom,        // More than one part of the Room (e.g. Rollback())
+  kWalls,       // ConnectRooms() or a generated maze
+  kExit,        // SetExit()
+  kInhabitant,  // SetInhabitant() or AttackEnemy()
+  kItem,        // SetItem(), TakeItem() or DropTreasure()
+  kSpawn1,      // SetSpawn1(); before and after are 0
+  kSpawn2,      // SetSpawn2(); before and after are 0
+};
+
+// A single event of a journal, as it is stored: the Room which changed,
+// and Room::Packed() of it before and after the change.
+// Coordinates of a Labyrinth are at most 65535.
+struct JournalEvent
+{
+  std::uint16_t x;
+  std::uint16_t y;
+  std::uint16_t before;
+  std::uint16_t after;
+  JournalEventKind kind;
+  std::uint8_t reserved;  // Always 0
+};
+
+static_assert( sizeof(JournalEvent) == 10,
+               "An event of a journal must stay 10 bytes." );
+
+// A LabyrinthJournal observes a Labyrinth and appends an event to a file for
+// every Room which changes and every spawn which is set, so that a game can
+// be audited or replayed later.
+//
+// A journal file is a 32-byte header followed by 10-byte JournalEvents. The
+// header holds, in order: the magic number, the version of the format, the
+// size of the header, the x and y sizes, the LabyrinthMode, then reserved
+// bytes which are always 0. The first events record the Labyrinth as it was
+// when the journal was created: each Room which is not walled and empty,
+// then both spawns. Every number is stored in the byte order of the machine
+// which wrote it.
+//
+// The game thread never writes to the file. Each event is copied into a
+// ring buffer shared with a flush thread owned by the journal, which
+// appends the events to the file in batches. The buffer has a single
+// producer and a single consumer, so recording an event is a copy and an
+// atomic store; the game thread only waits if the flush thread has fallen
+// capacity events behind (see Stalls()), and then wakes it.
+//
+// The journal keeps a copy of each Room to tell what changed: memory use is
+// 2 bytes per Room, plus the ring buffer.
+//
+// l_ does not use a smart pointer because it is simply a pointer to the
+// related Labyrinth, not a heap allocation.
+class LabyrinthJournal : public LabyrinthObserver
+{
+  public:
+
+    // Parameterized constructor
+    // The file at the given path is replaced, and the current state of the
+    // Labyrinth is recorded. capacity is the number of events the ring
+    // buffer holds, and must be a power of 2.
+    // Only the game thread may construct the journal, as it observes l.
+    // An exception is thrown if:
+    //   l is null (invalid_argument)
+    //   capacity is 0 or not a power of 2 (invalid_argument)
+    //   The file cannot be written (runtime_error)
+    LabyrinthJournal( const Labyrinth* const l,
+                      const std::string& path,
+                      const size_t capacity = kDefaultCapacity );
+
+    // Destructor
+    // Every event recorded is written to the file before it returns.
+    ~LabyrinthJournal();
+
+    LabyrinthJournal( const LabyrinthJournal& ) = delete;
+    LabyrinthJournal& operator=( const LabyrinthJournal& ) = delete;
+
+    // This method waits until every event recorded so far is written to the
+    // file, and returns true if every write succeeded.
+    bool Flush();
+
+    // This method returns the number of events recorded.
+    size_t Recorded() const;
+
+    // This method returns the number of times the game thread waited for a
+    // full ring buffer.
+    size_t Stalls() const;
+
+    // This method returns a Labyrinth with the state recorded by the first
+    // events of the journal at the given path (every event by default).
+    // Rooms are written as they were recorded, without the checks of the
+    // methods which changed them; the spawns, exit and Treasure follow the
+    // Rooms. A partial event at the end of the file (e.g. if the program
+    // ended while it was written) is ignored.
+    // Each Room is only checked on its own, so replaying part of a journal
+    // can leave a Wall broken on one side only (e.g. stopping between the
+    // two events of ConnectRooms()).
+    // An exception is thrown if:
+    //   The file cannot be read (runtime_error)
+    //   The file is not a journal of this version (runtime_error)
+    //   The file has an event outside the Labyrinth (runtime_error)
+    //   The file has an event which leaves a Room invalid, or with a broken
+    //     Wall other than the exit on the edge of the Labyrinth
+    //     (runtime_error)
+    //   The header has an invalid size (domain_error)
+    static Labyrinth Replay( const std::string& path,
+                             const size_t events = kAllEvents );
+
+    // These methods record the change.
+    void RoomChanged( const Coordinate rm ) override;
+    void AllRoomsChanged() override;
+    void SpawnsChanged() override;
+
+    // Identifies a journal: "LJNL" in the byte order of the machine.
+    static constexpr std::uint32_t kMagic = 0x4C4E4A4C;
+
+    // Version of the format which is written, and the only one read.
+    static constexpr std::uint16_t kVersion = 1;
+
+    // Size of the header, in bytes, before the first event.
+    static constexpr size_t kHeaderSize = 32;
+
+    // Default number of events in the ring buffer.
+    static constexpr size_t kDefaultCapacity = 4096;
+
+    // Number of events given to Replay() to replay every event.
+    static constexpr size_t kAllEvents = static_cast<size_t>( -1 );
+
+  private:
+
+    const Labyrinth* const l_;
+
+    // Room::Packed() of each Room as last recorded, row-major, and the
+    // spawns as last recorded
+    std::vector<std::uint16_t> rooms_;
+    Coordinate spawn_1_;
+    Coordinate spawn_2_;
+
+    // Only used by the game thread
+    size_t recorded_ = 0;
+    size_t stalls_ = 0;
+
+    // The ring buffer: head_ is the number of events copied in by the game
+    // thread, and tail_ the number taken out by the flush thread. Each is
+    // on its own cache line, so that neither thread slows the other.
+    const size_t mask_;
+    std::unique_ptr<JournalEvent[]> ring_;
+    std::atomic<size_t> head_;
+    char head_padding_[64 - sizeof(std::atomic<size_t>)];
+    std::atomic<size_t> tail_;
+    char tail_padding_[64 - sizeof(std::atomic<size_t>)];
+
+    // Number of events written to the file, and whether a write failed
+    std::atomic<size_t> written_;
+    std::atomic<bool> failed_;
+
+    // The flush thread sleeps on wake_ while the buffer is empty; it is
+    // woken early only by a full buffer, Flush() or the destructor, never
+    // by Record()
+    std::mutex wake_mutex_;
+    std::condition_variable wake_;
+
+    std::atomic<bool> stop_;
+    std::ofstream file_;
+    std::thread flusher_;
+
+    // This private method records the Room at the given index, if it
+    // changed.
+    void RecordRoom( const size_t i, const Coordinate rm,
+                     const std::uint16_t after );
+
+    // This private method copies an event into the ring buffer, waiting
+    // while it is full.
+    void Record( const JournalEvent& e );
+
+    // This private method is run by the flush thread: it writes the events
+    // in the ring buffer to the file until the journal is destroyed.
+    void FlushEvents();
+};
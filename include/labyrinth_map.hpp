@@ -1,7 +1,7 @@
 /*
  *
  * Author: Jeffrey Leung
- * Last edited: 2016-02-01
+ * Last edited: 2026-10-14
  *
  * This C++ header file contains classes related to creating a LabyrinthMap
  * which creates, updates, and displays a map of a given Labyrinth.
@@ -10,194 +10,131 @@
 
 #pragma once
 
-#include <cstring>
+#include <cstdint>
 #include <iostream>
-#include <memory>
+#include <string>
+#include <vector>
 
 #include "coordinate.hpp"
 #include "room_properties.hpp"
 #include "labyrinth.hpp"
+#include "labyrinth_observer.hpp"
+#include "labyrinth_visibility.hpp"
+#include "labyrinth_arena.hpp"
+#include "work_stealing_pool.hpp"
 
-// This class is a template for LabyrinthMapCoordinateBorder and
-// LabyrinthMapCoordinateRoom to inherit from, so that an array can be
-// made where any given element is either a Border or a Room.
-//
-// Any methods here will throw a logic_error if the method is called on
-// an incorrect object (i.e. a Room-only method on a Border or a Border-only
-// method on a Room).
-//
-// Methods will throw the following logic_error exceptions when not overridden
-// (i.e. a method for Borders will not be implemented by Room, and thus will
-// throw the error when called).
-class LabyrinthMapCoordinate
-{
-  public:
-
-    // Destructor
-    // Prevents error messages about non-virtual destructors
-    virtual ~LabyrinthMapCoordinate()
-    {
-    }
-
-    // Border-only methods:
-
-    virtual bool IsWall( const Direction d ) const
-    {
-      // Avoiding unused parameter warning
-      (void)(d);
-
-      throw std::logic_error( "Error: A LabyrinthMapCoordinateRoom "\
-        "attempted to call IsWall(), which is a Border-only method.\n"\
-        "Consider using IsRoom() to check whether the Coordinate is a" \
-        "Border or Room.\n" );
-    }
-
-    virtual void SetWall( const Direction d, const bool exists )
-    {
-      // Avoiding unused parameter warning
-      (void)(d);
-      (void)(exists);
-
-      throw std::logic_error( "Error: A LabyrinthMapCoordinateRoom "\
-        "attempted to call SetWall(), which is a Border-only method.\n"\
-        "Consider using IsRoom() to check whether the Coordinate is a" \
-        "Border or Room.\n" );
-    }
-
-    virtual bool IsExit() const
-    {
-      throw std::logic_error( "Error: A LabyrinthMapCoordinateRoom "\
-        "attempted to call IsExit(), which is a Border-only method.\n"\
-        "Consider using IsRoom() to check whether the Coordinate is a" \
-        "Border or Room.\n" );
-    }
-
-    virtual void SetExit( const bool b )
-    {
-      // Avoiding unused parameter warning
-      (void)(b);
-
-      throw std::logic_error( "Error: A LabyrinthMapCoordinateRoom "\
-        "attempted to call SetExit(), which is a Border-only method.\n"\
-        "Consider using IsRoom() to check whether the Coordinate is a" \
-        "Border or Room.\n" );
-    }
-
-    // Room-only methods:
-
-    virtual Inhabitant GetInhabitant() const
-    {
-      throw std::logic_error( "Error: A LabyrinthMapCoordinateBorder "\
-        "attempted to call HasInhabitant(), which is a Room-only method.\n"\
-        "Consider using IsRoom() to check whether the Coordinate is a" \
-        "Border or Room.\n" );
-    }
-
-    virtual void SetInhabitant( const Inhabitant inh )
-    {
-      // Avoiding unused parameter warning
-      (void)(inh);
-
-      throw std::logic_error( "Error: A LabyrinthMapCoordinateBorder "\
-        "attempted to call SetInhabitant(), which is a Room-only method.\n"\
-        "Consider using IsRoom() to check whether the Coordinate is a" \
-        "Border or Room.\n" );
-    }
-
-    virtual Item ItemAt() const
-    {
-      throw std::logic_error( "Error: A LabyrinthMapCoordinateBorder "\
-        "attempted to call ItemAt(), which is a Room-only method.\n"\
-        "Consider using IsRoom() to check whether the Coordinate is a" \
-        "Border or Room.\n" );
-    }
-
-    virtual void SetItem( const Item i )
-    {
-      // Avoiding unused parameter warning
-      (void)(i);
-
-      throw std::logic_error( "Error: A LabyrinthMapCoordinateBorder "\
-        "attempted to call SetItem(), which is a Room-only method.\n"\
-        "Consider using IsRoom() to check whether the Coordinate is a" \
-        "Border or Room.\n" );
-    }
-
-};
-
-// This class contains necessary information about a given Border coordinate,
-// so that a map can be displayed.
+// This struct contains necessary information about a given Border
+// coordinate, so that a map can be displayed.
 //
 // A Border is the boundary between 2 Rooms, the corner between
 // 4 Rooms, or a coordinate of the outermost wall.
 // Borders/Walls are true by default to avoid working explicitly with:
 //   The outer wall
-class LabyrinthMapCoordinateBorder : public LabyrinthMapCoordinate
+struct LabyrinthMapBorder
 {
-  public:
-
-    // This method returns whether a given Wall coordinate has a wall in the
-    // given direction.
-    // An exception is thrown if:
-    //   d is kNone (invalid_argument)
-    bool IsWall( const Direction d ) const;
-
-    // This method sets the Wall of a given Wall coordinate to either
-    // exist or not exist.
-    // May be used to set a wall which already exists, or remove a Wall
-    // which has already been removed.
-    // An exception is thrown if:
-    //   d is kNone (invalid_argument)
-    void SetWall( const Direction d, const bool exists );
-
-    // This method returns whether a given Wall coordinate has the exit.
-    bool IsExit() const;
-
-    // This method sets whether or not a given Wall coordinate has the exit.
-    // May be used to set an exit where the exit already exists, or to remove
-    // an exit where none exists.
-    void SetExit( const bool b );
+  // Bits 0-3 are the Walls drawn from the centre of the Border towards the
+  // north, east, south and west; bit 4 is set if the Border has the exit.
+  static constexpr std::uint8_t kNorth = 0x01;
+  static constexpr std::uint8_t kEast  = 0x02;
+  static constexpr std::uint8_t kSouth = 0x04;
+  static constexpr std::uint8_t kWest  = 0x08;
+  static constexpr std::uint8_t kWalls = 0x0F;
+  static constexpr std::uint8_t kExit  = 0x10;
+
+  std::uint8_t bits = kWalls;
+
+  // This method sets or clears the given bits.
+  void Set( const std::uint8_t mask, const bool b )
+  {
+    bits = b ? static_cast<std::uint8_t>( bits | mask ) :
+               static_cast<std::uint8_t>( bits & ~mask );
+  }
+};
 
-  private:
-    bool wall_north_ = true;
-    bool wall_east_  = true;
-    bool wall_south_ = true;
-    bool wall_west_  = true;
+// This struct contains necessary information about a given Room
+// coordinate, so that a map can be displayed.
+struct LabyrinthMapRoom
+{
+  Inhabitant inh = Inhabitant::kNone;
+  Item itm = Item::kNone;
+};
 
-    bool exit_       = false;
+// Kinds of cells given to a LabyrinthMapBackend, one for each Map
+// Coordinate. A Room with both an Inhabitant and an Item is shown as the
+// first of the Treasure, a live Minotaur, an intact Mirror, a Bullet, a
+// dead Minotaur and a cracked Mirror which it has.
+enum class MapCell : std::uint8_t
+{
+  kOpen,           // An empty Room, or a Border without Walls
+  kWall,           // A Border with Walls
+  kExit,           // The Border with the exit
+  kTreasure,
+  kMinotaur,
+  kMirror,
+  kBullet,
+  kMinotaurDead,
+  kMirrorCracked,
 };
 
-// This class contains necessary information about a given Room coordinate,
-// so that a map can be displayed.
-class LabyrinthMapCoordinateRoom : public LabyrinthMapCoordinate
+// This class is a template for output formats of a LabyrinthMap other than
+// its UTF-8 text, such as images (see LabyrinthMap::Render()). Each format
+// receives the same cells, one row of the Map at a time.
+class LabyrinthMapBackend
 {
   public:
 
-    // This method returns the inhabitant of the current Room.
-    Inhabitant GetInhabitant() const;
-
-    // This method sets the current inhabitant of the map's Room.
-    // May be used to set the inhabitant to the same inhabitant, or to
-    // no inhabitant.
-    void SetInhabitant( const Inhabitant inh );
+    // Destructor
+    // Prevents error messages about non-virtual destructors
+    virtual ~LabyrinthMapBackend()
+    {
+    }
 
-    // This method returns the item in a given Room.
-    Item ItemAt() const;
+    // This method is called once, before any rows, with the number of
+    // cells in each row and the number of rows.
+    virtual void Begin( const size_t width, const size_t height ) = 0;
 
-    // This method sets the item in a given map's Room.
-    // May be used to set the same item or remove a non-existent item.
-    void SetItem( const Item i );
+    // This method is called with each row of cells in order, from the top.
+    // The cells are only valid until the method returns.
+    virtual void Row( const MapCell* const cells ) = 0;
 
-  private:
-    Inhabitant i_ = Inhabitant::kNone;
-    Item itm_ = Item::kNone;
+    // This method is called once, after the last row.
+    virtual void End()
+    {
+    }
 };
 
 // This class contains a map of a Labyrinth.
 // Rooms are indexed first with the y-coordinate, then with the x-coordinate.
+//
+// In Map Coordinates, a Coordinate with an odd x and odd y is a Room and
+// every other Coordinate is a Border. Rooms and Borders are each stored in
+// a single row-major array, so the Map only makes two allocations.
 // l_ does not use a smart pointer because it is simply a pointer to the
 // related Labyrinth, not a heap allocation.
-class LabyrinthMap
+//
+// The map observes the Labyrinth, and Display() only updates the Rooms which
+// changed since the last Display() (and the Borders next to them).
+// Constructing a map allocates no map cells (only the Labyrinth's list of
+// observers may grow): the cells are derived from the Labyrinth, so they
+// are only allocated and built when the map is first rendered (by
+// Display(), Render() or a window of them), and changes before then are
+// not recorded. Maps which are never rendered (e.g. of sessions with no
+// display) cost nothing else.
+// The Labyrinth must outlive the map.
+//
+// A map can also be rendered as a single Player has explored it, from a
+// LabyrinthVisibility; Rooms which the Player has not revealed are blank,
+// as are the walls which no revealed Room is next to.
+//
+// For boards larger than a terminal, a window of the map around a Room can
+// be rendered without the axes or legend, in time proportional to the size
+// of the window; an overview draws the whole Labyrinth with one character
+// for each block of Rooms.
+//
+// When the whole Labyrinth changes (e.g. it is loaded or regenerated), the
+// map is rebuilt in bands of rows, which can be spread over the workers of
+// a WorkStealingPool (see SetRebuildPool()).
+class LabyrinthMap : private LabyrinthObserver
 {
   public:
 
@@ -205,28 +142,195 @@ class LabyrinthMap
     // An exception is thrown if:
     //   l is null (invalid_argument)
     //   A size of 0 is given (domain_error)
+    //   A size greater than that of the Labyrinth is given (domain_error)
     LabyrinthMap( const Labyrinth* const l,
                   const size_t x_size,
                   const size_t y_size );
 
-    // This method displays a map of the current Labyrinth.
+    // Parameterized constructor
+    // The cells of the map, and its record of changed Rooms, are allocated
+    // from the arena, which must outlive the map. The rendered text is not.
+    // An exception is thrown if:
+    //   l is null (invalid_argument)
+    //   A size of 0 is given (domain_error)
+    //   A size greater than that of the Labyrinth is given (domain_error)
+    LabyrinthMap( const Labyrinth* const l,
+                  const size_t x_size,
+                  const size_t y_size,
+                  LabyrinthArena& arena );
+
+    // Destructor
+    ~LabyrinthMap();
+
+    // This method displays a map of the current Labyrinth on std::cout.
     void Display();
 
+    // This method displays a map of the current Labyrinth on the given
+    // stream, with a single write.
+    void Display( std::ostream& os );
+
+    // This method displays a map of the current Labyrinth on the given file
+    // descriptor, with a single write where possible.
+    // An exception is thrown if:
+    //   The file descriptor cannot be written to (runtime_error)
+    void Display( const int fd );
+
+    // This method returns the complete text of a map of the current
+    // Labyrinth, in UTF-8. The text is kept in a buffer which is reused by
+    // the next call.
+    const std::string& Render();
+
+    // These methods display and return a map of the Rooms which have been
+    // revealed to the given Player, in the same way as above.
+    // An exception is thrown if:
+    //   v is not the same size as the map (invalid_argument)
+    //   The Player does not exist (invalid_argument)
+    void Display( std::ostream& os,
+                  const LabyrinthVisibility& v,
+                  const size_t player );
+    const std::string& Render( const LabyrinthVisibility& v,
+                               const size_t player );
+
+    // These methods display and return a map of the largest window of
+    // Rooms which fits in the given number of columns and rows of text,
+    // centred on the given Room (e.g. the Room of a Player) as far as the
+    // edges of the Labyrinth allow. A window of w x h Rooms takes 3w + 1
+    // columns and 2h + 1 rows, with no axes or legend.
+    // An exception is thrown if:
+    //   The Room is outside the Labyrinth (domain_error)
+    //   The columns and rows do not fit one Room (4 x 3) (invalid_argument)
+    void DisplayWindow( std::ostream& os,
+                        const Coordinate centre,
+                        const size_t columns,
+                        const size_t rows );
+    const std::string& RenderWindow( const Coordinate centre,
+                                     const size_t columns,
+                                     const size_t rows );
+
+    // These methods display and return a window of the Rooms which have
+    // been revealed to the given Player, in the same way as above.
+    // An exception is thrown if:
+    //   v is not the same size as the map (invalid_argument)
+    //   The Player does not exist (invalid_argument)
+    //   The Room is outside the Labyrinth (domain_error)
+    //   The columns and rows do not fit one Room (4 x 3) (invalid_argument)
+    void DisplayWindow( std::ostream& os,
+                        const LabyrinthVisibility& v,
+                        const size_t player,
+                        const Coordinate centre,
+                        const size_t columns,
+                        const size_t rows );
+    const std::string& RenderWindow( const LabyrinthVisibility& v,
+                                     const size_t player,
+                                     const Coordinate centre,
+                                     const size_t columns,
+                                     const size_t rows );
+
+    // These methods display and return an overview of the whole Labyrinth
+    // in at most the given number of columns and rows of text. Each
+    // character is a block of k x k Rooms, for the smallest k which fits,
+    // and shows the most important thing in the block:
+    //   T: The Treasure
+    //   E: The exit
+    //   M: A live Minotaur
+    //   O: An intact Mirror
+    //   •: A Bullet
+    //   .: Rooms connected to others
+    //   #: Only walled Rooms
+    // Every Room is read once, straight from the Labyrinth.
+    // An exception is thrown if:
+    //   The columns or rows are 0 (invalid_argument)
+    void DisplayOverview( std::ostream& os,
+                          const size_t columns,
+                          const size_t rows );
+    const std::string& RenderOverview( const size_t columns,
+                                       const size_t rows );
+
+    // This method gives every cell of a map of the current Labyrinth to
+    // the backend, one Map row at a time (see MapCell), in
+    // (2 * x_size + 1) x (2 * y_size + 1) cells.
+    // Exceptions thrown by the backend are passed on.
+    void Render( LabyrinthMapBackend& backend );
+
+    // This method rebuilds the whole map on the workers of the pool from
+    // now on, in bands of rows (if the Labyrinth has enough Rooms), or on
+    // the calling thread if pool is null (the default).
+    // The pool must outlive the map or be replaced first, and is waited on
+    // by each rebuild, so it should not be running other tasks.
+    void SetRebuildPool( WorkStealingPool* const pool );
+
+    // Least number of Rooms in each band of a rebuild on a pool.
+    static constexpr size_t kRebuildBandRooms = 4096;
+
   private:
 
+    // A rectangle of Labyrinth Rooms to render.
+    struct Window
+    {
+      size_t x_first;
+      size_t y_first;
+      size_t x_rooms;
+      size_t y_rooms;
+    };
+
+    // Parameterized constructor
+    // Used by the public constructors; arena may be null.
+    LabyrinthMap( const Labyrinth* const l,
+                  const size_t x_size,
+                  const size_t y_size,
+                  LabyrinthArena* const arena );
+
     const Labyrinth* const l_;
     const size_t x_size_;
     const size_t y_size_;
 
-    // 2-d array of LabyrinthMapCoordinate pointers
-    std::unique_ptr<
-      std::unique_ptr<
-        std::unique_ptr<LabyrinthMapCoordinate>
-      []>
-    []> map_;
+    // Map Rooms, x_size_ * y_size_
+    std::vector< LabyrinthMapRoom, ArenaAllocator<LabyrinthMapRoom> > rooms_;
+
+    // Map Borders, row by row: even Map rows have map_x_size_ Borders, and
+    // odd Map rows have a Border at each even x (x_size_ + 1 Borders)
+    std::vector< LabyrinthMapBorder,
+                 ArenaAllocator<LabyrinthMapBorder> > borders_;
+
     const size_t map_x_size_;
     const size_t map_y_size_;
 
+    // Rooms changed since the last update, each listed once
+    std::vector< bool, ArenaAllocator<bool> > dirty_;
+    std::vector< size_t, ArenaAllocator<size_t> > dirty_rooms_;
+    bool all_dirty_ = false;
+
+    // Workers of full rebuilds, or null to rebuild on the calling thread
+    WorkStealingPool* rebuild_pool_ = nullptr;
+
+    // Whether the cells have been allocated and built (see Materialize())
+    bool materialized_ = false;
+
+    // Map Border marked with the exit, if exit_marked_
+    bool exit_marked_ = false;
+    Coordinate exit_border_;
+
+    // Text of the last rendered map
+    std::string frame_;
+
+    // Most important contents of each block of a row of the last overview
+    std::vector<std::uint8_t> overview_ranks_;
+
+    // Cells of the Map row last given to a LabyrinthMapBackend
+    std::vector<MapCell> cell_row_;
+
+    // These private methods record changes to the Labyrinth.
+    void RoomChanged( const Coordinate rm );
+    void AllRoomsChanged();
+
+    // This private method allocates the Map Rooms and Borders and builds
+    // them from the Labyrinth, the first time the map is rendered.
+    void Materialize();
+
+    // This private method updates the Map where the Labyrinth changed,
+    // materializing it first if needed.
+    void Synchronize();
+
     // This private method returns true if the Coordinate is within the bounds
     // of the Map, and false otherwise.
     bool WithinBoundsOfMap( const Coordinate c ) const;
@@ -237,11 +341,10 @@ class LabyrinthMap
     //   The Coordinate is outside of the Map (domain_error)
     bool IsRoom( const Coordinate c ) const;
 
-    // This private method returns a reference to the Map Coordinate at
-    // the given Coordinate.
-    // An exception is thrown if:
-    //   The Coordinate is outside of the Map (domain_error)
-    LabyrinthMapCoordinate& MapCoordinateAt( const Coordinate c ) const;
+    // This private method returns a reference to the Map Border at the
+    // given Coordinate, which must designate a Border of the Map.
+    LabyrinthMapBorder& BorderAt( const Coordinate c );
+    const LabyrinthMapBorder& BorderAt( const Coordinate c ) const;
 
     // This private method converts a Labyrinth Coordinate to the same
     // location in the Map.
@@ -269,30 +372,87 @@ class LabyrinthMap
     // for that.
     void CleanBorders();
 
+    // This private method updates every Map Border and Map Room from the
+    // Labyrinth, on rebuild_pool_ if there is one.
+    void Rebuild();
+
     // This private method updates the Map Borders by checking the contents
-    // of the Labyrinth.
+    // of the Labyrinth rows from y_first up to (not including) y_end.
     // Borders in the Map but not in the Labyrinth will be removed from
     // the Map; borders in the Labyrinth but not in the Map will not
     // be added to the Map.
-    void UpdateBorders();
+    void UpdateBorders( const size_t y_first, const size_t y_end );
 
     // This private method updates the Map Rooms by checking the contents
-    // of the Labyrinth.
-    void UpdateRooms();
-
-    // This private method displays the x-axis label as well as numbering
+    // of the Labyrinth rows from y_first up to (not including) y_end.
+    void UpdateRooms( const size_t y_first, const size_t y_end );
+
+    // These private methods update the east and south Map Borders, and the
+    // contents, of a single Map Room from the given Labyrinth Room.
+    void UpdateRoomBorders( const Coordinate c_laby, const Room& rm );
+    void UpdateRoomContents( const Coordinate c_laby, const Room& rm );
+
+    // This private method marks the Map Border with the exit of the
+    // Labyrinth, and clears the mark it last made if the exit has moved or
+    // been removed (e.g. by Labyrinth::Rollback()).
+    void UpdateExit();
+
+    // This private method renders the Rooms of the window into frame_,
+    // with only the Rooms revealed to the Player if v is not null, and with
+    // the axes and legend if labels is true.
+    const std::string& RenderFrame( const LabyrinthVisibility* const v,
+                                    const size_t player,
+                                    const Window& w,
+                                    const bool labels );
+
+    // This private method returns the MapCell of the given Map Coordinate.
+    MapCell CellAt( const Coordinate c ) const;
+
+    // This private method returns the window of Rooms described for
+    // RenderWindow().
+    // An exception is thrown if:
+    //   The Room is outside the Labyrinth (domain_error)
+    //   The columns and rows do not fit one Room (4 x 3) (invalid_argument)
+    Window FitWindow( const Coordinate centre,
+                      const size_t columns,
+                      const size_t rows,
+                      const char* const caller ) const;
+
+    // This private method throws if v cannot be rendered with the map.
+    // An exception is thrown if:
+    //   v is not the same size as the map (invalid_argument)
+    //   The Player does not exist (invalid_argument)
+    void CheckVisibility( const LabyrinthVisibility& v,
+                          const size_t player,
+                          const char* const caller ) const;
+
+    // This private method returns true if the Labyrinth Room is revealed to
+    // the Player, and false if it is not or is outside the Labyrinth.
+    bool RoomRevealed( const LabyrinthVisibility& v,
+                       const size_t player,
+                       const size_t x,
+                       const size_t y ) const;
+
+    // This private method returns the Wall bits of the given Border which
+    // are next to a Room revealed to the Player.
+    // The Coordinate must designate a Border of the Map.
+    std::uint8_t RevealedWalls( const Coordinate c,
+                                const LabyrinthVisibility& v,
+                                const size_t player ) const;
+
+    // This private method appends the x-axis label as well as numbering
     // of the x-coordinates of Rooms.
-    // Only to be used by Display().
-    void LabelXAxis() const;
+    // Only to be used by Render().
+    void LabelXAxis( std::string& out ) const;
 
-    // This private method displays numbering of the y-coordinates of a Room
+    // This private method appends numbering of the y-coordinates of a Room
     // as well as the y-axis label (if in the correct position), or padding
     // if the row has no Rooms.
-    // Only to be used by Display().
-    // Should be called every time a row of the Map is printed.
-    void LabelYAxis( const size_t y ) const;
+    // Only to be used by Render().
+    // Should be called every time a row of the Map is rendered.
+    void LabelYAxis( const size_t y, std::string& out ) const;
 
-    // This private method returns characters with the contents of the
+    // This private method appends characters with the contents of the
     // given Room Coordinate.
     // Legend of symbols:
     //   Inhabitants:
@@ -305,18 +465,17 @@ class LabyrinthMap
     //     None:
     //     Bullet:   •
     //     Treasure: T
-    // An exception is thrown if:
-    //   The Coordinate is outside of the Labyrinth (domain_error)
-    //   The Coordinate designates a Border (logic_error)
-    std::string DisplayRoom( const Coordinate c ) const;
-
-    // This private method returns a character representing the given
-    // Border Coordinate.
-    // An exception is thrown if:
-    //   The Coordinate is outside of the Labyrinth (domain_error)
-    //   The Coordinate designates a Room (logic_error)
-    std::string DisplayBorder( const Coordinate c ) const;
-
-    // This private method displays a legend for the Map symbols.
-    void DisplayLegend() const;
+    // The Coordinate must designate a Room of the Map.
+    void DisplayRoom( const Coordinate c, std::string& out ) const;
+
+    // This private method appends a character representing the given
+    // Border Coordinate, with only the Wall bits in walls.
+    // The Coordinate must designate a Border of the Map.
+    void DisplayBorder( const Coordinate c,
+                        std::string& out,
+                        const std::uint8_t walls =
+                          LabyrinthMapBorder::kWalls ) const;
+
+    // This private method appends a legend for the Map symbols.
+    void DisplayLegend( std::string& out ) const;
 };
@@ -0,0 +1,143 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ header file contains output formats of a LabyrinthMap other than
+ * its UTF-8 text: compact ASCII, a 1-bit PBM bitmap and an indexed-colour
+ * PNG image.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "labyrinth_map.hpp"
+
+// This class writes a map as text with one byte for each cell, and a
+// newline after each row:
+//   Walls:       #
+//   Exit:        E
+//   Treasure:    T
+//   Minotaur:    M (live), m (dead)
+//   Mirror:      O (intact), 0 (cracked)
+//   Bullet:      *
+//   Other cells: space
+class AsciiMapBackend : public LabyrinthMapBackend
+{
+  public:
+
+    // Parameterized constructor
+    // The stream must outlive the backend.
+    AsciiMapBackend( std::ostream& os );
+
+    void Begin( const size_t width, const size_t height ) override;
+
+    // An exception is thrown if:
+    //   The stream cannot be written (runtime_error)
+    void Row( const MapCell* const cells ) override;
+
+  private:
+
+    std::ostream& os_;
+    std::string line_;
+};
+
+// This class writes a map as a binary PBM (portable bitmap) image with one
+// pixel for each cell: Walls are black, and every other cell (including the
+// exit) is white. Each row takes (width + 7) / 8 bytes.
+class PbmMapBackend : public LabyrinthMapBackend
+{
+  public:
+
+    // Parameterized constructor
+    // The stream must outlive the backend.
+    PbmMapBackend( std::ostream& os );
+
+    // An exception is thrown if:
+    //   The stream cannot be written (runtime_error)
+    void Begin( const size_t width, const size_t height ) override;
+    void Row( const MapCell* const cells ) override;
+
+  private:
+
+    std::ostream& os_;
+    size_t width_ = 0;
+    std::vector<std::uint8_t> row_;
+};
+
+// This class writes a map as a PNG image with one pixel for each cell, in
+// 4-bit indexed colour (the index of a pixel is its MapCell).
+//
+// Each row is compressed as it is given, so memory use is proportional to
+// the width of the map, and the image is written in IDAT chunks of about
+// kChunkSize bytes. Rows are compressed with fixed Huffman codes and runs
+// of repeated bytes, which is fast and suits the long runs of Walls and
+// open cells in a maze, without depending on a compression library.
+class PngMapBackend : public LabyrinthMapBackend
+{
+  public:
+
+    // Parameterized constructor
+    // The stream must outlive the backend, and should be opened in binary
+    // mode.
+    PngMapBackend( std::ostream& os );
+
+    // An exception is thrown if:
+    //   The stream cannot be written (runtime_error)
+    void Begin( const size_t width, const size_t height ) override;
+    void Row( const MapCell* const cells ) override;
+    void End() override;
+
+    // Number of compressed bytes gathered before an IDAT chunk is written.
+    static constexpr size_t kChunkSize = 32768;
+
+  private:
+
+    std::ostream& os_;
+    size_t width_ = 0;
+
+    // The row being compressed: a filter byte (always 0), then two pixels
+    // in each byte
+    std::vector<std::uint8_t> row_;
+
+    // Compressed bytes which have not been written, and bits which do not
+    // fill a byte yet (the first bit_count_ bits of bits_)
+    std::vector<std::uint8_t> pending_;
+    std::uint32_t bits_ = 0;
+    unsigned bit_count_ = 0;
+
+    // Adler-32 checksum of the uncompressed rows
+    std::uint32_t adler_a_ = 1;
+    std::uint32_t adler_b_ = 0;
+
+    // This private method appends the bits of value, from the least
+    // significant, to the compressed bytes.
+    void PutBits( const std::uint32_t value, const unsigned count );
+
+    // This private method appends a literal byte, a run of the byte before
+    // (3 to 258 bytes long), or the end of a block.
+    void PutLiteral( const unsigned value );
+    void PutRun( const size_t length );
+    void PutEndOfBlock();
+
+    // This private method appends row_ as a compressed block.
+    void CompressRow();
+
+    // This private method writes the pending compressed bytes as an IDAT
+    // chunk.
+    // An exception is thrown if:
+    //   The stream cannot be written (runtime_error)
+    void WritePending();
+
+    // This private method writes a chunk with the given type and data.
+    // An exception is thrown if:
+    //   The stream cannot be written (runtime_error)
+    void WriteChunk( const char* const type,
+                     const std::uint8_t* const data,
+                     const size_t size );
+};
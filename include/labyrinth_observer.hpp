@@ -0,0 +1,44 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ header file contains the LabyrinthObserver class, which is
+ * notified of changes to the Rooms of a Labyrinth.
+ *
+ */
+
+#pragma once
+
+#include "coordinate.hpp"
+
+// This class is a template for classes which keep data derived from a
+// Labyrinth (e.g. a LabyrinthMap) and want to update only what changed.
+// See Labyrinth::AddObserver().
+//
+// Notifications are sent after the change has been made. Observers must not
+// add or remove observers of the same Labyrinth while being notified.
+class LabyrinthObserver
+{
+  public:
+
+    // Destructor
+    // Prevents error messages about non-virtual destructors
+    virtual ~LabyrinthObserver()
+    {
+    }
+
+    // This method is called after the Walls, exit, Inhabitant or Item of
+    // the given Room change.
+    virtual void RoomChanged( const Coordinate rm ) = 0;
+
+    // This method is called after many Rooms change at once (e.g. when a
+    // maze is generated), instead of RoomChanged() for each of them.
+    virtual void AllRoomsChanged() = 0;
+
+    // This method is called after a spawn Room is set. Observers which do
+    // not keep the spawns need not override it.
+    virtual void SpawnsChanged()
+    {
+    }
+};
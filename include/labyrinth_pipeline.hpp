@@ -0,0 +1,127 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ header file contains the LabyrinthPipeline class, which
+ * generates, validates and saves many Labyrinths in parallel.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "labyrinth.hpp"
+#include "labyrinth_generator.hpp"
+#include "work_stealing_pool.hpp"
+
+// Options of every Labyrinth made by a pipeline. The seed of
+// GeneratorOptions is replaced by the seed of each Labyrinth.
+struct PipelineOptions
+{
+  GeneratorOptions generator;
+  size_t x_size = 20;
+  size_t y_size = 20;
+
+  // Labyrinths are saved as <directory>/<prefix><seed>.laby, or not at all
+  // if the directory is empty.
+  std::string directory;
+  std::string prefix = "maze_";
+  bool save_invalid = false;
+
+  size_t workers = 0;  // 0 uses one worker per hardware thread
+};
+
+// The checks of a Labyrinth. Reachability is from the spawns through
+// connected Rooms.
+struct MazeValidation
+{
+  bool connected = false;           // Every Room is reachable from spawn 1
+  bool perfect = false;             // Connected, with exactly one path
+                                    // between any two Rooms
+  bool exit_reachable = false;      // The exit is set and reachable
+  bool treasure_reachable = false;  // The Treasure is set and reachable
+                                    // from both spawns
+
+  // This method returns true if every check passed.
+  bool Valid() const
+  {
+    return perfect && exit_reachable && treasure_reachable;
+  }
+};
+
+// The outcome of one Labyrinth. Times are in nanoseconds.
+struct PipelineResult
+{
+  std::uint64_t seed = 0;
+  MazeValidation validation;
+  std::string path;   // Empty if the Labyrinth was not saved
+  std::string error;  // The message of the exception which stopped the
+                      // Labyrinth from being made, if any
+  std::uint64_t generate_time = 0;
+  std::uint64_t validate_time = 0;
+  std::uint64_t write_time = 0;
+};
+
+// Each Labyrinth depends only on its seed, so the same options and seeds
+// give the same Labyrinths (and files) however many workers are used and
+// whichever worker makes each one. Every worker has its own generator and
+// scratch space, and writes only its own results and files.
+class LabyrinthPipeline
+{
+  public:
+
+    // Parameterized constructor
+    // An exception is thrown if:
+    //   A size of 0 is given, or a size greater than the maximum of
+    //     LabyrinthMode::kLarge (domain_error)
+    explicit LabyrinthPipeline( const PipelineOptions& options );
+
+    // This method makes a Labyrinth for each seed, in parallel, and returns
+    // their results in the order of the seeds. A Labyrinth which cannot be
+    // generated or saved is reported in PipelineResult::error rather than
+    // thrown.
+    std::vector<PipelineResult> Run( const std::vector<std::uint64_t>& seeds );
+
+    // This method returns the options of the pipeline.
+    const PipelineOptions& Options() const;
+
+    // This method checks a Labyrinth.
+    static MazeValidation Validate( const Labyrinth& l );
+
+  private:
+
+    // Everything used by one worker.
+    struct Worker
+    {
+      explicit Worker( const GeneratorOptions& options );
+
+      LabyrinthGenerator generator;
+      std::vector<std::uint32_t> queue;
+      std::vector<std::uint8_t> seen;
+    };
+
+    PipelineOptions options_;
+    WorkStealingPool pool_;
+    std::vector< std::unique_ptr<Worker> > workers_;
+
+    // This private method makes the Labyrinth of one seed.
+    void Produce( Worker& w, PipelineResult& result ) const;
+
+    // This private method checks a Labyrinth with the given scratch space.
+    static MazeValidation Validate( const Labyrinth& l,
+                                    std::vector<std::uint32_t>& queue,
+                                    std::vector<std::uint8_t>& seen );
+
+    // This private method marks every Room reachable from spawn 1 in
+    // seen, returns how many there are, and adds the number of connections
+    // of each of them to degrees.
+    static size_t Flood( const Labyrinth& l,
+                         std::vector<std::uint32_t>& queue,
+                         std::vector<std::uint8_t>& seen,
+                         size_t& degrees );
+};
@@ -0,0 +1,103 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ header file contains the LabyrinthQuery class, which answers
+ * questions about every Room of a Labyrinth at once by scanning its packed
+ * Rooms, and the RoomBitset class, which holds the Rooms found.
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "room_properties.hpp"
+#include "coordinate.hpp"
+#include "labyrinth.hpp"
+
+// One bit per Room of a Labyrinth. Each row starts on a new 64-bit word so
+// that rows can be scanned independently.
+class RoomBitset
+{
+  public:
+
+    // Parameterized constructor
+    // Every bit is cleared.
+    RoomBitset( const size_t x_size, const size_t y_size );
+
+    // These methods return the size of the Labyrinth which was scanned.
+    size_t XSize() const;
+    size_t YSize() const;
+
+    // This method returns true if the bit of the Room is set.
+    // An exception is thrown if:
+    //   The Room is outside the bitset (domain_error)
+    bool Test( const Coordinate rm ) const;
+
+    // This method returns the number of bits which are set.
+    size_t Count() const;
+
+    // This method returns the Rooms whose bits are set, in row-major order.
+    std::vector<Coordinate> Coordinates() const;
+
+    // These methods return the words of a row (bit x % 64 of word x / 64 is
+    // Room x), and the number of words in each row. The row is not checked.
+    const std::uint64_t* RowWords( const size_t y ) const;
+    size_t WordsPerRow() const;
+
+  private:
+
+    size_t x_size_;
+    size_t y_size_;
+    size_t words_per_row_;
+    std::vector<std::uint64_t> words_;
+
+    friend class LabyrinthQuery;
+};
+
+// Every query reads each row of the Labyrinth once, 64 Rooms at a time,
+// with AVX2 or SSE2 when the compiler targets them (e.g. -mavx2 or
+// -march=native) and plain C++ otherwise; the results are the same.
+// Mapped and shared Rooms are read in place.
+class LabyrinthQuery
+{
+  public:
+
+    // These methods return the number of Rooms with the Inhabitant or Item.
+    static size_t CountInhabitants( const Labyrinth& l,
+                                    const Inhabitant inh );
+    static size_t CountItems( const Labyrinth& l, const Item itm );
+
+    // These methods return the Rooms with the Inhabitant or Item (e.g.
+    // Item::kTreasure for the only Room with the Treasure, if any).
+    static RoomBitset FindInhabitants( const Labyrinth& l,
+                                       const Inhabitant inh );
+    static RoomBitset FindItems( const Labyrinth& l, const Item itm );
+
+    // This method returns the Rooms with a Wall in exactly three
+    // Directions (the exit is not a Wall).
+    static RoomBitset DeadEnds( const Labyrinth& l );
+
+    // This method returns the number of Rooms connected to 0 to 4 other
+    // Rooms (the exit does not lead to a Room).
+    static std::array<size_t, 5> DegreeHistogram( const Labyrinth& l );
+
+    // This method returns the instruction set which the scans were
+    // compiled for: "AVX2", "SSE2" or "scalar".
+    static const char* InstructionSet();
+
+  private:
+
+    // This private method finds the Rooms whose packed encoding, masked,
+    // equals any of the values, and returns how many there are. The Rooms
+    // are only stored if found is not null.
+    static size_t Scan( const Labyrinth& l,
+                        const std::uint16_t mask,
+                        const std::uint16_t* const values,
+                        const size_t count,
+                        RoomBitset* const found );
+};
@@ -0,0 +1,122 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ header file contains the LabyrinthSolver class, which finds
+ * shortest paths between Rooms of a Labyrinth.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "coordinate.hpp"
+#include "labyrinth.hpp"
+#include "labyrinth_graph.hpp"
+
+enum class SolverAlgorithm
+{
+  kBreadthFirst,
+  kAStar,
+  kBidirectional,
+};
+
+// Routes between the special Rooms of a Labyrinth.
+enum class SolverRoute
+{
+  kSpawn1ToTreasure,
+  kSpawn2ToTreasure,
+  kTreasureToExit,
+  kSpawn1ToExit,
+  kSpawn2ToExit,
+};
+
+// Paths only move between connected Rooms; the exit is not a Room.
+// Every algorithm returns a shortest path, although different algorithms
+// may return different paths of the same length.
+//
+// Searches walk the adjacency lists of a LabyrinthGraph, which is rebuilt
+// by the first query after Rooms are connected. Scratch buffers are
+// allocated once per Labyrinth size and reused, so repeated queries do not
+// allocate (other than growing the caller's path).
+// Visited Rooms are marked with a query number rather than cleared, so a
+// query only touches the Rooms it explores.
+//
+// l_ does not use a smart pointer because it is simply a pointer to the
+// related Labyrinth, not a heap allocation.
+class LabyrinthSolver
+{
+  public:
+
+    // Parameterized constructor
+    // An exception is thrown if:
+    //   l is null (invalid_argument)
+    //   The Labyrinth has too many Rooms to be numbered in 32 bits
+    //     (length_error)
+    LabyrinthSolver( const Labyrinth* const l );
+
+    // This method finds a shortest path between the given Rooms, and stores
+    // it in path (the Rooms from start to goal, inclusive).
+    // Returns true if a path was found, and false (with an empty path)
+    // otherwise.
+    // An exception is thrown if:
+    //   One or both Rooms are outside the Labyrinth (domain_error)
+    bool FindPath( const Coordinate start,
+                   const Coordinate goal,
+                   std::vector<Coordinate>& path,
+                   const SolverAlgorithm a = SolverAlgorithm::kBreadthFirst );
+
+    // This method finds a shortest path along the given route.
+    // Returns true if a path was found, and false otherwise.
+    // An exception is thrown if:
+    //   The route uses the Treasure, which is not in a Room (logic_error)
+    //   The route uses the exit, which has not been set (logic_error)
+    bool FindRoute( const SolverRoute r,
+                    std::vector<Coordinate>& path,
+                    const SolverAlgorithm a = SolverAlgorithm::kBreadthFirst );
+
+    // This method returns the number of steps between the given Rooms, or
+    // kUnreachable if there is no path.
+    // An exception is thrown if:
+    //   One or both Rooms are outside the Labyrinth (domain_error)
+    size_t Distance( const Coordinate start, const Coordinate goal );
+
+    // Returned by Distance() when there is no path.
+    static constexpr size_t kUnreachable = static_cast<size_t>( -1 );
+
+  private:
+
+    const Labyrinth* const l_;
+    LabyrinthGraph graph_;
+
+    // Scratch buffers, indexed by Room (y * x size + x)
+    std::vector<std::uint32_t> seen_;       // Query number of last visit
+    std::vector<std::uint32_t> seen_back_;  // Same, from the goal side
+    std::vector<std::uint32_t> parent_;
+    std::vector<std::uint32_t> parent_back_;
+    std::vector<std::uint32_t> cost_;       // Steps from the start
+    std::vector<std::uint32_t> cost_back_;  // Steps from the goal
+    std::vector<std::uint32_t> queue_;
+    std::vector<std::uint32_t> queue_back_;
+    std::vector<std::uint64_t> heap_;
+    std::uint32_t query_ = 0;
+
+    // This private method starts a new query, refreshing the graph,
+    // resizing the scratch buffers if the Labyrinth is new and resetting
+    // them if the query number wraps.
+    void BeginQuery();
+
+    // These private methods search from start to goal, leaving parent_ set
+    // along the path. They return true if goal was reached.
+    bool BreadthFirst( const std::uint32_t start, const std::uint32_t goal );
+    bool AStar( const std::uint32_t start, const std::uint32_t goal );
+
+    // This private method searches from both ends, and returns the Room
+    // where the searches met through meet.
+    bool Bidirectional( const std::uint32_t start,
+                        const std::uint32_t goal,
+                        std::uint32_t& meet );
+};
@@ -0,0 +1,132 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ header file contains the LabyrinthStreamGenerator class, which
+ * generates a maze row by row into a RoomRowSink without ever holding the
+ * whole maze in memory.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+#include "room_properties.hpp"
+#include "room.hpp"
+#include "coordinate.hpp"
+#include "eller_row_generator.hpp"
+#include "labyrinth_generator.hpp"
+
+// This struct describes a streamed maze. It is decided before the first row
+// is generated so that a sink can write it out ahead of the Rooms.
+struct LabyrinthStreamInfo
+{
+  size_t x_size = 0;
+  size_t y_size = 0;
+
+  Coordinate spawn_1;
+  Coordinate spawn_2;
+
+  bool exit_set = false;
+  Coordinate exit;
+  Direction exit_direction = Direction::kNone;
+
+  bool treasure_set = false;
+  Coordinate treasure;
+};
+
+// This class is a template for receivers of a streamed maze.
+// Rows are given in order, as bands of one or more complete rows.
+class RoomRowSink
+{
+  public:
+
+    // Destructor
+    // Prevents error messages about non-virtual destructors
+    virtual ~RoomRowSink()
+    {
+    }
+
+    // This method is called once, before any rows.
+    virtual void Begin( const LabyrinthStreamInfo& info ) = 0;
+
+    // This method is called with rows [y, y + rows) of the maze, stored
+    // row-major with info.x_size Rooms per row.
+    // The Rooms are only valid until the method returns.
+    virtual void Rows( const size_t y,
+                       const Room* const rooms,
+                       const size_t rows ) = 0;
+
+    // This method is called once, after the last row.
+    virtual void End()
+    {
+    }
+};
+
+// The maze is generated with Eller's algorithm; GeneratorOptions::algorithm
+// is ignored. Memory use is proportional to x_size * band_rows plus the
+// number of Items and Inhabitants, even for mazes too large to fit in memory.
+class LabyrinthStreamGenerator
+{
+  public:
+
+    // Parameterized constructor
+    // An exception is thrown if:
+    //   band_rows is 0 (invalid_argument)
+    LabyrinthStreamGenerator( const GeneratorOptions& options,
+                              const size_t band_rows = 1 );
+
+    // This method generates a maze of the given size into the sink.
+    // The same options, seed and size always generate the same maze.
+    // An exception is thrown if:
+    //   A size of 0 is given (domain_error)
+    //   There are more Items or Inhabitants than Rooms (invalid_argument)
+    void Generate( const size_t x_size,
+                   const size_t y_size,
+                   RoomRowSink& sink );
+
+    // This method changes the seed used by the next call to Generate().
+    void SetSeed( const std::uint64_t seed );
+
+  private:
+
+    // A single Item or Inhabitant, placed when its row is generated.
+    struct Placement
+    {
+      size_t index;
+      bool is_item;
+      Item itm;
+      Inhabitant inh;
+
+      // Operator overload for <, ordering Placements by Room index
+      bool operator<( const Placement& p ) const
+      {
+        return index < p.index;
+      }
+    };
+
+    GeneratorOptions options_;
+    const size_t band_rows_;
+    std::mt19937_64 rng_;
+    EllerRowGenerator eller_;
+    std::vector<Room> band_;
+    std::vector<Placement> placements_;
+
+    // This private method returns a random number in [0, n).
+    size_t RandomBelow( const size_t n );
+
+    // This private method decides the spawns, exit and placements.
+    LabyrinthStreamInfo Plan( const size_t x_size, const size_t y_size );
+
+    // This private method adds count Placements of the given kind in
+    // distinct random Rooms which are not yet taken, and marks them taken.
+    void AddPlacements( const size_t count,
+                        const size_t rooms,
+                        const Placement& kind,
+                        std::unordered_set<size_t>& taken );
+};
@@ -0,0 +1,95 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ header file contains the LabyrinthVisibility class, which keeps
+ * the Rooms of a Labyrinth that each Player has explored.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "coordinate.hpp"
+#include "turn_engine.hpp"
+
+// One bit per Room for each Player, set once the Player has been in the
+// Room. The bits of a Player are row-major and start on a new 64-bit word,
+// so a Player of a 20 x 20 Labyrinth takes 7 words, and Players never share
+// a word: different threads may reveal Rooms for different Players at the
+// same time.
+//
+// A LabyrinthMap renders only the explored Rooms of a Player from these
+// bits (see LabyrinthMap::Render()); the Labyrinth is not read for Rooms
+// which are not revealed.
+class LabyrinthVisibility
+{
+  public:
+
+    // Parameterized constructor
+    // No Room is revealed.
+    // An exception is thrown if:
+    //   A size of 0 is given (domain_error)
+    LabyrinthVisibility( const size_t x_size,
+                         const size_t y_size,
+                         const size_t players );
+
+    // These methods return the sizes of the Labyrinth and the number of
+    // Players.
+    size_t XSize() const;
+    size_t YSize() const;
+    size_t Players() const;
+
+    // This method reveals a Room to a Player, and returns true if it had not
+    // been revealed before.
+    // An exception is thrown if:
+    //   The Player does not exist (invalid_argument)
+    //   The Room is outside the Labyrinth (domain_error)
+    bool Reveal( const size_t player, const Coordinate rm );
+
+    // This method reveals the Rooms which Players entered in a batch of
+    // TurnEngine events (TurnEventKind::kMoved and kRespawned), and returns
+    // the number of Rooms which had not been revealed before.
+    // An exception is thrown if:
+    //   An event is of a Player which does not exist (invalid_argument)
+    //   An event is outside the Labyrinth (domain_error)
+    size_t Reveal( const std::vector<TurnEvent>& events );
+
+    // This method returns true if the Room has been revealed to the Player.
+    // An exception is thrown if:
+    //   The Player does not exist (invalid_argument)
+    //   The Room is outside the Labyrinth (domain_error)
+    bool Revealed( const size_t player, const Coordinate rm ) const;
+
+    // This method returns true if the Room has been revealed to the Player,
+    // without checking either of them.
+    bool RevealedUnchecked( const size_t player,
+                            const Coordinate rm ) const noexcept;
+
+    // This method returns the number of Rooms revealed to the Player.
+    // An exception is thrown if:
+    //   The Player does not exist (invalid_argument)
+    size_t RevealedCount( const size_t player ) const;
+
+    // This method hides every Room from the Player again.
+    // An exception is thrown if:
+    //   The Player does not exist (invalid_argument)
+    void Clear( const size_t player );
+
+  private:
+
+    size_t x_size_;
+    size_t y_size_;
+    size_t players_;
+    size_t words_per_player_;
+    std::vector<std::uint64_t> words_;
+
+    // This private method throws if the Player or Room does not exist.
+    void Check( const char* const method,
+                const size_t player,
+                const Coordinate rm ) const;
+    void Check( const char* const method, const size_t player ) const;
+};
@@ -0,0 +1,81 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ header file contains the Player class, which is a description of
+ * the inventory, location, and status of a player (see
+ * GameInstructions.md).
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "coordinate.hpp"
+
+enum class PlayerStatus : std::uint8_t
+{
+  kPlaying,
+  kWon,   // Reached the exit with the Treasure
+  kLost,  // Killed with no extra lives left
+};
+
+class Player
+{
+  public:
+
+    // Parameterized constructor
+    Player( const Coordinate location,
+            const unsigned bullets,
+            const unsigned extra_lives );
+
+    // These methods return and set the Room which the player is in.
+    Coordinate Location() const;
+    void SetLocation( const Coordinate rm );
+
+    // This method returns the number of bullets the player holds.
+    unsigned Bullets() const;
+
+    // This method gives the player another bullet.
+    void AddBullet();
+
+    // This method takes a bullet from the player.
+    // An exception is thrown if:
+    //   The player has no bullets (logic_error)
+    void UseBullet();
+
+    // This method returns the number of extra lives the player has left.
+    unsigned ExtraLives() const;
+
+    // This method takes an extra life from the player.
+    // An exception is thrown if:
+    //   The player has no extra lives (logic_error)
+    void UseExtraLife();
+
+    // This method returns true if the player holds the Treasure.
+    bool HasTreasure() const;
+
+    // This method gives the Treasure to the player.
+    // An exception is thrown if:
+    //   The player already holds the Treasure (logic_error)
+    void TakeTreasure();
+
+    // This method takes the Treasure from the player.
+    // An exception is thrown if:
+    //   The player does not hold the Treasure (logic_error)
+    void DropTreasure();
+
+    // These methods return and set whether the player is still playing.
+    PlayerStatus Status() const;
+    void SetStatus( const PlayerStatus s );
+
+  private:
+
+    Coordinate location_;
+    unsigned bullets_;
+    unsigned extra_lives_;
+    bool treasure_ = false;
+    PlayerStatus status_ = PlayerStatus::kPlaying;
+};
@@ -1,7 +1,7 @@
 /*
  *
  * Author: Jeffrey Leung
- * Last edited: 2016-01-25
+ * Last edited: 2026-10-14
  *
  * This C++ header file contains implementations of a Room class, which is a
  * template to create a Labyrinth.
@@ -10,8 +10,16 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include "room_properties.hpp"
 
+// A Room is packed into a single 16-bit word:
+//   Bits 0-3:   Wall mask (north, east, south, west); a set bit is a Wall
+//   Bits 4-6:   Exit Direction
+//   Bits 7-9:   Inhabitant
+//   Bits 10-12: Item
+//   Bits 13-15: Unused (always 0)
 class Room
 {
   public:
@@ -49,6 +57,16 @@ class Room
     //   The Wall has already been removed (logic_error)
     void BreakWall( const Direction d );
 
+    // This method removes the Wall in the given direction without checking
+    // whether it has already been removed. Direction::kNone is ignored.
+    // Intended for generators which have already validated the layout.
+    void ClearWall( const Direction d );
+
+    // This method removes every Wall given by the mask, which uses the
+    // layout of kWallMask (bit 0 north, 1 east, 2 south, 3 west), without
+    // checking whether it has already been removed. Other bits are ignored.
+    void ClearWalls( const std::uint8_t mask );
+
     // This method creates an exit in the given direction. The Wall
     // should be intact (BreakWall() not called on it beforehand).
     // An exception is thrown if:
@@ -57,18 +75,50 @@ class Room
     //   The Exit has already been created (logic_error)
     void CreateExit( const Direction d );
 
+    // This method creates an exit in the given direction without checking.
+    // Direction d must not be kNone, its Wall must be intact, and the Room
+    // must not already have an exit.
+    void CreateExitUnchecked( const Direction d ) noexcept;
+
     // This method returns the type of RoomBorder in the given direction.
     // An exception is thrown if:
     //   Direction d is kNone (invalid_argument)
     RoomBorder DirectionCheck( const Direction d ) const;
 
+    // This method returns the type of RoomBorder in the given direction
+    // without checking it. Direction d must not be kNone.
+    RoomBorder DirectionCheckUnchecked( const Direction d ) const noexcept;
+
+    // This method returns a mask of the Directions which lead to another
+    // Room (not a Wall or the exit), in the layout of kWallMask.
+    std::uint8_t OpenMask() const;
+
+    // This method returns the packed 16-bit encoding of the Room.
+    std::uint16_t Packed() const;
+
+    // This method returns the Room with the given packed 16-bit encoding,
+    // as returned by Packed(). Unused bits are cleared.
+    static Room FromPacked( const std::uint16_t packed );
+
+    // Layout of the packed encoding.
+    static constexpr std::uint16_t kWallMask       = 0x000F;
+    static constexpr unsigned      kExitShift       = 4;
+    static constexpr std::uint16_t kExitMask       = 0x0070;
+    static constexpr unsigned      kInhabitantShift = 7;
+    static constexpr std::uint16_t kInhabitantMask = 0x0380;
+    static constexpr unsigned      kItemShift       = 10;
+    static constexpr std::uint16_t kItemMask       = 0x1C00;
+
   private:
+
+    // This private method returns the bit of the Wall mask for the given
+    // Direction, or 0 for Direction::kNone.
+    static std::uint16_t WallBit( const Direction d ) noexcept;
+
     // The exit direction does not count as a wall.
-    Inhabitant dark_thing_ = Inhabitant::kNone;
-    Item object_ = Item::kNone;
-    Direction exit_  = Direction::kNone;
-    bool wall_north_ = true;
-    bool wall_east_  = true;
-    bool wall_south_ = true;
-    bool wall_west_  = true;
+    // Default: all four Walls, no exit, Inhabitant::kNone and Item::kNone.
+    std::uint16_t bits_ = kWallMask;
 };
+
+static_assert( sizeof(Room) == sizeof(std::uint16_t),
+               "Room must stay packed into a single 16-bit word." );
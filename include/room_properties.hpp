@@ -1,7 +1,7 @@
 /*
  *
  * Author: Jeffrey Leung
- * Last edited: 2015-09-17
+ * Last edited: 2026-10-14
  *
  * This header file contains enums necessary to create and navigate a Room.
  *
@@ -9,7 +9,12 @@
 
 #pragma once
 
-enum class Direction
+#include <cstdint>
+
+// Each enum is a single byte so that it may be stored compactly; Room packs
+// them further into a single word.
+
+enum class Direction : std::uint8_t
 {
   kNone,
   kNorth,
@@ -18,14 +23,14 @@ enum class Direction
   kWest,
 };
 
-enum class RoomBorder
+enum class RoomBorder : std::uint8_t
 {
   kWall,
   kRoom,
   kExit,
 };
 
-enum class Inhabitant
+enum class Inhabitant : std::uint8_t
 {
   kNone,
   kMinotaur,
@@ -34,7 +39,7 @@ enum class Inhabitant
   kMirrorCracked,
 };
 
-enum class Item
+enum class Item : std::uint8_t
 {
   kNone,
   kBullet,
@@ -0,0 +1,55 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ header file contains the implementation of a RoomRow struct, a
+ * read-only view of a single row of Rooms in a Labyrinth.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include "room.hpp"
+
+// A RoomRow does not own its Rooms; it is only valid while the Labyrinth
+// which created it is alive and has not been resized.
+struct RoomRow
+{
+  const Room* first;
+  size_t length;
+
+  // Parameterized constructor
+  RoomRow( const Room* const first_room, const size_t row_length )
+  {
+    first = first_room;
+    length = row_length;
+  }
+
+  // This method returns a pointer to the first Room of the row.
+  const Room* begin() const
+  {
+    return first;
+  }
+
+  // This method returns a pointer past the last Room of the row.
+  const Room* end() const
+  {
+    return first + length;
+  }
+
+  // This method returns the number of Rooms in the row.
+  size_t size() const
+  {
+    return length;
+  }
+
+  // Operator overload for []
+  // The index is not checked against the length of the row.
+  const Room& operator[]( const size_t x ) const
+  {
+    return first[x];
+  }
+};
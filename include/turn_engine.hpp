@@ -0,0 +1,171 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ header file contains the TurnEngine class, which plays batches
+ * of GameMoves for the Players of a Labyrinth according to
+ * GameInstructions.md, and reports what happened as compact TurnEvents.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "coordinate.hpp"
+#include "labyrinth.hpp"
+#include "player.hpp"
+#include "game_host.hpp"
+
+// What happened to a Player during a move.
+enum class TurnEventKind : std::uint8_t
+{
+  kRejected,         // The move was invalid or the Player is not playing
+  kStayed,           // Direction::kNone
+  kBlocked,          // A Wall is in the way
+  kExitLocked,       // The exit cannot be used without the Treasure
+  kMoved,            // The Player entered another Room
+  kEscaped,          // The Player left through the exit with the Treasure
+  kTookBullet,
+  kTookTreasure,
+  kShotMinotaur,
+  kCrackedMirror,    // The bullet was wasted on a Mirror
+  kMisfired,         // The Player chose to shoot with no bullets
+  kKilled,           // Killed by a Minotaur which was not shot
+  kDroppedTreasure,  // Dropped in the Room the Player was killed from
+  kRespawned,        // An extra life was used to respawn in spawn 2
+  kLost,             // Killed with no extra lives left
+};
+
+// A single event of a batch. The Room is where the event happened; every
+// Coordinate of a Labyrinth fits in 16 bits.
+struct TurnEvent
+{
+  std::uint32_t player;
+  std::uint16_t x;
+  std::uint16_t y;
+  TurnEventKind kind;
+};
+
+// The inventory which every Player starts with.
+struct TurnRules
+{
+  unsigned bullets = 1;
+  unsigned extra_lives = 1;
+};
+
+// Counters of a TurnEngine since it was created. Times are in nanoseconds.
+struct TurnEngineStats
+{
+  std::uint64_t batches = 0;
+  std::uint64_t moves = 0;
+  std::uint64_t rejected = 0;
+  std::uint64_t events = 0;
+  std::uint64_t resolve_time = 0;
+};
+
+// The moves of a batch are validated together before any is played, and
+// are then played in order against the Labyrinth without further checks.
+// A Player which enters a Room takes its Item automatically. A Player
+// which is killed while holding the Treasure drops it in the Room they
+// were in, which is empty because its Item was taken when they entered.
+class TurnEngine
+{
+  public:
+
+    // Parameterized constructor
+    // Every Player is placed in the primary spawn of the Labyrinth, and the
+    // first takes the Item there (if any).
+    // An exception is thrown if:
+    //   players is 0, or too many to be numbered by GameMove (invalid_argument)
+    TurnEngine( Labyrinth& l,
+                const size_t players,
+                const TurnRules& rules = TurnRules() );
+
+    // This method plays a batch of moves and replaces the contents of
+    // events with what happened, in order. Moves by unknown Players, with
+    // invalid Directions, or by Players who are no longer playing are
+    // reported as TurnEventKind::kRejected and otherwise ignored.
+    // l must be the Labyrinth which the engine was created with (or a
+    // Clone() of it, or the Labyrinth it was moved into).
+    // An exception is thrown if:
+    //   l is not the same size as the Labyrinth which the engine was
+    //     created with (invalid_argument)
+    void Resolve( Labyrinth& l,
+                  const std::vector<GameMove>& moves,
+                  std::vector<TurnEvent>& events );
+    void Resolve( Labyrinth& l,
+                  const GameMove* const moves,
+                  const size_t count,
+                  std::vector<TurnEvent>& events );
+
+    // This method returns the number of Players.
+    size_t Players() const;
+
+    // This method returns a Player.
+    // An exception is thrown if:
+    //   The Player does not exist (invalid_argument)
+    const Player& PlayerAt( const size_t player ) const;
+
+    // This method returns the counters of the engine.
+    TurnEngineStats Stats() const;
+
+    // This method returns the number of moves resolved per second of time
+    // spent in Resolve(), or 0 if none have been.
+    double MovesPerSecond() const;
+
+  private:
+
+    std::vector<Player> players_;
+    size_t x_size_;
+    size_t y_size_;
+    Coordinate spawn_2_;
+    std::vector<std::uint8_t> valid_;  // Reused by every batch
+    TurnEngineStats stats_;
+
+    // This private method plays a validated move.
+    void Play( Labyrinth& l,
+               const GameMove& m,
+               std::vector<TurnEvent>& events );
+
+    // This private method kills a Player who did not shoot the Minotaur in
+    // the Room they tried to enter.
+    void Kill( Labyrinth& l,
+               const std::uint32_t id,
+               const Coordinate minotaur,
+               std::vector<TurnEvent>& events );
+
+    // This private method makes a Player take the Item in their Room.
+    void TakeItem( Labyrinth& l,
+                   const std::uint32_t id,
+                   std::vector<TurnEvent>& events );
+};
+
+// This class plays the turns of a GameHost session with a TurnEngine, and
+// keeps the events of the last turn.
+class TurnEngineHandler : public GameSessionHandler
+{
+  public:
+
+    // Parameterized constructor
+    // The handler must be created before the Labyrinth is moved into the
+    // session (see the TurnEngine constructor).
+    TurnEngineHandler( Labyrinth& l,
+                       const size_t players,
+                       const TurnRules& rules = TurnRules() );
+
+    // This method resolves the moves of a turn.
+    void Turn( Labyrinth& l, const std::vector<GameMove>& moves );
+
+    // These methods return the engine and the events of the last turn.
+    // They must not be called during a tick of the GameHost.
+    const TurnEngine& Engine() const;
+    const std::vector<TurnEvent>& Events() const;
+
+  private:
+
+    TurnEngine engine_;
+    std::vector<TurnEvent> events_;
+};
@@ -0,0 +1,100 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ header file contains the WorkStealingPool class, which runs
+ * tasks on a fixed set of worker threads. Each worker has its own queue,
+ * and idle workers steal tasks from the queues of busy ones.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Tasks are given the index of the worker which runs them, so that they can
+// use per-worker scratch space or counters without locking.
+//
+// There is no lock shared by every queue: submitting a task only locks the
+// queue of its worker, and the pool-wide lock is only taken to wake
+// sleeping workers.
+class WorkStealingPool
+{
+  public:
+
+    // A task, given the index of the worker which runs it.
+    using Task = std::function<void( const size_t worker )>;
+
+    // Parameterized constructor
+    // 0 workers uses one worker per hardware thread.
+    explicit WorkStealingPool( const size_t workers = 0 );
+
+    // Destructor
+    // Waits for the queued tasks to finish, then stops the workers.
+    ~WorkStealingPool();
+
+    WorkStealingPool( const WorkStealingPool& ) = delete;
+    WorkStealingPool& operator=( const WorkStealingPool& ) = delete;
+
+    // This method returns the number of worker threads.
+    size_t Workers() const;
+
+    // This method queues a task on the given worker (modulo the number of
+    // workers), which runs its own tasks newest first. Other workers steal
+    // the oldest tasks once they have none of their own.
+    // It may be called from any thread, including from within a task.
+    void Submit( Task task, const size_t worker );
+
+    // This method blocks until every submitted task has finished.
+    // It must not be called from within a task.
+    // An exception is thrown if:
+    //   A task threw an exception; the first one is thrown again, after
+    //     every task has finished
+    void Wait();
+
+    // This method returns the number of tasks which have been stolen.
+    std::uint64_t Steals() const;
+
+  private:
+
+    // A worker's queue, allocated separately so that queues do not share
+    // cache lines.
+    struct Queue
+    {
+      std::mutex mutex;
+      std::deque<Task> tasks;
+    };
+
+    std::vector< std::unique_ptr<Queue> > queues_;
+    std::vector<std::thread> threads_;
+
+    std::atomic<size_t> queued_;    // Tasks waiting in a queue
+    std::atomic<size_t> unfinished_;  // Tasks queued or running
+    std::atomic<size_t> sleeping_;  // Workers waiting for tasks
+    std::atomic<std::uint64_t> steals_;
+    bool stop_ = false;             // Guarded by sleep_mutex_
+
+    std::mutex sleep_mutex_;
+    std::condition_variable wake_;
+    std::mutex done_mutex_;
+    std::condition_variable done_;
+    std::exception_ptr error_;      // Guarded by done_mutex_
+
+    // This private method is run by each worker thread.
+    void Work( const size_t worker );
+
+    // This private method takes a task for the given worker from its own
+    // queue or, failing that, from another queue. Returns false if there
+    // are none.
+    bool Take( const size_t worker, Task& task );
+};
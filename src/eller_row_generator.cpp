@@ -0,0 +1,180 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ file contains the implementation of the EllerRowGenerator class,
+ * which generates a perfect maze one row at a time with Eller's algorithm.
+ *
+ */
+
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "../include/eller_row_generator.hpp"
+
+namespace
+{
+
+const std::uint8_t kOpenNorth = 0x1;
+const std::uint8_t kOpenEast  = 0x2;
+const std::uint8_t kOpenSouth = 0x4;
+const std::uint8_t kOpenWest  = 0x8;
+
+// Marks a set which already carves south; never returned.
+const std::uint8_t kSetCarved = 0x80;
+
+}  // Local namespace
+
+// This method starts a new maze of the given size.
+// An exception is thrown if:
+//   A size of 0 is given (domain_error)
+void EllerRowGenerator::Reset( const size_t x_size, const size_t y_size )
+{
+  if( x_size == 0 || y_size == 0 )
+  {
+    throw std::domain_error( "Error: Reset() was given an empty size.\n" );
+  }
+
+  x_size_ = x_size;
+  y_size_ = y_size;
+  y_ = 0;
+
+  parent_.resize( x_size );
+  root_.resize( x_size );
+  first_.resize( x_size );
+  current_.assign( x_size, 0 );
+  next_.assign( x_size, 0 );
+  for( size_t x = 0; x < x_size; ++x )
+  {
+    parent_[x] = x;
+  }
+}
+
+// This method returns true if every row has been generated.
+bool EllerRowGenerator::Done() const
+{
+  return y_ >= y_size_;
+}
+
+// This method returns the y-coordinate of the next row to be generated.
+size_t EllerRowGenerator::NextY() const
+{
+  return y_;
+}
+
+// This method generates the next row and returns its removed Walls.
+// The returned array holds x_size bytes and is valid until the next call.
+// An exception is thrown if:
+//   Every row has already been generated (logic_error)
+const std::uint8_t* EllerRowGenerator::NextRow( std::mt19937_64& rng )
+{
+  if( Done() )
+  {
+    throw std::logic_error( "Error: NextRow() was called after every row "\
+      "was generated.\n" );
+  }
+
+  const size_t kNoColumn = x_size_;
+  const bool last_row = (y_ + 1 == y_size_);
+
+  // The previous call left the north openings of this row in next_.
+  current_.swap( next_ );
+  for( size_t x = 0; x < x_size_; ++x )
+  {
+    next_[x] = 0;
+  }
+
+  // Randomly joins adjacent sets; the last row joins every set.
+  for( size_t x = 0; x + 1 < x_size_; ++x )
+  {
+    const size_t root_a = FindRoot( x );
+    const size_t root_b = FindRoot( x + 1 );
+    if( root_a != root_b && (last_row || (rng() & 1)) )
+    {
+      parent_[root_b] = root_a;
+      current_[x]     |= kOpenEast;
+      current_[x + 1] |= kOpenWest;
+    }
+  }
+
+  if( !last_row )
+  {
+    // Randomly carves south, and at least once for every set.
+    for( size_t x = 0; x < x_size_; ++x )
+    {
+      root_[x] = FindRoot( x );
+      first_[root_[x]] = x;
+      if( rng() & 1 )
+      {
+        current_[x] |= kOpenSouth;
+      }
+    }
+    for( size_t x = 0; x < x_size_; ++x )
+    {
+      if( current_[x] & kOpenSouth )
+      {
+        next_[root_[x]] |= kSetCarved;
+      }
+    }
+    for( size_t x = 0; x < x_size_; ++x )
+    {
+      const size_t root = root_[x];
+      if( first_[root] == x && !(next_[root] & kSetCarved) )
+      {
+        current_[x] |= kOpenSouth;
+      }
+    }
+
+    // Carries the sets over to the next row.
+    for( size_t x = 0; x < x_size_; ++x )
+    {
+      next_[x] = 0;
+      first_[x] = kNoColumn;
+    }
+    for( size_t x = 0; x < x_size_; ++x )
+    {
+      if( current_[x] & kOpenSouth )
+      {
+        next_[x] = kOpenNorth;
+        const size_t root = root_[x];
+        if( first_[root] == kNoColumn )
+        {
+          first_[root] = x;
+        }
+        parent_[x] = first_[root];
+      }
+      else
+      {
+        parent_[x] = x;
+      }
+    }
+  }
+
+  ++y_;
+  return current_.data();
+}
+
+// This method returns the number of bytes of scratch space in use.
+size_t EllerRowGenerator::ScratchBytes() const
+{
+  return ( parent_.capacity() + root_.capacity() + first_.capacity() ) *
+           sizeof(size_t) +
+         current_.capacity() + next_.capacity();
+}
+
+// PRIVATE METHODS:
+
+// This private method returns the union-find root of column x, halving
+// paths along the way.
+size_t EllerRowGenerator::FindRoot( size_t x )
+{
+  while( parent_[x] != x )
+  {
+    parent_[x] = parent_[parent_[x]];
+    x = parent_[x];
+  }
+  return x;
+}
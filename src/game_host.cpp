@@ -0,0 +1,290 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ file contains the implementation of the GameHost class, which
+ * owns many game sessions, each with its own Labyrinth, and plays their
+ * turns on a WorkStealingPool.
+ *
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/work_stealing_pool.hpp"
+#include "../include/game_host.hpp"
+
+namespace
+{
+
+// This local function returns the nanoseconds since the given time.
+std::uint64_t NanosecondsSince(
+  const std::chrono::steady_clock::time_point start );
+
+// This local function returns the nanoseconds since the given time.
+std::uint64_t NanosecondsSince(
+  const std::chrono::steady_clock::time_point start )
+{
+  return static_cast<std::uint64_t>(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - start ).count() );
+}
+
+}  // Local namespace
+
+constexpr size_t GameHost::kBlockSessions;
+constexpr size_t GameHost::kMaxSessions;
+
+// Parameterized constructor
+// 0 workers uses one worker per hardware thread.
+GameHost::GameHost( const size_t workers ) :
+  pool_(workers),
+  blocks_(std::make_unique< std::unique_ptr<GameSession[]>[] >(
+    kMaxSessions / kBlockSessions )),
+  worker_stats_(pool_.Workers())
+{
+}
+
+// This method adds a session which plays the given Labyrinth with the
+// given handler, and returns its identifier.
+// An exception is thrown if:
+//   handler is null (invalid_argument)
+//   kMaxSessions sessions are open (length_error)
+size_t GameHost::CreateSession( Labyrinth&& l,
+                                std::unique_ptr<GameSessionHandler> handler )
+{
+  if( !handler )
+  {
+    throw std::invalid_argument( "Error: CreateSession() was given an "\
+      "invalid (null) pointer for the handler.\n" );
+  }
+
+  const bool reuse = !closed_.empty();
+  size_t id = sessions_.load( std::memory_order_relaxed );
+  if( reuse )
+  {
+    id = closed_.back();
+  }
+  else if( id == kMaxSessions )
+  {
+    throw std::length_error( "Error: CreateSession() was called when the "\
+      "maximum number of sessions were open.\n" );
+  }
+  else if( id % kBlockSessions == 0 )
+  {
+    blocks_[id / kBlockSessions] =
+      std::make_unique<GameSession[]>( kBlockSessions );
+  }
+
+  GameSession& s = blocks_[id / kBlockSessions][id % kBlockSessions];
+  s.labyrinth = std::make_unique<Labyrinth>( std::move(l) );
+  s.handler = std::move( handler );
+  s.worker = id % pool_.Workers();
+  {
+    std::lock_guard<std::mutex> lock( s.mutex );
+    s.open = true;
+  }
+
+  if( reuse )
+  {
+    closed_.pop_back();
+  }
+  else
+  {
+    // Publishes the block, and the session, to SubmitMove().
+    sessions_.store( id + 1, std::memory_order_release );
+  }
+  return id;
+}
+
+// This method removes a session, discarding its queued moves. Moves
+// submitted to it from then on throw an exception.
+// An exception is thrown if:
+//   The session does not exist (invalid_argument)
+void GameHost::CloseSession( const size_t session )
+{
+  GameSession& s = SessionAt( session, "CloseSession" );
+  {
+    std::lock_guard<std::mutex> lock( s.mutex );
+    s.open = false;
+    s.incoming.clear();
+    s.pending.store( false, std::memory_order_relaxed );
+  }
+
+  // No other thread uses the Labyrinth or handler between ticks.
+  s.labyrinth.reset();
+  s.handler.reset();
+  closed_.push_back( session );
+}
+
+// This method queues a move for the next turn of the session.
+// An exception is thrown if:
+//   The session does not exist (invalid_argument)
+void GameHost::SubmitMove( const size_t session, const GameMove& move )
+{
+  GameSession* const s = SlotAt( session );
+  if( s != nullptr )
+  {
+    std::lock_guard<std::mutex> lock( s->mutex );
+    if( s->open )
+    {
+      s->incoming.push_back( move );
+      s->pending.store( true, std::memory_order_relaxed );
+      return;
+    }
+  }
+  throw std::invalid_argument( "Error: SubmitMove() was given a session "\
+    "which does not exist.\n" );
+}
+
+// This method plays one turn of every session with queued moves, in
+// parallel, and returns the number of turns played.
+// An exception is thrown if:
+//   A handler threw an exception; the first one is thrown again, after
+//     every turn of the tick has finished
+size_t GameHost::Tick()
+{
+  const auto start = std::chrono::steady_clock::now();
+
+  // Every queue is taken before any turn is played, so that moves which
+  // arrive during the tick wait for the next one. pending is only read
+  // without the lock to skip idle sessions.
+  size_t turns = 0;
+  const size_t sessions = sessions_.load( std::memory_order_relaxed );
+  for( size_t id = 0; id < sessions; ++id )
+  {
+    GameSession& s = blocks_[id / kBlockSessions][id % kBlockSessions];
+    if( !s.pending.load(std::memory_order_relaxed) )
+    {
+      continue;
+    }
+    s.turn.clear();
+    {
+      std::lock_guard<std::mutex> lock( s.mutex );
+      s.turn.swap( s.incoming );
+      s.pending.store( false, std::memory_order_relaxed );
+    }
+    if( s.turn.empty() )
+    {
+      continue;
+    }
+
+    GameSession* const session = &s;
+    pool_.Submit( [this, session]( const size_t worker )
+                  {
+                    PlayTurn( *session, worker );
+                  },
+                  session->worker );
+    ++turns;
+  }
+
+  ++ticks_;
+  try
+  {
+    pool_.Wait();
+  }
+  catch( ... )
+  {
+    last_tick_time_ = NanosecondsSince( start );
+    throw;
+  }
+  last_tick_time_ = NanosecondsSince( start );
+  return turns;
+}
+
+// This method returns the Labyrinth of a session.
+// An exception is thrown if:
+//   The session does not exist (invalid_argument)
+const Labyrinth& GameHost::Session( const size_t session ) const
+{
+  return *SessionAt( session, "Session" ).labyrinth;
+}
+
+// This method returns the counters of the host.
+GameHostStats GameHost::Stats() const
+{
+  GameHostStats stats;
+  stats.sessions = sessions_.load( std::memory_order_relaxed ) -
+                   closed_.size();
+  stats.ticks = ticks_;
+  stats.last_tick_time = last_tick_time_;
+  for( const WorkerStats& w : worker_stats_ )
+  {
+    stats.turns += w.turns;
+    stats.moves += w.moves;
+    stats.steals += w.steals;
+    stats.turn_time += w.turn_time;
+    stats.max_turn_time = std::max( stats.max_turn_time, w.max_turn_time );
+  }
+  return stats;
+}
+
+// PRIVATE METHODS:
+
+// This private method returns the storage of the session with the given
+// identifier, which may be closed, or null if it has never been given out.
+GameHost::GameSession* GameHost::SlotAt( const size_t session ) const
+{
+  if( session >= sessions_.load(std::memory_order_acquire) )
+  {
+    return nullptr;
+  }
+  return &blocks_[session / kBlockSessions][session % kBlockSessions];
+}
+
+// This private method returns the open session with the given identifier.
+// Only used by the host thread, which is the only one to change open.
+// An exception is thrown if:
+//   The session does not exist (invalid_argument)
+GameHost::GameSession& GameHost::SessionAt( const size_t session,
+                                            const char* const caller ) const
+{
+  GameSession* const s = SlotAt( session );
+  if( s == nullptr || !s->labyrinth )
+  {
+    throw std::invalid_argument( "Error: " + std::string(caller) +
+      "() was given a session which does not exist.\n" );
+  }
+  return *s;
+}
+
+// This private method plays one turn of the session on the worker.
+void GameHost::PlayTurn( GameSession& s, const size_t worker )
+{
+  const auto start = std::chrono::steady_clock::now();
+
+  // Tick() swapped the queue out, so that moves can keep arriving while
+  // the turn is played; both buffers keep their capacity between turns.
+  WorkerStats& stats = worker_stats_[worker];
+  if( worker != s.worker )
+  {
+    ++stats.steals;
+  }
+  try
+  {
+    s.handler->Turn( *s.labyrinth, s.turn );
+  }
+  catch( ... )
+  {
+    ++stats.turns;
+    stats.moves += s.turn.size();
+    throw;
+  }
+
+  const std::uint64_t time = NanosecondsSince( start );
+  ++stats.turns;
+  stats.moves += s.turn.size();
+  stats.turn_time += time;
+  stats.max_turn_time = std::max( stats.max_turn_time, time );
+}
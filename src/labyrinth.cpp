@@ -1,79 +1,131 @@
 /*
  *
  * Author: Jeffrey Leung
- * Last edited: 2016-02-01
+ * Last edited: 2026-10-14
  *
  * This C++ file contains the implementation of the Labyrinth class, which uses
  * the Room class to create a 2-d mapping for a game.
  *
  */
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <iostream>
 #include <memory>
+#include <new>
 #include <stdexcept>
+#include <vector>
 
 #include "../include/room_properties.hpp"
 #include "../include/room.hpp"
 #include "../include/coordinate.hpp"
+#include "../include/room_row.hpp"
+#include "../include/labyrinth_observer.hpp"
 #include "../include/labyrinth.hpp"
+#include "../include/labyrinth_instrument.hpp"
+#include "../include/labyrinth_arena.hpp"
+
+constexpr size_t Labyrinth::kBandRows;
+constexpr size_t Labyrinth::MAX_X_SIZE_;
+constexpr size_t Labyrinth::MAX_Y_SIZE_;
+constexpr size_t Labyrinth::MAX_LARGE_SIZE_;
 
 // CONSTRUCTOR/DESTRUCTOR:
 
 // Parameterized constructor
 // An exception is thrown if:
 //   A size of 0 is given (domain_error)
-//   An x or y size greater than the maximum is given (domain_error)
-Labyrinth::Labyrinth( const size_t x_size, const size_t y_size ) :
-  x_size_(x_size), y_size_(y_size)
+//   An x or y size greater than the maximum of the mode is given
+//     (domain_error)
+Labyrinth::Labyrinth( const size_t x_size,
+                      const size_t y_size,
+                      const LabyrinthMode mode ) :
+  mode_(mode), x_size_(x_size), y_size_(y_size)
 {
-  if( x_size == 0 )
+  CheckSizes( x_size, y_size, mode );
+
+  if( mode == LabyrinthMode::kLarge )
   {
-    if( y_size == 0 )
-    {
-      throw std::domain_error( "Error: Labyrinth() was given empty x and "\
-        "y sizes.\n" );
-    }
-    else
-    {
-      throw std::domain_error( "Error: Labyrinth() was given an empty "\
-        "x size.\n" );
-    }
+    // Bands are allocated by RoomAt() when first modified.
+    const size_t bands = (y_size + kBandRows - 1) / kBandRows;
+    bands_ = std::make_unique<std::shared_ptr<Room>[]>( bands );
+    blank_row_.reset( new Room[x_size], std::default_delete<Room[]>() );
+    return;
   }
-  else if( y_size == 0 )
+
+  // A single allocation holds every Room.
+  owned_rooms_ = std::make_unique<Room[]>( x_size * y_size );
+  rooms_ = owned_rooms_.get();
+}
+
+// Parameterized constructor
+// The Rooms are allocated from the arena.
+// An exception is thrown if:
+//   A size of 0 is given (domain_error)
+//   An x or y size greater than the maximum of LabyrinthMode::kSmall is
+//     given (domain_error)
+Labyrinth::Labyrinth( const size_t x_size,
+                      const size_t y_size,
+                      LabyrinthArena& arena ) :
+  mode_(LabyrinthMode::kSmall), x_size_(x_size), y_size_(y_size)
+{
+  CheckSizes( x_size, y_size, LabyrinthMode::kSmall );
+
+  rooms_ = ArenaAllocator<Room>( &arena ).allocate( x_size * y_size );
+  for( size_t i = 0; i < x_size * y_size; ++i )
   {
-    throw std::domain_error( "Error: Labyrinth() was given an empty "\
-      "y size.\n" );
+    new( rooms_ + i ) Room();
   }
+}
 
-  if( x_size > MAX_X_SIZE_ )
+// Move constructor
+// Observers and checkpoints are moved with the Labyrinth. The Rooms of a
+// FixedLabyrinth stay with it, so they are copied instead.
+Labyrinth::Labyrinth( Labyrinth&& l ) :
+  mode_(l.mode_),
+  x_size_(l.x_size_),
+  y_size_(l.y_size_),
+  rooms_(l.rooms_),
+  owned_rooms_(std::move(l.owned_rooms_)),
+  bands_(std::move(l.bands_)),
+  blank_row_(std::move(l.blank_row_)),
+  mapped_rooms_(l.mapped_rooms_),
+  mapping_(std::move(l.mapping_)),
+  spawn_1_(l.spawn_1_),
+  spawn_2_(l.spawn_2_),
+  exit_set_(l.exit_set_),
+  exit_(l.exit_),
+  treasure_set_(l.treasure_set_),
+  treasure_(l.treasure_),
+  topology_version_(l.topology_version_),
+  observers_(std::move(l.observers_)),
+  journaling_(l.journaling_),
+  journal_(std::move(l.journal_))
+{
+  if( l.inline_rooms_ )
   {
-    if( y_size > MAX_Y_SIZE_ )
-    {
-      throw std::domain_error( "Error: Labyrinth() was given x and y sizes "\
-        "greater than the maximum (20).\n" );
-    }
-    else
-    {
-      throw std::domain_error( "Error: Labyrinth() was given an x size "\
-        "greater than the maximum (20).\n" );
-    }
+    owned_rooms_ = std::make_unique<Room[]>( x_size_ * y_size_ );
+    std::copy( rooms_, rooms_ + x_size_ * y_size_, owned_rooms_.get() );
+    rooms_ = owned_rooms_.get();
   }
-  else if( y_size > MAX_Y_SIZE_ )
+  else
   {
-    throw std::domain_error( "Error: Labyrinth() was given a y size "\
-      "greater than the maximum (20).\n" );
+    l.rooms_ = nullptr;
   }
 
-  auto rooms_temp_1 = std::make_unique<std::unique_ptr<Room[]>[]>(y_size);
-
-  rooms_ = std::move( rooms_temp_1 );
-  for( size_t i = 0; i < y_size; ++i )
-  {
-    auto rooms_temp_2 = std::make_unique<Room[]>(x_size);
-    rooms_[i] = std::move( rooms_temp_2 );
-  }
+  // The mapping was moved, so the source no longer keeps the file mapped.
+  l.mapped_rooms_ = nullptr;
+}
 
+// Parameterized constructor
+// Used by FixedLabyrinth, whose Rooms are stored in rooms.
+Labyrinth::Labyrinth( const size_t x_size,
+                      const size_t y_size,
+                      Room* const rooms ) :
+  mode_(LabyrinthMode::kSmall), x_size_(x_size), y_size_(y_size),
+  rooms_(rooms), inline_rooms_(true)
+{
 }
 
 // SETUP:
@@ -86,6 +138,7 @@ Labyrinth::Labyrinth( const size_t x_size, const size_t y_size ) :
 //   The Rooms are already connected (logic_error)
 void Labyrinth::ConnectRooms( const Coordinate rm_1, const Coordinate rm_2 )
 {
+  LABYRINTH_INSTRUMENT_SCOPE( InstrumentOp::kConnectRooms );
   if( !WithinBounds(rm_1) || !WithinBounds(rm_2) )
   {
     if( !WithinBounds(rm_1) )
@@ -119,48 +172,28 @@ void Labyrinth::ConnectRooms( const Coordinate rm_1, const Coordinate rm_2 )
       "coordinate for the two Rooms.\n" );
   }
 
-  int x_distance = (int)(rm_2.x) - (int)(rm_1.x);
-  int y_distance = (int)(rm_2.y) - (int)(rm_1.y);
-
-  Direction break_wall_1;
-  Direction break_wall_2;
-
-  if( x_distance == 0 )
-  {
-    if( y_distance > 0 )  // rm_1 is north of rm_2
-    {
-      break_wall_1 = Direction::kSouth;
-      break_wall_2 = Direction::kNorth;
-    }
-    else  // rm_1 is south of rm_2
-    {
-      break_wall_1 = Direction::kNorth;
-      break_wall_2 = Direction::kSouth;
-    }
-  }
-
-  else if( y_distance == 0 )
-  {
-    if( x_distance > 0 )  // rm_1 is west of rm_2
-    {
-      break_wall_1 = Direction::kEast;
-      break_wall_2 = Direction::kWest;
-    }
-    else  // rm_1 is east of rm_2
-    {
-      break_wall_1 = Direction::kWest;
-      break_wall_2 = Direction::kEast;
-    }
-  }
-
-  if( RoomAt(rm_1).DirectionCheck(break_wall_1) == RoomBorder::kRoom )
+  // The Rooms are adjacent, so they differ along exactly one axis, and
+  // each Wall is opposite the other (Directions are numbered clockwise
+  // from kNorth = 1).
+  const Direction break_wall_1 =
+    rm_2.x > rm_1.x ? Direction::kEast :
+    rm_2.x < rm_1.x ? Direction::kWest :
+    rm_2.y > rm_1.y ? Direction::kSouth : Direction::kNorth;
+  const Direction break_wall_2 = static_cast<Direction>(
+    (static_cast<unsigned>(break_wall_1) + 1) % 4 + 1 );
+
+  if( RoomAtUnchecked(rm_1).DirectionCheckUnchecked(break_wall_1) ==
+      RoomBorder::kRoom )
   {
     throw std::logic_error( "Error: ConnectRooms() was given two Rooms "\
       "which are already connected.\n" );
   }
 
-  RoomAt(rm_1).BreakWall(break_wall_1);
-  RoomAt(rm_2).BreakWall(break_wall_2);
+  ModifyRoom(rm_1).BreakWall(break_wall_1);
+  ModifyRoom(rm_2).BreakWall(break_wall_2);
+  ++topology_version_;
+  NotifyRoomChanged( rm_1 );
+  NotifyRoomChanged( rm_2 );
   return;
 }
 
@@ -177,6 +210,7 @@ void Labyrinth::SetSpawn1( const Coordinate rm )
   }
 
   spawn_1_ = rm;
+  NotifySpawnsChanged();
   return;
 }
 
@@ -194,62 +228,89 @@ void Labyrinth::SetSpawn2( const Coordinate rm )
   }
 
   spawn_2_ = rm;
+  NotifySpawnsChanged();
   return;
 }
 
-// This method sets the exit of the Labyrinth on a Wall.
+// These methods return the primary and secondary spawn Rooms.
+Coordinate Labyrinth::GetSpawn1() const
+{
+  return spawn_1_;
+}
+
+Coordinate Labyrinth::GetSpawn2() const
+{
+  return spawn_2_;
+}
+
+// This method returns true if the exit has been set.
+bool Labyrinth::ExitSet() const
+{
+  return exit_set_;
+}
+
+// These methods return the Room with the exit and the Direction of
+// the exit from that Room.
 // An exception is thrown if:
-//   The Room is outside the Labyrinth (domain_error)
-//   The Direction is invalid (kNone) (invalid_argument)
-//   The Direction has another Room (invalid_argument)
-//   The Exit has already been set (logic_error)
-void Labyrinth::SetExit( const Coordinate rm, const Direction d )
+//   The exit has not been set (logic_error)
+Coordinate Labyrinth::GetExit() const
 {
-  if( !WithinBounds(rm) )
-  {
-    throw std::domain_error( "Error: SetExit() was given an "\
-      "invalid Coordinate.\n" );
-  }
-  else if( d == Direction::kNone )
+  if( !exit_set_ )
   {
-    throw std::invalid_argument( "Error: SetExit() was given an "\
-      "invalid direction (kNone).\n" );
+    throw std::logic_error( "Error: GetExit() was called before the exit "\
+      "was set.\n" );
   }
+  return exit_;
+}
 
-  auto rb = RoomBorder::kRoom;
-  try
-  {
-    rb = RoomAt(rm).DirectionCheck(d);
-  }
-  catch( const std::exception& e )
-  {
-    std::cout << e.what();
-    return;
-  }
-  if (rb == RoomBorder::kRoom)
+Direction Labyrinth::GetExitDirection() const
+{
+  if( !exit_set_ )
   {
-    throw std::invalid_argument( "Error: SetExit() was given a "\
-      "direction with a Room, not a Wall.\n" );
+    throw std::logic_error( "Error: GetExitDirection() was called before "\
+      "the exit was set.\n" );
   }
 
-  if( exit_set_ )
+  const Room& rm = RoomAt( exit_ );
+  for( const Direction d : { Direction::kNorth, Direction::kEast,
+                             Direction::kSouth, Direction::kWest } )
   {
-    throw std::logic_error( "Error: SetExit() was called when an exit "\
-      "already exists.\n" );
+    if( rm.DirectionCheck(d) == RoomBorder::kExit )
+    {
+      return d;
+    }
   }
+  return Direction::kNone;
+}
 
-  try
-  {
-    RoomAt(rm).CreateExit(d);
-  }
-  catch( const std::exception& e )
+// This method sets the exit of the Labyrinth on a Wall.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+//   The Direction is invalid (kNone) (invalid_argument)
+//   The Direction has another Room (invalid_argument)
+//   The Exit has already been set (logic_error)
+void Labyrinth::SetExit( const Coordinate rm, const Direction d )
+{
+  LABYRINTH_INSTRUMENT_SCOPE( InstrumentOp::kSetExit );
+  switch( TrySetExit(rm, d) )
   {
-    std::cout << e.what();
-    return;
+    case LabyrinthStatus::kOutOfBounds:
+      throw std::domain_error( "Error: SetExit() was given an "\
+        "invalid Coordinate.\n" );
+    case LabyrinthStatus::kInvalidArgument:
+      if( d == Direction::kNone )
+      {
+        throw std::invalid_argument( "Error: SetExit() was given an "\
+          "invalid direction (kNone).\n" );
+      }
+      throw std::invalid_argument( "Error: SetExit() was given a "\
+        "direction with a Room, not a Wall.\n" );
+    case LabyrinthStatus::kInvalidState:
+      throw std::logic_error( "Error: SetExit() was called when an exit "\
+        "already exists.\n" );
+    default:
+      return;
   }
-
-  exit_set_ = true;
-  return;
 }
 
 // This method places an Inhabitant in a Room.
@@ -272,13 +333,14 @@ void Labyrinth::SetInhabitant( const Coordinate rm, const Inhabitant inh )
     throw std::invalid_argument( "Error: SetInhabitant() was given a null "\
       "Inhabitant.\n" );
   }
-  else if( RoomAt(rm).GetInhabitant() != Inhabitant::kNone )
+  else if( RoomAtUnchecked(rm).GetInhabitant() != Inhabitant::kNone )
   {
     throw std::logic_error( "Error: SetInhabitant() cannot replace an "\
       "existing Inhabitant; EnemyAttacked() should be used instead.\n" );
   }
 
-  RoomAt(rm).SetInhabitant(inh);
+  ModifyRoom(rm).SetInhabitant(inh);
+  NotifyRoomChanged( rm );
   return;
 }
 
@@ -302,7 +364,7 @@ void Labyrinth::SetItem( const Coordinate rm, const Item itm )
     throw std::invalid_argument( "Error: SetItem() was given an invalid "\
       "Item.\n" );
   }
-  else if( RoomAt(rm).GetItem() != Item::kNone )
+  else if( RoomAtUnchecked(rm).GetItem() != Item::kNone )
   {
     throw std::logic_error("Error: SetItem() cannot replace an existing "\
       "Item.\n");
@@ -313,21 +375,110 @@ void Labyrinth::SetItem( const Coordinate rm, const Item itm )
       "but the Treasure has already been set in the Labyrinth.\n" );
   }
 
-  try
+  ModifyRoom(rm).SetItem(itm);
+
+  if( itm == Item::kTreasure )
+  {
+    treasure_set_ = true;
+    treasure_ = rm;
+  }
+  NotifyRoomChanged( rm );
+}
+
+// OBSERVERS:
+
+// This method registers an observer to be notified of every change
+// to the Rooms. Observers are not owned, and must be removed before
+// they are destroyed.
+// An exception is thrown if:
+//   o is null (invalid_argument)
+void Labyrinth::AddObserver( LabyrinthObserver* const o ) const
+{
+  if( o == nullptr )
   {
-    RoomAt(rm).SetItem(itm);
+    throw std::invalid_argument( "Error: AddObserver() was given an "\
+      "invalid (null) pointer for the observer.\n" );
   }
-  catch( const std::exception& e )
+  observers_.push_back( o );
+}
+
+// This method unregisters an observer. Nothing is done if it is not
+// registered.
+void Labyrinth::RemoveObserver( LabyrinthObserver* const o ) const
+{
+  for( size_t i = 0; i < observers_.size(); ++i )
   {
-    std::cout << e.what();
+    if( observers_[i] == o )
+    {
+      observers_.erase( observers_.begin() + i );
+      return;
+    }
   }
+}
 
-  if( itm == Item::kTreasure )
+// SNAPSHOTS:
+
+// This method returns a copy of the Labyrinth, without its observers or
+// checkpoints.
+Labyrinth Labyrinth::Clone() const
+{
+  return Labyrinth( *this );
+}
+
+// This method begins recording changes to the Rooms, exit and Treasure if
+// they are not already recorded, and returns a checkpoint which Rollback()
+// can return to.
+size_t Labyrinth::Checkpoint()
+{
+  journaling_ = true;
+  return journal_.size();
+}
+
+// This method undoes every change made since the given checkpoint, and
+// discards the checkpoints taken after it.
+// An exception is thrown if:
+//   The checkpoint was not returned by Checkpoint(), or has been discarded
+//     (invalid_argument)
+void Labyrinth::Rollback( const size_t checkpoint )
+{
+  if( !journaling_ || checkpoint > journal_.size() )
   {
-    treasure_set_ = true;
+    throw std::invalid_argument( "Error: Rollback() was given a checkpoint "\
+      "which is not valid.\n" );
+  }
+
+  bool topology_changed = false;
+  while( journal_.size() > checkpoint )
+  {
+    const JournalEntry& e = journal_.back();
+    Room& rm = MutableRowAt(e.rm.y)[e.rm.x];
+    topology_changed = topology_changed ||
+      ( (rm.Packed() ^ e.room.Packed()) & Room::kWallMask ) != 0;
+    rm = e.room;
+    exit_set_ = e.exit_set;
+    exit_ = e.exit;
+    treasure_set_ = e.treasure_set;
+    treasure_ = e.treasure;
+
+    const Coordinate changed = e.rm;
+    journal_.pop_back();
+    NotifyRoomChanged( changed );
+  }
+
+  if( topology_changed )
+  {
+    ++topology_version_;
   }
 }
 
+// This method stops recording changes and discards every checkpoint.
+void Labyrinth::ReleaseCheckpoints()
+{
+  journaling_ = false;
+  journal_.clear();
+  journal_.shrink_to_fit();
+}
+
 // PLAY:
 
 // This method returns the current Inhabitant of the Room.
@@ -335,12 +486,13 @@ void Labyrinth::SetItem( const Coordinate rm, const Item itm )
 //   The Room is outside the Labyrinth (domain_error)
 Inhabitant Labyrinth::GetInhabitant( const Coordinate rm ) const
 {
-  if( !WithinBounds(rm) )
+  Inhabitant inh = Inhabitant::kNone;
+  if( TryGetInhabitant(rm, inh) != LabyrinthStatus::kOk )
   {
     throw std::domain_error( "Error: GetInhabitant() was given a "\
       "Coordinate outside of the Labyrinth.\n" );
   }
-  return RoomAt(rm).GetInhabitant();
+  return inh;
 }
 
 // This method attacks the Inhabitant of the Room, and sets the resultant
@@ -352,64 +504,28 @@ Inhabitant Labyrinth::GetInhabitant( const Coordinate rm ) const
 //     or cracked Mirror) (invalid_argument)
 void Labyrinth::AttackEnemy( const Coordinate rm )
 {
-  if( !WithinBounds(rm) )
-  {
-    throw std::domain_error( "Error: AttackEnemy() was given an invalid "\
-      "Coordinate.\n" );
-  }
-
-  auto inh = Inhabitant::kNone;
-  try
-  {
-    inh = RoomAt(rm).GetInhabitant();
-  }
-  catch( const std::exception& e )
+  switch( TryAttackEnemy(rm) )
   {
-    std::cout << e.what();
-    return;
-  }
-
-  switch( inh )
-  {
-    case Inhabitant::kNone:
-      throw std::invalid_argument( "Error: AttackEnemy() was given a "\
-        "Coordinate with an invalid Inhabitant (kNone).\n" );
-      break;
-
-    case Inhabitant::kMinotaurDead:
-      throw std::invalid_argument( "Error: AttackEnemy() was given a "\
-        "Coordinate with an invalid Inhabitant (a dead Minotaur).\n" );
-      break;
+    case LabyrinthStatus::kOutOfBounds:
+      throw std::domain_error( "Error: AttackEnemy() was given an invalid "\
+        "Coordinate.\n" );
 
-    case Inhabitant::kMirrorCracked:
-      throw std::invalid_argument( "Error: AttackEnemy() was given a "\
-        "Coordinate with an invalid Inhabitant (a cracked mirror).\n" );
-      break;
-
-    // Actual code, not error-checking
-    case Inhabitant::kMinotaur:
-      try
+    case LabyrinthStatus::kInvalidArgument:
+      switch( GetInhabitantUnchecked(rm) )
       {
-        RoomAt(rm).SetInhabitant(Inhabitant::kMinotaurDead);
+        case Inhabitant::kMinotaurDead:
+          throw std::invalid_argument( "Error: AttackEnemy() was given a "\
+            "Coordinate with an invalid Inhabitant (a dead Minotaur).\n" );
+        case Inhabitant::kMirrorCracked:
+          throw std::invalid_argument( "Error: AttackEnemy() was given a "\
+            "Coordinate with an invalid Inhabitant (a cracked mirror).\n" );
+        default:
+          throw std::invalid_argument( "Error: AttackEnemy() was given a "\
+            "Coordinate with an invalid Inhabitant (kNone).\n" );
       }
-      catch( const std::exception& e )
-      {
-        std::cout << e.what();
-        return;
-      }
-      break;
 
-    case Inhabitant::kMirror:
-      try
-      {
-        RoomAt(rm).SetInhabitant(Inhabitant::kMirrorCracked);
-      }
-      catch( const std::exception& e )
-      {
-        std::cout << e.what();
-        return;
-      }
-      break;
+    default:
+      return;
   }
 }
 
@@ -419,12 +535,13 @@ void Labyrinth::AttackEnemy( const Coordinate rm )
 //   The Room is outside the Labyrinth (domain_error)
 Item Labyrinth::ItemAt( const Coordinate rm ) const
 {
-  if( !WithinBounds(rm) )
+  Item itm = Item::kNone;
+  if( TryItemAt(rm, itm) != LabyrinthStatus::kOk )
   {
     throw std::domain_error( "Error: ItemAt() was given a "\
       "Coordinate outside of the Labyrinth.\n" );
   }
-  return RoomAt(rm).GetItem();
+  return itm;
 }
 
 // This method takes the Item from the Room.
@@ -433,114 +550,336 @@ Item Labyrinth::ItemAt( const Coordinate rm ) const
 //   There is no Item to take (i.e. Item::kNone or Item taken already)
 //     (logic_error)
 void Labyrinth::TakeItem( const Coordinate rm )
+{
+  LABYRINTH_INSTRUMENT_SCOPE( InstrumentOp::kTakeItem );
+  switch( TryTakeItem(rm) )
+  {
+    case LabyrinthStatus::kOutOfBounds:
+      throw std::domain_error( "Error: TakeItem() was given an "\
+        "invalid Coordinate.\n" );
+
+    case LabyrinthStatus::kInvalidState:
+      if( ItemAtUnchecked(rm) == Item::kTreasureGone )
+      {
+        throw std::logic_error( "Error: TakeItem() attempted to take "\
+          "the Treasure, but the Treasure is gone from this Room.\n" );
+      }
+      throw std::logic_error( "Error: TakeItem() cannot take "\
+        "no item (kNone).\n" );
+
+    default:
+      return;
+  }
+}
+
+// This method drops the Treasure in the given Room.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+//   The Treasure has already been set in another Room (logic_error)
+void Labyrinth::DropTreasure( const Coordinate rm )
 {
   if( !WithinBounds(rm) )
   {
-    throw std::domain_error( "Error: TakeItem() was given an "\
-      "invalid Coordinate.\n" );
+    throw std::domain_error( "Error: DropTreasure() was given an "\
+      "invalid Coordinate\n." );
+  }
+  else if( treasure_set_ )
+  {
+    throw std::logic_error( "Error: DropTreasure() was called when the "
+      "Treasure was already set in a Room of the Labyrinth.\n" );
   }
 
-  auto itm = Item::kNone;
+  ModifyRoom(rm).SetItem(Item::kTreasure);
+
+  treasure_set_ = true;
+  treasure_ = rm;
+  NotifyRoomChanged( rm );
+}
 
-  try
+// This method returns the type of RoomBorder in the given direction.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+//   Direction d is kNone (invalid_argument)
+RoomBorder Labyrinth::DirectionCheck( const Coordinate rm,
+                                      const Direction d ) const
+{
+  LABYRINTH_INSTRUMENT_SCOPE( InstrumentOp::kDirectionCheck );
+  RoomBorder rb = RoomBorder::kWall;
+  switch( TryDirectionCheck(rm, d, rb) )
   {
-    itm = RoomAt(rm).GetItem();
+    case LabyrinthStatus::kOutOfBounds:
+      throw std::domain_error( "Error: DirectionCheck() was given a "\
+        "Coordinate outside of the Labyrinth.\n" );
+    case LabyrinthStatus::kInvalidArgument:
+      throw std::invalid_argument( "Error: DirectionCheck() was given an "\
+        "invalid direction (kNone).\n" );
+    default:
+      return rb;
   }
-  catch( const std::exception& e )
+}
+
+// This method returns true if the Treasure is in a Room, and false if
+// it has not been placed or is held by a Player.
+bool Labyrinth::TreasureSet() const
+{
+  return treasure_set_;
+}
+
+// This method returns the Room with the Treasure.
+// An exception is thrown if:
+//   The Treasure is not in a Room (logic_error)
+Coordinate Labyrinth::GetTreasure() const
+{
+  if( !treasure_set_ )
   {
-    std::cout << e.what();
-    return;
+    throw std::logic_error( "Error: GetTreasure() was called when the "\
+      "Treasure is not in a Room.\n" );
   }
+  return treasure_;
+}
 
-  auto itm_new = Item::kNone;
+// FAST PATH:
 
-  switch( itm )
+// These methods are the same as the checked methods, but return a
+// status instead of throwing. The result is only stored on kOk.
+LabyrinthStatus Labyrinth::TryGetInhabitant( const Coordinate rm,
+                                             Inhabitant& inh ) const noexcept
+{
+  if( !WithinBounds(rm) )
   {
-    case Item::kNone:
-      throw std::logic_error( "Error: TakeItem() cannot take "\
-        "no item (kNone).\n" );
-      break;
+    return LabyrinthStatus::kOutOfBounds;
+  }
+  inh = RoomAtUnchecked(rm).GetInhabitant();
+  return LabyrinthStatus::kOk;
+}
 
-    case Item::kTreasureGone:
-      throw std::logic_error( "Error: TakeItem() attempted to take "\
-        "the Treasure, but the Treasure is gone from this Room.\n" );
-      break;
+LabyrinthStatus Labyrinth::TryItemAt( const Coordinate rm,
+                                      Item& itm ) const noexcept
+{
+  if( !WithinBounds(rm) )
+  {
+    return LabyrinthStatus::kOutOfBounds;
+  }
+  itm = RoomAtUnchecked(rm).GetItem();
+  return LabyrinthStatus::kOk;
+}
 
-    case Item::kBullet:
-      itm_new = Item::kNone;
-      break;
+LabyrinthStatus Labyrinth::TryDirectionCheck( const Coordinate rm,
+                                              const Direction d,
+                                              RoomBorder& rb ) const noexcept
+{
+  if( !WithinBounds(rm) )
+  {
+    return LabyrinthStatus::kOutOfBounds;
+  }
+  else if( d == Direction::kNone )
+  {
+    return LabyrinthStatus::kInvalidArgument;
+  }
+  rb = RoomAtUnchecked(rm).DirectionCheckUnchecked(d);
+  return LabyrinthStatus::kOk;
+}
 
-    case Item::kTreasure:
-      itm_new = Item::kTreasureGone;
+// These methods are the same as the checked methods, but return a
+// status instead of throwing for misuse. Nothing is changed unless
+// kOk is returned.
+LabyrinthStatus Labyrinth::TrySetExit( const Coordinate rm,
+                                       const Direction d )
+{
+  if( !WithinBounds(rm) )
+  {
+    return LabyrinthStatus::kOutOfBounds;
+  }
+  else if( d == Direction::kNone ||
+           RoomAtUnchecked(rm).DirectionCheckUnchecked(d) ==
+             RoomBorder::kRoom )
+  {
+    return LabyrinthStatus::kInvalidArgument;
+  }
+  else if( exit_set_ )
+  {
+    return LabyrinthStatus::kInvalidState;
+  }
+
+  ModifyRoom(rm).CreateExitUnchecked(d);
+  exit_set_ = true;
+  exit_ = rm;
+  NotifyRoomChanged( rm );
+  return LabyrinthStatus::kOk;
+}
+
+LabyrinthStatus Labyrinth::TryAttackEnemy( const Coordinate rm )
+{
+  if( !WithinBounds(rm) )
+  {
+    return LabyrinthStatus::kOutOfBounds;
+  }
+
+  Inhabitant attacked;
+  switch( RoomAtUnchecked(rm).GetInhabitant() )
+  {
+    case Inhabitant::kMinotaur:
+      attacked = Inhabitant::kMinotaurDead;
       break;
+    case Inhabitant::kMirror:
+      attacked = Inhabitant::kMirrorCracked;
+      break;
+    default:  // Nothing, a dead Minotaur or a cracked Mirror
+      return LabyrinthStatus::kInvalidArgument;
   }
 
-  try
+  ModifyRoom(rm).SetInhabitant(attacked);
+  NotifyRoomChanged( rm );
+  return LabyrinthStatus::kOk;
+}
+
+LabyrinthStatus Labyrinth::TryTakeItem( const Coordinate rm )
+{
+  if( !WithinBounds(rm) )
   {
-    RoomAt(rm).SetItem(itm_new);
+    return LabyrinthStatus::kOutOfBounds;
   }
-  catch( const std::exception& e )
+
+  Item left;
+  switch( RoomAtUnchecked(rm).GetItem() )
   {
-    std::cout << e.what();
-    return;
+    case Item::kBullet:
+      left = Item::kNone;
+      break;
+    case Item::kTreasure:
+      left = Item::kTreasureGone;
+      break;
+    default:  // Nothing, or the Treasure is already gone
+      return LabyrinthStatus::kInvalidState;
   }
 
-  // treasure_set_ is not changed upon failure in the try/catch block.
-  if( itm_new == Item::kTreasureGone )
+  ModifyRoom(rm).SetItem(left);
+  if( left == Item::kTreasureGone )
   {
     treasure_set_ = false;
   }
+  NotifyRoomChanged( rm );
+  return LabyrinthStatus::kOk;
 }
 
-// This method drops the Treasure in the given Room.
+// These methods return the contents of a Room without checking.
+// The Coordinate must be within the Labyrinth, and Direction d must
+// not be kNone.
+Inhabitant Labyrinth::GetInhabitantUnchecked( const Coordinate rm ) const
+  noexcept
+{
+  return RoomAtUnchecked(rm).GetInhabitant();
+}
+
+Item Labyrinth::ItemAtUnchecked( const Coordinate rm ) const noexcept
+{
+  return RoomAtUnchecked(rm).GetItem();
+}
+
+RoomBorder Labyrinth::DirectionCheckUnchecked( const Coordinate rm,
+                                               const Direction d ) const
+  noexcept
+{
+  return RoomAtUnchecked(rm).DirectionCheckUnchecked(d);
+}
+
+// LAYOUT:
+
+// This method returns the number of Rooms along the x-axis.
+size_t Labyrinth::XSize() const
+{
+  return x_size_;
+}
+
+// This method returns the number of Rooms along the y-axis.
+size_t Labyrinth::YSize() const
+{
+  return y_size_;
+}
+
+// This method returns the storage mode of the Labyrinth.
+LabyrinthMode Labyrinth::Mode() const
+{
+  return mode_;
+}
+
+// This method returns a read-only view of the row of Rooms with the
+// given y-coordinate.
 // An exception is thrown if:
-//   The Room is outside the Labyrinth (domain_error)
-//   The Treasure has already been set in another Room (logic_error)
-void Labyrinth::DropTreasure( const Coordinate rm )
+//   The row is outside the Labyrinth (domain_error)
+RoomRow Labyrinth::RowAt( const size_t y ) const
 {
-  if( !WithinBounds(rm) )
+  if( y >= y_size_ )
   {
-    throw std::domain_error( "Error: DropTreasure() was given an "\
-      "invalid Coordinate\n." );
+    throw std::domain_error( "Error: RowAt() was given a y-coordinate "\
+      "outside of the Labyrinth.\n" );
   }
-  else if( treasure_set_ )
+
+  return RoomRow( &RoomAtUnchecked(Coordinate(0, y)), x_size_ );
+}
+
+// This method returns the Room at the given Coordinate without
+// checking it. The Coordinate must be within the Labyrinth.
+const Room& Labyrinth::RoomAtUnchecked( const Coordinate rm ) const noexcept
+{
+  if( rooms_ )
   {
-    throw std::logic_error( "Error: DropTreasure() was called when the "
-      "Treasure was already set in a Room of the Labyrinth.\n" );
+    return rooms_[rm.y * x_size_ + rm.x];
   }
 
-  try
+  if( bands_ )
   {
-    RoomAt(rm).SetItem(Item::kTreasure);
+    const Room* const band = bands_[rm.y / kBandRows].get();
+    if( band != nullptr )
+    {
+      return band[(rm.y % kBandRows) * x_size_ + rm.x];
+    }
   }
-  catch( const std::exception& e )
+
+  if( mapped_rooms_ != nullptr )
   {
-    std::cout << e.what();
-    return;
+    return mapped_rooms_[rm.y * x_size_ + rm.x];
   }
-
-  treasure_set_ = true;  // Not modified upon failure of try/catch block
+  return blank_row_.get()[rm.x];
 }
 
-// This method returns the type of RoomBorder in the given direction.
-// An exception is thrown if:
-//   The Room is outside the Labyrinth (domain_error)
-//   Direction d is kNone (invalid_argument)
-RoomBorder Labyrinth::DirectionCheck( const Coordinate rm,
-                                      const Direction d ) const
+// This method returns the number of Rooms which currently have
+// storage allocated. Rooms without storage are walled and empty.
+size_t Labyrinth::ResidentRooms() const
 {
-  if( !WithinBounds(rm) )
+  if( rooms_ )
   {
-    throw std::domain_error( "Error: DirectionCheck() was given a "\
-      "Coordinate outside of the Labyrinth.\n" );
+    return x_size_ * y_size_;
   }
-  else if( d == Direction::kNone )
+  else if( !bands_ )
   {
-    throw std::invalid_argument( "Error: DirectionCheck() was given an "\
-      "invalid direction (kNone).\n" );
+    return 0;  // Every Room is read from a mapped file
+  }
+
+  size_t rows = 0;
+  const size_t bands = (y_size_ + kBandRows - 1) / kBandRows;
+  for( size_t i = 0; i < bands; ++i )
+  {
+    if( bands_[i] )
+    {
+      rows += BandRows( i );
+    }
   }
+  return rows * x_size_;
+}
 
-  return RoomAt(rm).DirectionCheck(d);
+// This method returns true if any Rooms are read directly from a
+// mapped file.
+bool Labyrinth::Mapped() const
+{
+  return mapped_rooms_ != nullptr;
+}
+
+// This method returns a number which changes whenever Rooms are
+// connected, so that derived data can tell when it is out of date.
+std::uint64_t Labyrinth::TopologyVersion() const
+{
+  return topology_version_;
 }
 
 // PRIVATE METHODS:
@@ -549,21 +888,277 @@ RoomBorder Labyrinth::DirectionCheck( const Coordinate rm,
 // coordinate.
 // An exception is thrown if:
 //   The Room is outside the Labyrinth (domain_error)
-Room& Labyrinth::RoomAt( const Coordinate rm ) const
+const Room& Labyrinth::RoomAt( const Coordinate rm ) const
+{
+  if( !WithinBounds(rm) )
+  {
+    throw std::domain_error( "Error: RoomAt() was given an invalid "\
+      "coordinate for rm.\n" );
+  }
+  return RoomAtUnchecked( rm );
+}
+
+// This private method returns a modifiable reference to the Room at the
+// given coordinate, allocating its band first in LabyrinthMode::kLarge.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+Room& Labyrinth::RoomAt( const Coordinate rm )
 {
   if( !WithinBounds(rm) )
   {
     throw std::domain_error( "Error: RoomAt() was given an invalid "\
       "coordinate for rm.\n" );
   }
-  return rooms_[rm.y][rm.x];
+
+  if( !rooms_ && !bands_ )
+  {
+    OwnRooms( 0 );
+  }
+  if( rooms_ )
+  {
+    return rooms_[rm.y * x_size_ + rm.x];
+  }
+
+  // Bands shared with a clone are copied before they are modified.
+  const size_t band = rm.y / kBandRows;
+  if( !bands_[band] || bands_[band].use_count() > 1 )
+  {
+    OwnRooms( band );
+  }
+  return bands_[band].get()[(rm.y % kBandRows) * x_size_ + rm.x];
+}
+
+// This private method returns a modifiable reference to the Room at the
+// given coordinate, as RoomAt() does, and records the Room, exit and
+// Treasure as they are before the change if checkpoints are in use.
+// The Room must be within the Labyrinth.
+Room& Labyrinth::ModifyRoom( const Coordinate rm )
+{
+  Room& room = MutableRowAt(rm.y)[rm.x];
+  if( journaling_ )
+  {
+    JournalEntry e;
+    e.rm = rm;
+    e.room = room;
+    e.exit_set = exit_set_;
+    e.exit = exit_;
+    e.treasure_set = treasure_set_;
+    e.treasure = treasure_;
+    journal_.push_back( e );
+  }
+  return room;
+}
+
+// This private method returns a pointer to the first Room of the given
+// row, allocating its band first in LabyrinthMode::kLarge.
+// The row must be within the Labyrinth.
+Room* Labyrinth::MutableRowAt( const size_t y )
+{
+  return &RoomAt( Coordinate(0, y) );
+}
+
+// These private methods notify the observers of changed Rooms.
+void Labyrinth::NotifyRoomChanged( const Coordinate rm ) const
+{
+  for( LabyrinthObserver* const o : observers_ )
+  {
+    o->RoomChanged( rm );
+  }
+}
+
+void Labyrinth::NotifyAllRoomsChanged() const
+{
+  for( LabyrinthObserver* const o : observers_ )
+  {
+    o->AllRoomsChanged();
+  }
+}
+
+// This private method notifies the observers of a changed spawn.
+void Labyrinth::NotifySpawnsChanged() const
+{
+  for( LabyrinthObserver* const o : observers_ )
+  {
+    o->SpawnsChanged();
+  }
+}
+
+// Copy constructor
+// Used by Clone(). Bands of Rooms and a mapped file are shared, and
+// observers and checkpoints are not copied.
+Labyrinth::Labyrinth( const Labyrinth& l ) :
+  mode_(l.mode_),
+  x_size_(l.x_size_),
+  y_size_(l.y_size_),
+  blank_row_(l.blank_row_),
+  mapped_rooms_(l.mapped_rooms_),
+  mapping_(l.mapping_),
+  spawn_1_(l.spawn_1_),
+  spawn_2_(l.spawn_2_),
+  exit_set_(l.exit_set_),
+  exit_(l.exit_),
+  treasure_set_(l.treasure_set_),
+  treasure_(l.treasure_),
+  topology_version_(l.topology_version_)
+{
+  if( l.rooms_ )
+  {
+    owned_rooms_ = std::make_unique<Room[]>( x_size_ * y_size_ );
+    std::copy( l.rooms_, l.rooms_ + x_size_ * y_size_, owned_rooms_.get() );
+    rooms_ = owned_rooms_.get();
+  }
+  if( l.bands_ )
+  {
+    const size_t bands = (y_size_ + kBandRows - 1) / kBandRows;
+    bands_ = std::make_unique<std::shared_ptr<Room>[]>( bands );
+    std::copy( l.bands_.get(), l.bands_.get() + bands, bands_.get() );
+  }
+}
+
+// This private method gives the given band (or every Room in
+// LabyrinthMode::kSmall) storage of its own, holding the Rooms it read
+// before: from a band shared with a clone, from a mapped file, or walled
+// and empty.
+void Labyrinth::OwnRooms( const size_t band )
+{
+  if( mode_ == LabyrinthMode::kSmall )
+  {
+    owned_rooms_ = std::make_unique<Room[]>( x_size_ * y_size_ );
+    std::copy( mapped_rooms_, mapped_rooms_ + x_size_ * y_size_,
+               owned_rooms_.get() );
+    rooms_ = owned_rooms_.get();
+
+    // Nothing is read from the file any more.
+    mapped_rooms_ = nullptr;
+    mapping_.reset();
+    return;
+  }
+
+  const size_t count = BandRows(band) * x_size_;
+  std::shared_ptr<Room> owned( new Room[count], std::default_delete<Room[]>() );
+  const Room* source = bands_[band].get();
+  if( source == nullptr && mapped_rooms_ != nullptr )
+  {
+    source = mapped_rooms_ + band * kBandRows * x_size_;
+  }
+  if( source != nullptr )
+  {
+    std::copy( source, source + count, owned.get() );
+  }
+  bands_[band] = std::move( owned );
+}
+
+// This private method returns the number of rows in the given band.
+size_t Labyrinth::BandRows( const size_t band ) const
+{
+  const size_t first_row = band * kBandRows;
+  if( y_size_ - first_row < kBandRows )
+  {
+    return y_size_ - first_row;
+  }
+  return kBandRows;
+}
+
+// This private method throws if the sizes are not allowed in the mode.
+// An exception is thrown if:
+//   A size of 0 is given (domain_error)
+//   An x or y size greater than the maximum of the mode is given
+//     (domain_error)
+void Labyrinth::CheckSizes( const size_t x_size,
+                            const size_t y_size,
+                            const LabyrinthMode mode )
+{
+  if( x_size == 0 )
+  {
+    if( y_size == 0 )
+    {
+      throw std::domain_error( "Error: Labyrinth() was given empty x and "\
+        "y sizes.\n" );
+    }
+    else
+    {
+      throw std::domain_error( "Error: Labyrinth() was given an empty "\
+        "x size.\n" );
+    }
+  }
+  else if( y_size == 0 )
+  {
+    throw std::domain_error( "Error: Labyrinth() was given an empty "\
+      "y size.\n" );
+  }
+
+  if( mode == LabyrinthMode::kLarge )
+  {
+    if( x_size > MAX_LARGE_SIZE_ || y_size > MAX_LARGE_SIZE_ )
+    {
+      throw std::domain_error( "Error: Labyrinth() was given a size "\
+        "greater than the maximum of a large Labyrinth (65536).\n" );
+    }
+    return;
+  }
+
+  if( x_size > MAX_X_SIZE_ )
+  {
+    if( y_size > MAX_Y_SIZE_ )
+    {
+      throw std::domain_error( "Error: Labyrinth() was given x and y sizes "\
+        "greater than the maximum (20).\n" );
+    }
+    else
+    {
+      throw std::domain_error( "Error: Labyrinth() was given an x size "\
+        "greater than the maximum (20).\n" );
+    }
+  }
+  else if( y_size > MAX_Y_SIZE_ )
+  {
+    throw std::domain_error( "Error: Labyrinth() was given a y size "\
+      "greater than the maximum (20).\n" );
+  }
 }
 
 // This private method returns true if the Room is within the bounds of
 // the Labyrinth, and false otherwise.
-bool Labyrinth::WithinBounds( const Coordinate rm ) const
+bool Labyrinth::WithinBounds( const Coordinate rm ) const noexcept
+{
+  const bool within = rm.x < x_size_ && rm.y < y_size_;
+  if( !within )
+  {
+    LABYRINTH_INSTRUMENT_COUNT( InstrumentCounter::kBoundsFailures, 1 );
+  }
+  return within;
+}
+
+// This private method returns true if the packed Room (see
+// Room::Packed()) may be stored at the given Coordinate, and false
+// otherwise: it has no unused bits or out-of-range fields, and every Wall
+// it has broken on the edge of the Labyrinth is its exit.
+// The Coordinate must be within the Labyrinth.
+bool Labyrinth::PackedRoomFits( const Coordinate rm,
+                                const std::uint16_t packed ) const noexcept
 {
-  return( rm.x < x_size_ && rm.y < y_size_ );
+  const unsigned exit = ( packed & Room::kExitMask ) >> Room::kExitShift;
+  const unsigned inhabitant =
+    ( packed & Room::kInhabitantMask ) >> Room::kInhabitantShift;
+  const unsigned item = ( packed & Room::kItemMask ) >> Room::kItemShift;
+  const std::uint16_t used = Room::kWallMask | Room::kExitMask |
+                             Room::kInhabitantMask | Room::kItemMask;
+  if( (packed & ~used) != 0 ||
+      exit > static_cast<unsigned>(Direction::kWest) ||
+      inhabitant > static_cast<unsigned>(Inhabitant::kMirrorCracked) ||
+      item > static_cast<unsigned>(Item::kTreasureGone) )
+  {
+    return false;
+  }
+
+  // Walls which face the outside, in the layout of Room::kWallMask.
+  const unsigned edge = ( rm.y == 0 ? 0x1u : 0 ) |
+                        ( rm.x + 1 == x_size_ ? 0x2u : 0 ) |
+                        ( rm.y + 1 == y_size_ ? 0x4u : 0 ) |
+                        ( rm.x == 0 ? 0x8u : 0 );
+  const unsigned exit_wall = ( exit == 0 ? 0 : 1u << (exit - 1) );
+  const unsigned broken = ~packed & Room::kWallMask;
+  return ( broken & edge & ~exit_wall ) == 0;
 }
 
 // This private method returns true if the two Rooms are adjacent, and
@@ -0,0 +1,264 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ file contains the implementation of the LabyrinthAnalytics
+ * class, which measures the quality and difficulty of a maze.
+ *
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/room.hpp"
+#include "../include/room_row.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_analytics.hpp"
+
+constexpr unsigned MazeStats::kCorridorBuckets;
+constexpr std::uint32_t MazeStats::kUnsolved;
+constexpr std::uint8_t LabyrinthAnalytics::kOpenMask;
+constexpr std::uint8_t LabyrinthAnalytics::kMinotaur;
+constexpr std::uint8_t LabyrinthAnalytics::kWalked;
+constexpr std::uint8_t LabyrinthAnalytics::kOnSolution;
+constexpr std::uint32_t LabyrinthAnalytics::kNoParent;
+
+namespace
+{
+
+// Number of bits set in each 4-bit mask: the connections of a Room from
+// its OpenMask(), or the Walls of a Room from its Wall bits.
+const std::uint8_t kBitCount[16] =
+{
+  0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4
+};
+
+// Lowest bit set in each 4-bit mask (0 for an empty mask).
+const std::uint8_t kLowestBit[16] =
+{
+  0, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0
+};
+
+// OpenMask() of the Rooms which are straight corridors (north and south,
+// or east and west).
+constexpr std::uint8_t kNorthSouth = 0x5;
+constexpr std::uint8_t kEastWest = 0xA;
+
+}  // Local namespace
+
+// This method returns the measurements of the maze.
+// An exception is thrown if:
+//   The Labyrinth has too many Rooms to be numbered in 32 bits
+//     (length_error)
+MazeStats LabyrinthAnalytics::Analyze( const Labyrinth& l )
+{
+  const size_t x_size = l.XSize();
+  const size_t y_size = l.YSize();
+  const size_t rooms = x_size * y_size;
+  if( rooms >= kNoParent )
+  {
+    throw std::length_error( "Error: Analyze() was given a Labyrinth with "\
+      "too many Rooms to number in 32 bits.\n" );
+  }
+
+  MazeStats stats = {};
+  stats.rooms = static_cast<std::uint32_t>( rooms );
+  const std::uint32_t row_step = static_cast<std::uint32_t>( x_size );
+  steps_[0] = 0 - row_step;
+  steps_[1] = 1;
+  steps_[2] = row_step;
+  steps_[3] = 0 - 1u;
+  cells_.resize( rooms );
+
+  // The only pass over the Labyrinth: copies what the rest needs, and
+  // counts what each Room shows on its own.
+  std::uint32_t corridor_rooms = 0;
+  std::uint32_t turns = 0;
+  std::uint8_t* cell = cells_.data();
+  for( size_t y = 0; y < y_size; ++y )
+  {
+    const RoomRow row = l.RowAt( y );
+    for( size_t x = 0; x < x_size; ++x, ++cell )
+    {
+      const Room& rm = row[x];
+      const std::uint8_t open = rm.OpenMask();
+      const unsigned connections = kBitCount[open];
+      *cell = open;
+      if( rm.GetInhabitant() == Inhabitant::kMinotaur )
+      {
+        *cell = static_cast<std::uint8_t>( *cell | kMinotaur );
+      }
+
+      stats.dead_ends += kBitCount[rm.Packed() & Room::kWallMask] == 3;
+      stats.junctions += connections >= 3;
+      if( connections == 2 )
+      {
+        ++corridor_rooms;
+        turns += open != kNorthSouth && open != kEastWest;
+      }
+    }
+  }
+
+  MeasureCorridors( stats );
+
+  stats.solution_length = MazeStats::kUnsolved;
+  if( l.TreasureSet() && l.ExitSet() )
+  {
+    const Coordinate treasure = l.GetTreasure();
+    const Coordinate spawn = l.GetSpawn1();
+    const Coordinate exit = l.GetExit();
+    const std::uint32_t t =
+      static_cast<std::uint32_t>( treasure.y * x_size + treasure.x );
+    const std::uint32_t s =
+      static_cast<std::uint32_t>( spawn.y * x_size + spawn.x );
+    const std::uint32_t e =
+      static_cast<std::uint32_t>( exit.y * x_size + exit.x );
+
+    Search( t );
+    if( parent_[s] != kNoParent && parent_[e] != kNoParent )
+    {
+      // queue_ is reused for the Rooms on the solution.
+      queue_.clear();
+      stats.solution_length = MarkPath( s, stats ) + MarkPath( e, stats );
+      for( const std::uint32_t i : queue_ )
+      {
+        for( unsigned open = cells_[i] & kOpenMask; open != 0;
+             open &= open - 1 )
+        {
+          if( !(cells_[Neighbour(i, kLowestBit[open])] & kOnSolution) )
+          {
+            ++stats.side_branches;
+          }
+        }
+      }
+      stats.branching_factor = static_cast<float>( stats.side_branches ) /
+                               static_cast<float>( stats.solution_rooms );
+    }
+  }
+
+  stats.river = static_cast<float>( corridor_rooms ) /
+                static_cast<float>( rooms );
+  if( corridor_rooms > 0 )
+  {
+    stats.turn_ratio = static_cast<float>( turns ) /
+                       static_cast<float>( corridor_rooms );
+  }
+  return stats;
+}
+
+// PRIVATE METHODS:
+
+// This private method returns the index of the Room next to Room i in
+// direction d (bit d of kOpenMask), which must be open.
+std::uint32_t LabyrinthAnalytics::Neighbour( const std::uint32_t i,
+                                             const unsigned d ) const
+{
+  return i + steps_[d];
+}
+
+// This private method measures every corridor which ends at a Room
+// without 2 connections, walking each from one end to the other.
+void LabyrinthAnalytics::MeasureCorridors( MazeStats& stats )
+{
+  const std::uint32_t rooms = stats.rooms;
+  for( std::uint32_t i = 0; i < rooms; ++i )
+  {
+    unsigned open = cells_[i] & kOpenMask;
+    if( kBitCount[open] == 2 )
+    {
+      continue;
+    }
+
+    for( ; open != 0; open &= open - 1 )
+    {
+      // The corridor has already been walked from its other end if its
+      // first Room is marked.
+      unsigned d = kLowestBit[open];
+      std::uint32_t current = Neighbour( i, d );
+      std::uint32_t length = 0;
+      while( kBitCount[cells_[current] & kOpenMask] == 2 &&
+             !(cells_[current] & kWalked) )
+      {
+        cells_[current] = static_cast<std::uint8_t>( cells_[current] |
+                                                     kWalked );
+        ++length;
+
+        // Leaves through the connection which does not lead back (the
+        // opposite of d is d ^ 2)
+        const unsigned ways = cells_[current] & kOpenMask &
+                              ~( 1u << (d ^ 2) );
+        d = kLowestBit[ways];
+        current = Neighbour( current, d );
+      }
+
+      if( length > 0 )
+      {
+        ++stats.corridors;
+        stats.longest_corridor = std::max( stats.longest_corridor, length );
+        unsigned bucket = 0;
+        while( bucket + 1 < MazeStats::kCorridorBuckets &&
+               length >> (bucket + 1) != 0 )
+        {
+          ++bucket;
+        }
+        ++stats.corridor_lengths[bucket];
+      }
+    }
+  }
+}
+
+// This private method searches from the Treasure to every Room it
+// reaches, leaving parent_ set.
+void LabyrinthAnalytics::Search( const std::uint32_t treasure )
+{
+  parent_.assign( cells_.size(), kNoParent );
+  queue_.clear();
+  parent_[treasure] = treasure;
+  queue_.push_back( treasure );
+
+  // The queue is never popped, so that its storage is reused.
+  for( size_t next = 0; next < queue_.size(); ++next )
+  {
+    const std::uint32_t i = queue_[next];
+    for( unsigned open = cells_[i] & kOpenMask; open != 0;
+         open &= open - 1 )
+    {
+      const std::uint32_t j = Neighbour( i, kLowestBit[open] );
+      if( parent_[j] == kNoParent )
+      {
+        parent_[j] = i;
+        queue_.push_back( j );
+      }
+    }
+  }
+}
+
+// This private method marks the path from Room i back to the Treasure as
+// on the solution (appending each Room to queue_ the first time it is
+// marked), and returns the number of steps.
+std::uint32_t LabyrinthAnalytics::MarkPath( std::uint32_t i,
+                                            MazeStats& stats )
+{
+  std::uint32_t steps = 0;
+  while( true )
+  {
+    if( !(cells_[i] & kOnSolution) )
+    {
+      cells_[i] = static_cast<std::uint8_t>( cells_[i] | kOnSolution );
+      queue_.push_back( i );
+      ++stats.solution_rooms;
+      stats.solution_minotaurs += (cells_[i] & kMinotaur) != 0;
+    }
+    if( parent_[i] == i )
+    {
+      return steps;
+    }
+    i = parent_[i];
+    ++steps;
+  }
+}
@@ -0,0 +1,171 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ file contains the implementation of the LabyrinthArena class,
+ * which hands out memory from large blocks and releases it all at once.
+ *
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+
+#include "../include/labyrinth_arena.hpp"
+
+namespace
+{
+
+// Largest alignment which an arena supports.
+constexpr size_t kMaxAlignment = alignof( std::max_align_t );
+
+// This local function returns p rounded up to the given alignment.
+unsigned char* AlignUp( unsigned char* const p, const size_t alignment );
+
+// This local function returns p rounded up to the given alignment.
+unsigned char* AlignUp( unsigned char* const p, const size_t alignment )
+{
+  const std::uintptr_t address = reinterpret_cast<std::uintptr_t>( p );
+  const std::uintptr_t aligned = (address + alignment - 1) &
+                                 ~static_cast<std::uintptr_t>( alignment - 1 );
+  return p + (aligned - address);
+}
+
+}  // Local namespace
+
+constexpr size_t LabyrinthArena::kDefaultBlockSize;
+
+// Parameterized constructor
+// No memory is allocated until the first allocation.
+// An exception is thrown if:
+//   The block size is 0 (invalid_argument)
+LabyrinthArena::LabyrinthArena( const size_t block_size ) :
+  block_size_(block_size)
+{
+  if( block_size == 0 )
+  {
+    throw std::invalid_argument( "Error: LabyrinthArena() was given a "\
+      "block size of 0.\n" );
+  }
+}
+
+// Parameterized constructor
+// The first block is the given buffer, which is not owned.
+// An exception is thrown if:
+//   buffer is null or size is 0 (invalid_argument)
+LabyrinthArena::LabyrinthArena( void* const buffer, const size_t size ) :
+  block_size_(size)
+{
+  if( buffer == nullptr || size == 0 )
+  {
+    throw std::invalid_argument( "Error: LabyrinthArena() was given an "\
+      "empty buffer.\n" );
+  }
+  first_ = static_cast<unsigned char*>( buffer );
+  first_size_ = size;
+  Release();
+}
+
+// Destructor
+LabyrinthArena::~LabyrinthArena()
+{
+  FreeExtraBlocks();
+  if( owns_first_ )
+  {
+    ::operator delete( first_ );
+  }
+}
+
+// This method returns bytes of memory with the given alignment.
+// An exception is thrown if:
+//   The alignment is not a power of 2, or is too large
+//     (invalid_argument)
+//   A block cannot be allocated (bad_alloc)
+void* LabyrinthArena::Allocate( const size_t bytes, const size_t alignment )
+{
+  if( alignment == 0 || (alignment & (alignment - 1)) != 0 ||
+      alignment > kMaxAlignment )
+  {
+    throw std::invalid_argument( "Error: Allocate() was given an "\
+      "unsupported alignment.\n" );
+  }
+
+  unsigned char* p = AlignUp( next_, alignment );
+  if( next_ == nullptr || bytes > static_cast<size_t>(end_ - p) )
+  {
+    Grow( bytes );
+    p = AlignUp( next_, alignment );
+  }
+  used_ += static_cast<size_t>( p - next_ ) + bytes;
+  next_ = p + bytes;
+  return p;
+}
+
+// This method makes every byte of the arena available again.
+void LabyrinthArena::Release()
+{
+  FreeExtraBlocks();
+  begin_ = first_;
+  end_ = first_ + first_size_;
+  next_ = first_;
+  used_ = 0;
+}
+
+// This method returns the number of bytes allocated since the last
+// Release(), including padding for alignment.
+size_t LabyrinthArena::BytesUsed() const
+{
+  return used_;
+}
+
+// This method returns the number of blocks currently held.
+size_t LabyrinthArena::Blocks() const
+{
+  return (first_ != nullptr ? 1 : 0) + blocks_;
+}
+
+// PRIVATE METHODS:
+
+// This private method makes a new block current, large enough for the
+// given number of bytes at any supported alignment.
+void LabyrinthArena::Grow( const size_t bytes )
+{
+  const size_t size = std::max( block_size_, bytes + kMaxAlignment );
+  if( first_ == nullptr )
+  {
+    first_ = static_cast<unsigned char*>( ::operator new(size) );
+    first_size_ = size;
+    owns_first_ = true;
+    begin_ = first_;
+  }
+  else
+  {
+    // The header is padded so that the usable bytes start aligned.
+    const size_t header = (sizeof(Block) + kMaxAlignment - 1) /
+                          kMaxAlignment * kMaxAlignment;
+    Block* const b =
+      static_cast<Block*>( ::operator new(header + size) );
+    b->previous = extra_;
+    b->size = size;
+    extra_ = b;
+    ++blocks_;
+    begin_ = reinterpret_cast<unsigned char*>( b ) + header;
+  }
+  end_ = begin_ + size;
+  next_ = begin_;
+}
+
+// This private method frees the blocks allocated after the first.
+void LabyrinthArena::FreeExtraBlocks()
+{
+  while( extra_ != nullptr )
+  {
+    Block* const previous = extra_->previous;
+    ::operator delete( extra_ );
+    extra_ = previous;
+  }
+  blocks_ = 0;
+}
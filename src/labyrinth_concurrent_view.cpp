@@ -0,0 +1,314 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ file contains the implementation of the LabyrinthConcurrentView
+ * class, a copy of the Rooms of a Labyrinth which other threads can read
+ * while the game thread changes the Labyrinth.
+ *
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/room.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_observer.hpp"
+#include "../include/labyrinth_concurrent_view.hpp"
+
+static_assert( ATOMIC_SHORT_LOCK_FREE == 2 && ATOMIC_LLONG_LOCK_FREE == 2,
+               "Readers of a LabyrinthConcurrentView must never block." );
+
+namespace
+{
+
+// The exit and the Treasure are packed as:
+//   Bits 0-15:  y-coordinate
+//   Bits 16-31: x-coordinate
+//   Bits 32-34: Direction (the exit only)
+//   Bit 63:     Set
+// Coordinates of a Labyrinth are at most 65535.
+constexpr std::uint64_t kSetBit = std::uint64_t( 1 ) << 63;
+
+// This local function returns l.
+// An exception is thrown if:
+//   l is null (invalid_argument)
+const Labyrinth* CheckLabyrinth( const Labyrinth* const l );
+
+// This local function returns the packed form of a Room and Direction.
+std::uint64_t Pack( const Coordinate rm, const Direction d );
+
+// This local function returns the Room of a packed word.
+Coordinate UnpackRoom( const std::uint64_t packed );
+
+// This local function returns the Direction of a packed word.
+Direction UnpackDirection( const std::uint64_t packed );
+
+// This local function returns l.
+// An exception is thrown if:
+//   l is null (invalid_argument)
+const Labyrinth* CheckLabyrinth( const Labyrinth* const l )
+{
+  if( l == nullptr )
+  {
+    throw std::invalid_argument( "Error: LabyrinthConcurrentView() was "\
+      "given an invalid (null) pointer for the Labyrinth.\n" );
+  }
+  return l;
+}
+
+// This local function returns the packed form of a Room and Direction.
+std::uint64_t Pack( const Coordinate rm, const Direction d )
+{
+  return kSetBit | ( static_cast<std::uint64_t>(d) << 32 ) |
+         ( static_cast<std::uint64_t>(rm.x) << 16 ) |
+         static_cast<std::uint64_t>( rm.y );
+}
+
+// This local function returns the Room of a packed word.
+Coordinate UnpackRoom( const std::uint64_t packed )
+{
+  return Coordinate( (packed >> 16) & 0xFFFF, packed & 0xFFFF );
+}
+
+// This local function returns the Direction of a packed word.
+Direction UnpackDirection( const std::uint64_t packed )
+{
+  return static_cast<Direction>( (packed >> 32) & 0x7 );
+}
+
+}  // Local namespace
+
+// Parameterized constructor
+// Only the game thread may construct the view, as it observes l.
+// An exception is thrown if:
+//   l is null (invalid_argument)
+LabyrinthConcurrentView::LabyrinthConcurrentView( const Labyrinth* const l )
+  :
+  l_(CheckLabyrinth(l)),
+  x_size_(l->XSize()),
+  y_size_(l->YSize()),
+  rooms_(new std::atomic<std::uint16_t>[x_size_ * y_size_]),
+  exit_(0),
+  treasure_(0),
+  sequence_(0)
+{
+  AllRoomsChanged();
+  l_->AddObserver( this );
+}
+
+// Destructor
+LabyrinthConcurrentView::~LabyrinthConcurrentView()
+{
+  l_->RemoveObserver( this );
+}
+
+// READERS:
+
+// These methods return the number of Rooms along each axis.
+size_t LabyrinthConcurrentView::XSize() const
+{
+  return x_size_;
+}
+
+size_t LabyrinthConcurrentView::YSize() const
+{
+  return y_size_;
+}
+
+// This method returns a copy of the Room at the given Coordinate.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+Room LabyrinthConcurrentView::RoomAt( const Coordinate rm ) const
+{
+  return Room::FromPacked(
+    rooms_[IndexOf(rm, "RoomAt")].load(std::memory_order_relaxed) );
+}
+
+// These methods are the same as those of Labyrinth.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+//   Direction d is kNone (invalid_argument)
+Inhabitant LabyrinthConcurrentView::GetInhabitant( const Coordinate rm ) const
+{
+  return Room::FromPacked( rooms_[IndexOf(rm, "GetInhabitant")].load(
+    std::memory_order_relaxed) ).GetInhabitant();
+}
+
+Item LabyrinthConcurrentView::ItemAt( const Coordinate rm ) const
+{
+  return Room::FromPacked( rooms_[IndexOf(rm, "ItemAt")].load(
+    std::memory_order_relaxed) ).GetItem();
+}
+
+RoomBorder LabyrinthConcurrentView::DirectionCheck( const Coordinate rm,
+                                                    const Direction d ) const
+{
+  const size_t i = IndexOf( rm, "DirectionCheck" );
+  if( d == Direction::kNone )
+  {
+    throw std::invalid_argument( "Error: DirectionCheck() was given an "\
+      "invalid direction (kNone).\n" );
+  }
+  return Room::FromPacked( rooms_[i].load(std::memory_order_relaxed) )
+    .DirectionCheckUnchecked( d );
+}
+
+// This method stores the Room with the Treasure in rm and returns true if
+// the Treasure is in a Room, and returns false otherwise.
+bool LabyrinthConcurrentView::TryGetTreasure( Coordinate& rm ) const
+{
+  const std::uint64_t packed = treasure_.load( std::memory_order_relaxed );
+  if( !(packed & kSetBit) )
+  {
+    return false;
+  }
+  rm = UnpackRoom( packed );
+  return true;
+}
+
+// This method stores the Room with the exit and its Direction, and returns
+// true if the exit is set, and returns false otherwise.
+bool LabyrinthConcurrentView::TryGetExit( Coordinate& rm, Direction& d ) const
+{
+  const std::uint64_t packed = exit_.load( std::memory_order_relaxed );
+  if( !(packed & kSetBit) )
+  {
+    return false;
+  }
+  rm = UnpackRoom( packed );
+  d = UnpackDirection( packed );
+  return true;
+}
+
+// This method returns the number of changes copied into the view.
+std::uint64_t LabyrinthConcurrentView::Version() const
+{
+  return sequence_.load( std::memory_order_acquire ) / 2;
+}
+
+// This method copies the whole view, as it was at one moment, into
+// snapshot (whose storage is reused).
+//
+// The copy is retried if the sequence number was odd (a change was being
+// copied) or changed while copying; the game thread is never waited for.
+void LabyrinthConcurrentView::Snapshot( LabyrinthViewSnapshot& snapshot )
+  const
+{
+  const size_t rooms = x_size_ * y_size_;
+  snapshot.rooms.resize( rooms );
+  for( ;; )
+  {
+    const std::uint64_t before = sequence_.load( std::memory_order_acquire );
+    if( before & 1 )
+    {
+      std::this_thread::yield();
+      continue;
+    }
+
+    for( size_t i = 0; i < rooms; ++i )
+    {
+      snapshot.rooms[i] =
+        Room::FromPacked( rooms_[i].load(std::memory_order_relaxed) );
+    }
+    const std::uint64_t exit = exit_.load( std::memory_order_relaxed );
+    const std::uint64_t treasure = treasure_.load( std::memory_order_relaxed );
+
+    std::atomic_thread_fence( std::memory_order_acquire );
+    if( sequence_.load(std::memory_order_relaxed) != before )
+    {
+      continue;
+    }
+
+    snapshot.exit_set = ( exit & kSetBit ) != 0;
+    snapshot.exit = UnpackRoom( exit );
+    snapshot.exit_direction = snapshot.exit_set ? UnpackDirection( exit ) :
+                                                  Direction::kNone;
+    snapshot.treasure_set = ( treasure & kSetBit ) != 0;
+    snapshot.treasure = UnpackRoom( treasure );
+    snapshot.version = before / 2;
+    return;
+  }
+}
+
+// GAME THREAD:
+
+// This method copies the given Room, the exit and the Treasure into the
+// view.
+void LabyrinthConcurrentView::RoomChanged( const Coordinate rm )
+{
+  BeginWrite();
+  rooms_[rm.y * x_size_ + rm.x].store( l_->RoomAtUnchecked(rm).Packed(),
+                                       std::memory_order_relaxed );
+  CopySpecialRooms();
+  EndWrite();
+}
+
+// This method copies every Room, the exit and the Treasure into the view.
+void LabyrinthConcurrentView::AllRoomsChanged()
+{
+  BeginWrite();
+  size_t i = 0;
+  for( size_t y = 0; y < y_size_; ++y )
+  {
+    for( const Room& rm : l_->RowAt(y) )
+    {
+      rooms_[i++].store( rm.Packed(), std::memory_order_relaxed );
+    }
+  }
+  CopySpecialRooms();
+  EndWrite();
+}
+
+// PRIVATE METHODS:
+
+// This private method returns the index of the given Room.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+size_t LabyrinthConcurrentView::IndexOf( const Coordinate rm,
+                                         const char* const caller ) const
+{
+  if( rm.x >= x_size_ || rm.y >= y_size_ )
+  {
+    throw std::domain_error( std::string("Error: ") + caller +
+      "() was given a Coordinate outside of the Labyrinth.\n" );
+  }
+  return rm.y * x_size_ + rm.x;
+}
+
+// These private methods begin and end a change, around which readers of
+// Snapshot() retry.
+// Only the game thread writes, so the sequence number is read and stored
+// rather than incremented atomically. The release fence keeps the copies
+// of the change from being seen before the odd sequence number.
+void LabyrinthConcurrentView::BeginWrite()
+{
+  const std::uint64_t s = sequence_.load( std::memory_order_relaxed );
+  sequence_.store( s + 1, std::memory_order_relaxed );
+  std::atomic_thread_fence( std::memory_order_release );
+}
+
+void LabyrinthConcurrentView::EndWrite()
+{
+  const std::uint64_t s = sequence_.load( std::memory_order_relaxed );
+  sequence_.store( s + 1, std::memory_order_release );
+}
+
+// This private method copies the exit and the Treasure into the view.
+void LabyrinthConcurrentView::CopySpecialRooms()
+{
+  exit_.store( l_->ExitSet() ?
+               Pack( l_->GetExit(), l_->GetExitDirection() ) : 0,
+               std::memory_order_relaxed );
+  treasure_.store( l_->TreasureSet() ?
+                   Pack( l_->GetTreasure(), Direction::kNone ) : 0,
+                   std::memory_order_relaxed );
+}
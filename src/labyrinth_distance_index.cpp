@@ -0,0 +1,434 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ file contains the implementation of the LabyrinthDistanceIndex
+ * class, which precomputes distances between the Rooms of a Labyrinth so
+ * that repeated distance queries are fast.
+ *
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/room.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_graph.hpp"
+#include "../include/labyrinth_distance_index.hpp"
+
+constexpr size_t LabyrinthDistanceIndex::kUnreachable;
+constexpr size_t LabyrinthDistanceIndex::kAllPairsMaxRooms;
+
+namespace
+{
+
+const std::uint32_t kFar = UINT32_MAX;
+const std::uint16_t kFarPair = UINT16_MAX;
+
+// This local function returns l.
+// An exception is thrown if:
+//   l is null (invalid_argument)
+const Labyrinth* CheckLabyrinth( const Labyrinth* const l );
+
+// This local function returns l.
+// An exception is thrown if:
+//   l is null (invalid_argument)
+const Labyrinth* CheckLabyrinth( const Labyrinth* const l )
+{
+  if( l == nullptr )
+  {
+    throw std::invalid_argument( "Error: LabyrinthDistanceIndex() was given "\
+      "an invalid (null) pointer for the Labyrinth.\n" );
+  }
+  return l;
+}
+
+}  // Local namespace
+
+// Parameterized constructor
+// landmarks is the number of landmark Rooms used for kLandmarks.
+// An exception is thrown if:
+//   l is null (invalid_argument)
+//   landmarks is 0 (invalid_argument)
+//   The Labyrinth has too many Rooms to be numbered in 32 bits
+//     (length_error)
+LabyrinthDistanceIndex::LabyrinthDistanceIndex( const Labyrinth* const l,
+                                                const size_t landmarks ) :
+  l_(CheckLabyrinth(l)),
+  landmark_count_(landmarks),
+  graph_(l)
+{
+  if( landmarks == 0 )
+  {
+    throw std::invalid_argument( "Error: LabyrinthDistanceIndex() was given "\
+      "0 landmarks.\n" );
+  }
+}
+
+// This method builds the index now rather than on the next query.
+void LabyrinthDistanceIndex::Build()
+{
+  const size_t rooms = l_->XSize() * l_->YSize();
+
+  // Only the storage of the kind which is built is kept.
+  std::vector<std::uint16_t>().swap( all_pairs_ );
+  std::vector<std::uint32_t>().swap( parent_ );
+  std::vector<std::uint32_t>().swap( depth_ );
+  std::vector<std::uint32_t>().swap( head_ );
+  std::vector<std::uint32_t>().swap( landmarks_ );
+  std::vector<std::uint32_t>().swap( seen_ );
+  std::vector<std::uint32_t>().swap( cost_ );
+  queue_.resize( rooms );
+  graph_.Refresh();
+  version_ = l_->TopologyVersion();
+
+  if( rooms <= kAllPairsMaxRooms )
+  {
+    BuildAllPairs();
+    kind_ = DistanceIndexKind::kAllPairs;
+    return;
+  }
+
+  // A perfect maze has exactly (Rooms - 1) connections reaching every Room.
+  if( graph_.Connections() == rooms - 1 )
+  {
+    depth_.resize( rooms );
+    if( BreadthFirst(0, depth_.data()) == rooms )
+    {
+      BuildTree();
+      kind_ = DistanceIndexKind::kTree;
+      return;
+    }
+    std::vector<std::uint32_t>().swap( depth_ );
+  }
+
+  BuildLandmarks();
+  kind_ = DistanceIndexKind::kLandmarks;
+}
+
+// This method returns the kind of index which was last built.
+DistanceIndexKind LabyrinthDistanceIndex::Kind() const
+{
+  return kind_;
+}
+
+// This method returns true if the index has not been built for the
+// current layout of the Labyrinth.
+bool LabyrinthDistanceIndex::Stale() const
+{
+  return kind_ == DistanceIndexKind::kNone ||
+         version_ != l_->TopologyVersion();
+}
+
+// This method returns the number of steps between the given Rooms, or
+// kUnreachable if there is no path.
+// An exception is thrown if:
+//   One or both Rooms are outside the Labyrinth (domain_error)
+size_t LabyrinthDistanceIndex::Distance( const Coordinate start,
+                                         const Coordinate goal )
+{
+  const std::uint32_t s = IndexOf( start, "Distance" );
+  const std::uint32_t g = IndexOf( goal, "Distance" );
+  Refresh();
+  return IndexDistance( s, g );
+}
+
+// This method returns the number of steps from the given Room to the
+// Room with the exit, or kUnreachable if there is no path.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+//   The exit has not been set (logic_error)
+size_t LabyrinthDistanceIndex::DistanceToExit( const Coordinate start )
+{
+  const std::uint32_t s = IndexOf( start, "DistanceToExit" );
+  const std::uint32_t g = IndexOf( l_->GetExit(), "DistanceToExit" );
+  Refresh();
+  return IndexDistance( s, g );
+}
+
+// This method returns the number of steps from the given Room to the
+// closest of the targets, or kUnreachable if none can be reached.
+// An exception is thrown if:
+//   Any Room is outside the Labyrinth (domain_error)
+size_t LabyrinthDistanceIndex::NearestDistance(
+  const Coordinate start,
+  const std::vector<Coordinate>& targets )
+{
+  const std::uint32_t s = IndexOf( start, "NearestDistance" );
+  for( const Coordinate& rm : targets )
+  {
+    IndexOf( rm, "NearestDistance" );
+  }
+  Refresh();
+
+  size_t nearest = kUnreachable;
+  for( const Coordinate& rm : targets )
+  {
+    nearest = std::min( nearest,
+                        IndexDistance(s, IndexOf(rm, "NearestDistance")) );
+  }
+  return nearest;
+}
+
+// PRIVATE METHODS:
+
+// This private method rebuilds the index if it is stale.
+void LabyrinthDistanceIndex::Refresh()
+{
+  if( Stale() )
+  {
+    Build();
+  }
+}
+
+// This private method returns the distance between Rooms s and g.
+size_t LabyrinthDistanceIndex::IndexDistance( const std::uint32_t s,
+                                              const std::uint32_t g )
+{
+  switch( kind_ )
+  {
+    case DistanceIndexKind::kAllPairs:
+    {
+      const std::uint16_t d = all_pairs_[s * queue_.size() + g];
+      return d == kFarPair ? kUnreachable : d;
+    }
+
+    case DistanceIndexKind::kTree:
+    {
+      std::uint32_t u = s;
+      std::uint32_t v = g;
+      while( head_[u] != head_[v] )
+      {
+        if( depth_[head_[u]] > depth_[head_[v]] )
+        {
+          u = parent_[head_[u]];
+        }
+        else
+        {
+          v = parent_[head_[v]];
+        }
+      }
+      const std::uint32_t ancestor = depth_[u] < depth_[v] ? u : v;
+      return static_cast<size_t>( depth_[s] ) + depth_[g] -
+             2 * static_cast<size_t>( depth_[ancestor] );
+    }
+
+    default:
+      return LandmarkSearch( s, g );
+  }
+}
+
+// These private methods build each kind of index.
+void LabyrinthDistanceIndex::BuildAllPairs()
+{
+  const size_t rooms = queue_.size();
+  all_pairs_.resize( rooms * rooms );
+  std::vector<std::uint32_t> distance( rooms );
+  for( size_t s = 0; s < rooms; ++s )
+  {
+    BreadthFirst( static_cast<std::uint32_t>(s), distance.data() );
+    for( size_t g = 0; g < rooms; ++g )
+    {
+      all_pairs_[s * rooms + g] = distance[g] == kFar ?
+                                  kFarPair :
+                                  static_cast<std::uint16_t>( distance[g] );
+    }
+  }
+}
+
+// depth_ and queue_ hold the breadth-first search from Room 0.
+void LabyrinthDistanceIndex::BuildTree()
+{
+  const size_t rooms = queue_.size();
+  parent_.resize( rooms );
+  head_.resize( rooms );
+
+  // In a tree, the only neighbour one step closer to the root is the parent.
+  parent_[0] = 0;
+  for( size_t k = 1; k < rooms; ++k )
+  {
+    const std::uint32_t i = queue_[k];
+    for( const std::uint32_t j : graph_.Neighbours(i) )
+    {
+      if( depth_[j] + 1 == depth_[i] )
+      {
+        parent_[i] = j;
+      }
+    }
+  }
+
+  // Each Room continues the heavy path of its parent if it has the largest
+  // subtree of its siblings, so any path crosses O(log n) heavy paths.
+  std::vector<std::uint32_t> subtree( rooms, 1 );
+  std::vector<std::uint32_t> heavy( rooms, kFar );
+  for( size_t k = rooms - 1; k > 0; --k )
+  {
+    const std::uint32_t i = queue_[k];
+    const std::uint32_t p = parent_[i];
+    subtree[p] += subtree[i];
+    if( heavy[p] == kFar || subtree[i] > subtree[heavy[p]] )
+    {
+      heavy[p] = i;
+    }
+  }
+
+  head_[0] = 0;
+  for( size_t k = 1; k < rooms; ++k )
+  {
+    const std::uint32_t i = queue_[k];
+    head_[i] = heavy[parent_[i]] == i ? head_[parent_[i]] : i;
+  }
+}
+
+// Landmarks are chosen one at a time as the Room farthest from all of the
+// previous landmarks, which spreads them around the edges of the maze.
+void LabyrinthDistanceIndex::BuildLandmarks()
+{
+  const size_t rooms = queue_.size();
+  landmarks_.resize( landmark_count_ * rooms );
+  seen_.assign( rooms, 0 );
+  cost_.resize( rooms );
+  query_ = 0;
+
+  std::vector<std::uint32_t> closest( rooms );
+  BreadthFirst( 0, closest.data() );
+  for( size_t k = 0; k < landmark_count_; ++k )
+  {
+    const std::uint32_t landmark = static_cast<std::uint32_t>(
+      std::max_element(closest.begin(), closest.end()) - closest.begin() );
+    std::uint32_t* const distance = &landmarks_[k * rooms];
+    BreadthFirst( landmark, distance );
+    for( size_t i = 0; i < rooms; ++i )
+    {
+      closest[i] = std::min( closest[i], distance[i] );
+    }
+  }
+}
+
+// This private method searches from Room s with A*, using the
+// landmarks for the estimate of the distance to Room g.
+//
+// By the triangle inequality, |d(L, i) - d(L, g)| never overestimates the
+// distance from Room i to Room g for any landmark L.
+size_t LabyrinthDistanceIndex::LandmarkSearch( const std::uint32_t s,
+                                               const std::uint32_t g )
+{
+  const size_t rooms = queue_.size();
+  active_.clear();
+  for( size_t k = 0; k < landmark_count_; ++k )
+  {
+    const std::uint32_t to_s = landmarks_[k * rooms + s];
+    const std::uint32_t to_g = landmarks_[k * rooms + g];
+    if( (to_s == kFar) != (to_g == kFar) )
+    {
+      return kUnreachable;  // s and g are in different parts of the maze
+    }
+    else if( to_s != kFar )
+    {
+      active_.push_back( static_cast<std::uint32_t>(k) );
+    }
+  }
+
+  auto estimate = [&]( const std::uint32_t i ) -> std::uint64_t
+  {
+    std::uint32_t best = 0;
+    for( const std::uint32_t k : active_ )
+    {
+      const std::uint32_t to_i = landmarks_[k * rooms + i];
+      const std::uint32_t to_g = landmarks_[k * rooms + g];
+      best = std::max( best, to_i > to_g ? to_i - to_g : to_g - to_i );
+    }
+    return best;
+  };
+
+  ++query_;
+  if( query_ == 0 )
+  {
+    std::fill( seen_.begin(), seen_.end(), 0 );
+    query_ = 1;
+  }
+
+  // Heap entries are (estimated total cost << 32) | Room, smallest first.
+  heap_.clear();
+  seen_[s] = query_;
+  cost_[s] = 0;
+  heap_.push_back( (estimate(s) << 32) | s );
+  while( !heap_.empty() )
+  {
+    std::pop_heap( heap_.begin(), heap_.end(),
+                   std::greater<std::uint64_t>() );
+    const std::uint64_t top = heap_.back();
+    heap_.pop_back();
+
+    const std::uint32_t i = static_cast<std::uint32_t>( top & 0xFFFFFFFFu );
+    if( (top >> 32) > cost_[i] + estimate(i) )
+    {
+      continue;  // A cheaper entry for this Room was already expanded
+    }
+    if( i == g )
+    {
+      return cost_[i];
+    }
+
+    for( const std::uint32_t j : graph_.Neighbours(i) )
+    {
+      const std::uint32_t cost = cost_[i] + 1;
+      if( seen_[j] != query_ || cost < cost_[j] )
+      {
+        seen_[j] = query_;
+        cost_[j] = cost;
+        heap_.push_back( ((cost + estimate(j)) << 32) | j );
+        std::push_heap( heap_.begin(), heap_.end(),
+                        std::greater<std::uint64_t>() );
+      }
+    }
+  }
+  return kUnreachable;
+}
+
+// This private method stores the breadth-first distance from Room s to
+// every Room in distance, with UINT32_MAX for unreachable Rooms, and
+// leaves the reached Rooms in queue_ in the order they were reached.
+// Returns the number of Rooms reached.
+size_t LabyrinthDistanceIndex::BreadthFirst( const std::uint32_t s,
+                                             std::uint32_t* distance )
+{
+  std::fill( distance, distance + queue_.size(), kFar );
+  size_t tail = 0;
+  distance[s] = 0;
+  queue_[tail++] = s;
+  for( size_t head = 0; head < tail; ++head )
+  {
+    const std::uint32_t i = queue_[head];
+    for( const std::uint32_t j : graph_.Neighbours(i) )
+    {
+      if( distance[j] == kFar )
+      {
+        distance[j] = distance[i] + 1;
+        queue_[tail++] = j;
+      }
+    }
+  }
+  return tail;
+}
+
+// This private method returns the index of the given Room.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+std::uint32_t LabyrinthDistanceIndex::IndexOf( const Coordinate rm,
+                                               const char* const caller ) const
+{
+  if( rm.x >= l_->XSize() || rm.y >= l_->YSize() )
+  {
+    throw std::domain_error( std::string("Error: ") + caller +
+      "() was given a Coordinate outside of the Labyrinth.\n" );
+  }
+  return static_cast<std::uint32_t>( rm.y * l_->XSize() + rm.x );
+}
@@ -0,0 +1,498 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ file contains the implementation of the LabyrinthFile class,
+ * which saves and loads Labyrinths in a compact binary format, and the
+ * LabyrinthFileSink class, which writes a streamed maze in the same format.
+ *
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "../include/room_properties.hpp"
+#include "../include/room.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_stream.hpp"
+#include "../include/labyrinth_file.hpp"
+
+constexpr std::uint32_t LabyrinthFile::kMagic;
+constexpr std::uint16_t LabyrinthFile::kVersion;
+constexpr size_t LabyrinthFile::kHeaderSize;
+
+namespace
+{
+
+// The header of a Labyrinth file, as it is stored.
+struct FileHeader
+{
+  std::uint32_t magic;
+  std::uint16_t version;
+  std::uint16_t header_size;
+  std::uint32_t x_size;
+  std::uint32_t y_size;
+  std::uint8_t mode;
+  std::uint8_t flags;
+  std::uint8_t exit_direction;
+  std::uint8_t reserved_byte;
+  std::uint32_t spawn_1[2];
+  std::uint32_t spawn_2[2];
+  std::uint32_t exit[2];
+  std::uint32_t treasure[2];
+  std::uint32_t reserved[3];
+};
+
+static_assert( sizeof(FileHeader) == LabyrinthFile::kHeaderSize,
+               "The header of a Labyrinth file must stay 64 bytes." );
+
+// Bits of FileHeader::flags.
+constexpr std::uint8_t kExitSetFlag = 0x1;
+constexpr std::uint8_t kTreasureSetFlag = 0x2;
+
+// Largest size of a LabyrinthMode::kSmall Labyrinth written by a sink.
+constexpr size_t kSmallMaxSize = 20;
+
+// This local function returns a value with its byte order reversed.
+std::uint32_t ByteSwap( const std::uint32_t value );
+
+// This local function returns the number of bytes of a file with the given
+// sizes, or 0 if it cannot be represented.
+size_t FileSize( const size_t x_size, const size_t y_size );
+
+// This local function returns a value with its byte order reversed.
+std::uint32_t ByteSwap( const std::uint32_t value )
+{
+  return ( value >> 24 ) | ( (value >> 8) & 0xFF00 ) |
+         ( (value << 8) & 0xFF0000 ) | ( value << 24 );
+}
+
+// This local function returns the number of bytes of a file with the given
+// sizes, or 0 if it cannot be represented.
+size_t FileSize( const size_t x_size, const size_t y_size )
+{
+  const size_t max_rooms =
+    ( static_cast<size_t>(-1) - LabyrinthFile::kHeaderSize ) / sizeof(Room);
+  if( y_size != 0 && x_size > max_rooms / y_size )
+  {
+    return 0;
+  }
+  return LabyrinthFile::kHeaderSize + x_size * y_size * sizeof(Room);
+}
+
+}  // Local namespace
+
+// This method writes the Labyrinth to the file at the given path,
+// replacing it if it exists.
+// An exception is thrown if:
+//   The file cannot be written (runtime_error)
+void LabyrinthFile::Save( const Labyrinth& l, const std::string& path )
+{
+  std::ofstream file( path, std::ios::binary | std::ios::trunc );
+  if( !file )
+  {
+    throw std::runtime_error( "Error: Save() could not open the file.\n" );
+  }
+
+  LabyrinthStreamInfo info;
+  info.x_size = l.x_size_;
+  info.y_size = l.y_size_;
+  info.spawn_1 = l.spawn_1_;
+  info.spawn_2 = l.spawn_2_;
+  info.exit_set = l.exit_set_;
+  if( l.exit_set_ )
+  {
+    info.exit = l.exit_;
+    info.exit_direction = l.GetExitDirection();
+  }
+  info.treasure_set = l.treasure_set_;
+  if( l.treasure_set_ )
+  {
+    info.treasure = l.treasure_;
+  }
+
+  WriteHeader( file, info, l.mode_ );
+  for( size_t y = 0; y < l.y_size_; ++y )
+  {
+    WriteRooms( file, l.RowAt(y).begin(), l.x_size_ );
+  }
+
+  file.flush();
+  if( !file )
+  {
+    throw std::runtime_error( "Error: Save() could not write the file.\n" );
+  }
+}
+
+// This method reads the file at the given path into a new Labyrinth.
+// In LabyrinthMode::kLarge, bands of walled, empty Rooms are not
+// allocated.
+// An exception is thrown if:
+//   The file cannot be read (runtime_error)
+//   The file is not a Labyrinth file of this version, or is truncated
+//     (runtime_error)
+//   A Room has unused bits set or an invalid field, or a broken Wall
+//     other than the exit on the edge of the Labyrinth (runtime_error)
+//   The exit or Treasure of the header is not the only one in the
+//     Rooms (runtime_error)
+//   The header has an invalid size, spawn, exit or Treasure
+//     (domain_error)
+Labyrinth LabyrinthFile::Load( const std::string& path )
+{
+  std::ifstream file( path, std::ios::binary | std::ios::ate );
+  if( !file )
+  {
+    throw std::runtime_error( "Error: Load() could not open the file.\n" );
+  }
+  const std::streamoff size = file.tellg();
+  file.seekg( 0 );
+
+  unsigned char header[kHeaderSize] = {};
+  file.read( reinterpret_cast<char*>(header), kHeaderSize );
+  Labyrinth l = ReadHeader( header,
+                            size < 0 ? 0 : static_cast<size_t>(size),
+                            "Load" );
+
+  // Rooms are read a band at a time, and only kept if they differ from
+  // walled, empty Rooms.
+  const size_t band_rows = ( l.mode_ == LabyrinthMode::kSmall ?
+                             l.y_size_ : Labyrinth::kBandRows );
+  // Each Room is checked as it is read, since it is stored without
+  // checking; the exit and Treasure must each be in exactly the Room the
+  // header gives.
+  std::vector<Room> band( band_rows * l.x_size_ );
+  size_t exits = 0;
+  size_t treasures = 0;
+  Coordinate exit;
+  Coordinate treasure;
+  for( size_t y = 0; y < l.y_size_; y += band_rows )
+  {
+    const size_t rows = std::min( band_rows, l.y_size_ - y );
+    const size_t count = rows * l.x_size_;
+    file.read( reinterpret_cast<char*>(band.data()), count * sizeof(Room) );
+    if( !file )
+    {
+      throw std::runtime_error( "Error: Load() could not read the file.\n" );
+    }
+
+    const Room* rm = band.data();
+    for( size_t row = 0; row < rows; ++row )
+    {
+      for( size_t x = 0; x < l.x_size_; ++x, ++rm )
+      {
+        const Coordinate c( x, y + row );
+        const std::uint16_t packed = rm->Packed();
+        if( !l.PackedRoomFits(c, packed) )
+        {
+          throw std::runtime_error( "Error: Load() was given a file with "\
+            "an invalid Room, or a Room open to the outside.\n" );
+        }
+        if( packed & Room::kExitMask )
+        {
+          ++exits;
+          exit = c;
+        }
+        if( rm->GetItem() == Item::kTreasure )
+        {
+          ++treasures;
+          treasure = c;
+        }
+      }
+    }
+
+    const bool blank = std::all_of( band.begin(), band.begin() + count,
+      []( const Room& rm ) { return rm.Packed() == Room::kWallMask; } );
+    if( l.mode_ == LabyrinthMode::kSmall || !blank )
+    {
+      std::copy( band.begin(), band.begin() + count, l.MutableRowAt(y) );
+    }
+  }
+
+  if( exits != (l.exit_set_ ? 1u : 0u) ||
+      ( l.exit_set_ && !(exit == l.exit_) ) ||
+      treasures != (l.treasure_set_ ? 1u : 0u) ||
+      ( l.treasure_set_ && !(treasure == l.treasure_) ) )
+  {
+    throw std::runtime_error( "Error: Load() was given a file whose exit "\
+      "or Treasure does not match its Rooms.\n" );
+  }
+  return l;
+}
+
+// This method maps the file at the given path into memory and returns a
+// Labyrinth which reads its Rooms directly from the file, without
+// copying them.
+// An exception is thrown if:
+//   The file cannot be read or mapped (runtime_error)
+//   The file is not a Labyrinth file of this version, or is truncated
+//     (runtime_error)
+//   A Room on the edge of the Labyrinth has unused bits set, an invalid
+//     field, or a broken Wall other than the exit on the edge
+//     (runtime_error)
+//   The Room at the exit or Treasure of the header has no exit or
+//     Treasure (runtime_error)
+//   The header has an invalid size, spawn, exit or Treasure
+//     (domain_error)
+Labyrinth LabyrinthFile::Map( const std::string& path )
+{
+  const int fd = open( path.c_str(), O_RDONLY );
+  if( fd < 0 )
+  {
+    throw std::runtime_error( "Error: Map() could not open the file.\n" );
+  }
+
+  struct stat status;
+  if( fstat(fd, &status) != 0 || status.st_size <= 0 )
+  {
+    close( fd );
+    throw std::runtime_error( "Error: Map() was given a file which is not "\
+      "a Labyrinth file.\n" );
+  }
+  const size_t size = static_cast<size_t>( status.st_size );
+
+  void* const data = mmap( nullptr, size, PROT_READ, MAP_SHARED, fd, 0 );
+  close( fd );  // The mapping keeps the file open
+  if( data == MAP_FAILED )
+  {
+    throw std::runtime_error( "Error: Map() could not map the file.\n" );
+  }
+  std::shared_ptr<const void> mapping( data,
+    [size]( const void* const p ) { munmap( const_cast<void*>(p), size ); } );
+
+  const unsigned char* const bytes = static_cast<const unsigned char*>( data );
+  Labyrinth l = ReadHeader( bytes, size, "Map" );
+
+  // Checking every Room would read the whole file, so only those which
+  // could lead outside the Labyrinth are checked, with the exit and the
+  // Treasure.
+  const Room* const rooms =
+    reinterpret_cast<const Room*>( bytes + kHeaderSize );
+  const size_t x_size = l.x_size_;
+  const size_t y_size = l.y_size_;
+  bool edge_fits = true;
+  for( size_t x = 0; x < x_size; ++x )
+  {
+    edge_fits = edge_fits &&
+      l.PackedRoomFits( Coordinate(x, 0), rooms[x].Packed() ) &&
+      l.PackedRoomFits( Coordinate(x, y_size - 1),
+                        rooms[(y_size - 1) * x_size + x].Packed() );
+  }
+  for( size_t y = 0; y < y_size; ++y )
+  {
+    edge_fits = edge_fits &&
+      l.PackedRoomFits( Coordinate(0, y), rooms[y * x_size].Packed() ) &&
+      l.PackedRoomFits( Coordinate(x_size - 1, y),
+                        rooms[y * x_size + x_size - 1].Packed() );
+  }
+  if( !edge_fits )
+  {
+    throw std::runtime_error( "Error: Map() was given a file with an "\
+      "invalid Room, or a Room open to the outside.\n" );
+  }
+  else if( ( l.exit_set_ &&
+             !(rooms[l.exit_.y * x_size + l.exit_.x].Packed() &
+               Room::kExitMask) ) ||
+           ( l.treasure_set_ &&
+             rooms[l.treasure_.y * x_size + l.treasure_.x].GetItem() !=
+               Item::kTreasure ) )
+  {
+    throw std::runtime_error( "Error: Map() was given a file whose exit "\
+      "or Treasure does not match its Rooms.\n" );
+  }
+
+  // Rooms are read from the file until they are modified.
+  l.owned_rooms_.reset();
+  l.rooms_ = nullptr;
+  l.mapped_rooms_ = rooms;
+  l.mapping_ = std::move( mapping );
+  return l;
+}
+
+// PRIVATE METHODS:
+
+// These private methods write the header for a maze with the given
+// description and storage mode, and the given Rooms.
+// An exception is thrown if:
+//   The file cannot be written (runtime_error)
+void LabyrinthFile::WriteHeader( std::ofstream& file,
+                                 const LabyrinthStreamInfo& info,
+                                 const LabyrinthMode mode )
+{
+  FileHeader header;
+  std::memset( &header, 0, sizeof(header) );
+  header.magic = kMagic;
+  header.version = kVersion;
+  header.header_size = kHeaderSize;
+  header.x_size = static_cast<std::uint32_t>( info.x_size );
+  header.y_size = static_cast<std::uint32_t>( info.y_size );
+  header.mode = ( mode == LabyrinthMode::kSmall ? 0 : 1 );
+  header.flags = ( info.exit_set ? kExitSetFlag : 0 ) |
+                 ( info.treasure_set ? kTreasureSetFlag : 0 );
+  header.exit_direction = static_cast<std::uint8_t>( info.exit_direction );
+  header.spawn_1[0] = static_cast<std::uint32_t>( info.spawn_1.x );
+  header.spawn_1[1] = static_cast<std::uint32_t>( info.spawn_1.y );
+  header.spawn_2[0] = static_cast<std::uint32_t>( info.spawn_2.x );
+  header.spawn_2[1] = static_cast<std::uint32_t>( info.spawn_2.y );
+  header.exit[0] = static_cast<std::uint32_t>( info.exit.x );
+  header.exit[1] = static_cast<std::uint32_t>( info.exit.y );
+  header.treasure[0] = static_cast<std::uint32_t>( info.treasure.x );
+  header.treasure[1] = static_cast<std::uint32_t>( info.treasure.y );
+
+  file.write( reinterpret_cast<const char*>(&header), sizeof(header) );
+  if( !file )
+  {
+    throw std::runtime_error( "Error: WriteHeader() could not write the "\
+      "file.\n" );
+  }
+}
+
+void LabyrinthFile::WriteRooms( std::ofstream& file,
+                                const Room* const rooms,
+                                const size_t count )
+{
+  file.write( reinterpret_cast<const char*>(rooms), count * sizeof(Room) );
+  if( !file )
+  {
+    throw std::runtime_error( "Error: WriteRooms() could not write the "\
+      "file.\n" );
+  }
+}
+
+// This private method checks the header at the start of data, which
+// holds size bytes, and returns the Labyrinth it describes without any
+// Rooms connected.
+// An exception is thrown if:
+//   The header is invalid, or size is too small for every Room
+//     (runtime_error or domain_error)
+Labyrinth LabyrinthFile::ReadHeader( const unsigned char* const data,
+                                     const size_t size,
+                                     const char* const caller )
+{
+  const std::string name( caller );
+  FileHeader header;
+  if( size < kHeaderSize )
+  {
+    throw std::runtime_error( "Error: " + name + "() was given a file "\
+      "which is not a Labyrinth file.\n" );
+  }
+  std::memcpy( &header, data, sizeof(header) );
+
+  if( header.magic == ByteSwap(kMagic) )
+  {
+    throw std::runtime_error( "Error: " + name + "() was given a file "\
+      "written with a different byte order.\n" );
+  }
+  else if( header.magic != kMagic || header.header_size != kHeaderSize ||
+           header.mode > 1 )
+  {
+    throw std::runtime_error( "Error: " + name + "() was given a file "\
+      "which is not a Labyrinth file.\n" );
+  }
+  else if( header.version != kVersion )
+  {
+    throw std::runtime_error( "Error: " + name + "() was given a file "\
+      "of an unsupported version.\n" );
+  }
+
+  const size_t expected = FileSize( header.x_size, header.y_size );
+  if( expected == 0 || size < expected )
+  {
+    throw std::runtime_error( "Error: " + name + "() was given a file "\
+      "which is truncated.\n" );
+  }
+
+  Labyrinth l( header.x_size,
+               header.y_size,
+               header.mode == 0 ? LabyrinthMode::kSmall :
+                                  LabyrinthMode::kLarge );
+
+  const Coordinate spawn_1( header.spawn_1[0], header.spawn_1[1] );
+  const Coordinate spawn_2( header.spawn_2[0], header.spawn_2[1] );
+  const Coordinate exit( header.exit[0], header.exit[1] );
+  const Coordinate treasure( header.treasure[0], header.treasure[1] );
+  const bool exit_set = ( header.flags & kExitSetFlag ) != 0;
+  const bool treasure_set = ( header.flags & kTreasureSetFlag ) != 0;
+  if( !l.WithinBounds(spawn_1) || !l.WithinBounds(spawn_2) ||
+      ( exit_set && !l.WithinBounds(exit) ) ||
+      ( treasure_set && !l.WithinBounds(treasure) ) )
+  {
+    throw std::domain_error( "Error: " + name + "() was given a file with "\
+      "a spawn, exit or Treasure outside of the Labyrinth.\n" );
+  }
+
+  l.spawn_1_ = spawn_1;
+  l.spawn_2_ = spawn_2;
+  l.exit_set_ = exit_set;
+  l.exit_ = exit;
+  l.treasure_set_ = treasure_set;
+  l.treasure_ = treasure;
+  return l;
+}
+
+// LABYRINTHFILESINK:
+
+// Parameterized constructor
+// The file is created when the maze begins.
+LabyrinthFileSink::LabyrinthFileSink( const std::string& path ) :
+  path_(path)
+{
+}
+
+// An exception is thrown if:
+//   The file cannot be written (runtime_error)
+//   The maze is larger than a large Labyrinth (65536 x 65536)
+//     (domain_error)
+void LabyrinthFileSink::Begin( const LabyrinthStreamInfo& info )
+{
+  const size_t max_large_size = 65536;
+  if( info.x_size > max_large_size || info.y_size > max_large_size )
+  {
+    throw std::domain_error( "Error: Begin() was given a size greater "\
+      "than the maximum of a large Labyrinth (65536).\n" );
+  }
+
+  file_.open( path_, std::ios::binary | std::ios::trunc );
+  if( !file_ )
+  {
+    throw std::runtime_error( "Error: Begin() could not open the file.\n" );
+  }
+
+  x_size_ = info.x_size;
+  const bool small = info.x_size <= kSmallMaxSize &&
+                     info.y_size <= kSmallMaxSize;
+  LabyrinthFile::WriteHeader( file_, info, small ? LabyrinthMode::kSmall :
+                                                   LabyrinthMode::kLarge );
+}
+
+// An exception is thrown if:
+//   The file cannot be written (runtime_error)
+void LabyrinthFileSink::Rows( const size_t,
+                              const Room* const rooms,
+                              const size_t rows )
+{
+  LabyrinthFile::WriteRooms( file_, rooms, rows * x_size_ );
+}
+
+// An exception is thrown if:
+//   The file cannot be written (runtime_error)
+void LabyrinthFileSink::End()
+{
+  file_.close();
+  if( !file_ )
+  {
+    throw std::runtime_error( "Error: End() could not write the file.\n" );
+  }
+}
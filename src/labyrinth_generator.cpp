@@ -0,0 +1,472 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ file contains the implementation of the LabyrinthGenerator class,
+ * which fills a Labyrinth with a randomly generated perfect maze and places
+ * its exit, Items and Inhabitants.
+ *
+ */
+
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/room.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/eller_row_generator.hpp"
+#include "../include/labyrinth_generator.hpp"
+
+namespace
+{
+
+// Directions in the order of the Room wall bits; bit k is Direction k+1.
+const Direction kDirections[4] =
+{
+  Direction::kNorth,
+  Direction::kEast,
+  Direction::kSouth,
+  Direction::kWest,
+};
+
+const std::uint8_t kOpenNorth = 0x1;
+const std::uint8_t kOpenEast  = 0x2;
+const std::uint8_t kOpenSouth = 0x4;
+const std::uint8_t kOpenWest  = 0x8;
+
+// Marks a Room as visited/in the tree while generating; never committed.
+const std::uint8_t kVisited   = 0x80;
+
+// This local function breaks the Walls given by the open bits of a row.
+void ApplyOpen( Room* const row,
+                const std::uint8_t* const open,
+                const size_t x_size );
+
+// This local function returns the index of the Room in direction k of Room i,
+// or false if that Room would be outside the Labyrinth.
+bool Step( const size_t i,
+           const unsigned k,
+           const size_t x_size,
+           const size_t y_size,
+           size_t& out );
+
+// This local function breaks the Walls given by the open bits of a row.
+void ApplyOpen( Room* const row,
+                const std::uint8_t* const open,
+                const size_t x_size )
+{
+  for( size_t x = 0; x < x_size; ++x )
+  {
+    row[x].ClearWalls( open[x] );
+  }
+}
+
+// This local function returns the index of the Room in direction k of Room i,
+// or false if that Room would be outside the Labyrinth.
+bool Step( const size_t i,
+           const unsigned k,
+           const size_t x_size,
+           const size_t y_size,
+           size_t& out )
+{
+  const size_t x = i % x_size;
+  const size_t y = i / x_size;
+  switch( k )
+  {
+    case 0:
+      if( y == 0 ) return false;
+      out = i - x_size;
+      return true;
+    case 1:
+      if( x + 1 == x_size ) return false;
+      out = i + 1;
+      return true;
+    case 2:
+      if( y + 1 == y_size ) return false;
+      out = i + x_size;
+      return true;
+    default:
+      if( x == 0 ) return false;
+      out = i - 1;
+      return true;
+  }
+}
+
+}  // Local namespace
+
+// Parameterized constructor
+LabyrinthGenerator::LabyrinthGenerator( const GeneratorOptions& options ) :
+  options_(options),
+  rng_(options.seed)
+{
+}
+
+// This method generates a perfect maze (exactly one path between any
+// two Rooms) in the given Labyrinth, then places its contents.
+// The Labyrinth should not have any connected Rooms, an exit, or any
+// Items or Inhabitants beforehand. Checkpoints of the Labyrinth are
+// discarded.
+// An exception is thrown if:
+//   There are more Items or Inhabitants than Rooms (invalid_argument)
+//   The exit or Treasure has already been set (logic_error)
+void LabyrinthGenerator::Generate( Labyrinth& l )
+{
+  const size_t x_size = l.XSize();
+  const size_t y_size = l.YSize();
+  const size_t rooms = x_size * y_size;
+
+  const size_t items = options_.bullets + (options_.place_treasure ? 1 : 0);
+  size_t spawns = 0;
+  if( options_.place_spawns )
+  {
+    spawns = rooms > 1 ? 2 : 1;
+  }
+  if( items > rooms )
+  {
+    throw std::invalid_argument( "Error: Generate() was asked to place more "\
+      "Items than there are Rooms.\n" );
+  }
+  else if( options_.minotaurs + options_.mirrors > rooms - spawns )
+  {
+    throw std::invalid_argument( "Error: Generate() was asked to place more "\
+      "Inhabitants than there are Rooms without a spawn.\n" );
+  }
+  else if( options_.place_exit && l.ExitSet() )
+  {
+    throw std::logic_error( "Error: Generate() was asked to place an exit, "\
+      "but the exit has already been set in the Labyrinth.\n" );
+  }
+  else if( options_.place_treasure && l.TreasureSet() )
+  {
+    throw std::logic_error( "Error: Generate() was asked to place a "\
+      "Treasure, but the Treasure has already been set in the "\
+      "Labyrinth.\n" );
+  }
+
+  // Nothing has been changed before this point. The Rooms are written directly, so changes cannot be rolled back.
+  l.ReleaseCheckpoints();
+  rng_.seed( options_.seed );
+
+  if( options_.algorithm == GeneratorAlgorithm::kEller )
+  {
+    Eller( l );
+  }
+  else
+  {
+    open_.assign( rooms, 0 );
+    switch( options_.algorithm )
+    {
+      case GeneratorAlgorithm::kKruskal:
+        Kruskal( x_size, y_size );
+        break;
+      case GeneratorAlgorithm::kWilson:
+        Wilson( x_size, y_size );
+        break;
+      default:
+        RecursiveBacktracker( x_size, y_size );
+        break;
+    }
+    CommitOpen( l );
+  }
+  ++l.topology_version_;
+  l.NotifyAllRoomsChanged();
+
+  PlaceContents( l );
+}
+
+// This method changes the seed used by the next call to Generate().
+void LabyrinthGenerator::SetSeed( const std::uint64_t seed )
+{
+  options_.seed = seed;
+}
+
+// This method returns the options of the generator.
+const GeneratorOptions& LabyrinthGenerator::Options() const
+{
+  return options_;
+}
+
+// PRIVATE METHODS:
+
+// This private method returns a random number in [0, n).
+size_t LabyrinthGenerator::RandomBelow( const size_t n )
+{
+  return static_cast<size_t>( rng_() % n );
+}
+
+// This private method generates the maze into open_ with an iterative
+// depth-first search.
+void LabyrinthGenerator::RecursiveBacktracker( const size_t x_size,
+                                               const size_t y_size )
+{
+  stack_.clear();
+  const size_t start = RandomBelow( x_size * y_size );
+  open_[start] |= kVisited;
+  stack_.push_back( start );
+
+  while( !stack_.empty() )
+  {
+    const size_t i = stack_.back();
+
+    unsigned choices[4];
+    size_t neighbours[4];
+    unsigned count = 0;
+    for( unsigned k = 0; k < 4; ++k )
+    {
+      size_t j;
+      if( Step(i, k, x_size, y_size, j) && !(open_[j] & kVisited) )
+      {
+        choices[count] = k;
+        neighbours[count] = j;
+        ++count;
+      }
+    }
+
+    if( count == 0 )
+    {
+      stack_.pop_back();
+      continue;
+    }
+
+    const unsigned pick = static_cast<unsigned>( RandomBelow(count) );
+    const unsigned k = choices[pick];
+    const size_t j = neighbours[pick];
+    open_[i] |= static_cast<std::uint8_t>( 1u << k );
+    open_[j] |= static_cast<std::uint8_t>( (1u << ((k + 2) % 4)) | kVisited );
+    stack_.push_back( j );
+  }
+}
+
+// This private method generates the maze into open_ by joining Rooms
+// across randomly ordered Walls with a union-find.
+void LabyrinthGenerator::Kruskal( const size_t x_size, const size_t y_size )
+{
+  const size_t rooms = x_size * y_size;
+
+  // Each Wall is stored as (Room index * 2 + 0 for east / 1 for south).
+  edges_.clear();
+  for( size_t i = 0; i < rooms; ++i )
+  {
+    if( i % x_size + 1 < x_size )
+    {
+      edges_.push_back( i * 2 );
+    }
+    if( i / x_size + 1 < y_size )
+    {
+      edges_.push_back( i * 2 + 1 );
+    }
+  }
+  for( size_t i = edges_.size(); i > 1; --i )
+  {
+    std::swap( edges_[i - 1], edges_[RandomBelow(i)] );
+  }
+
+  parent_.resize( rooms );
+  for( size_t i = 0; i < rooms; ++i )
+  {
+    parent_[i] = i;
+  }
+
+  for( const size_t e : edges_ )
+  {
+    const size_t i = e / 2;
+    const bool south = (e % 2) == 1;
+    const size_t j = south ? i + x_size : i + 1;
+
+    const size_t root_i = FindRoot( i );
+    const size_t root_j = FindRoot( j );
+    if( root_i == root_j )
+    {
+      continue;
+    }
+    parent_[root_i] = root_j;
+
+    if( south )
+    {
+      open_[i] |= kOpenSouth;
+      open_[j] |= kOpenNorth;
+    }
+    else
+    {
+      open_[i] |= kOpenEast;
+      open_[j] |= kOpenWest;
+    }
+  }
+}
+
+// This private method generates the maze into open_ with loop-erased random
+// walks, which gives every perfect maze the same probability.
+void LabyrinthGenerator::Wilson( const size_t x_size, const size_t y_size )
+{
+  const size_t rooms = x_size * y_size;
+
+  // parent_ holds the last Direction taken out of each Room by the walk.
+  parent_.resize( rooms );
+  open_[RandomBelow(rooms)] |= kVisited;
+
+  for( size_t start = 0; start < rooms; ++start )
+  {
+    // Walk until the tree is reached; revisiting a Room overwrites its
+    // Direction, which erases the loop.
+    size_t i = start;
+    while( !(open_[i] & kVisited) )
+    {
+      unsigned k;
+      size_t j;
+      do
+      {
+        k = static_cast<unsigned>( RandomBelow(4) );
+      } while( !Step(i, k, x_size, y_size, j) );
+      parent_[i] = k;
+      i = j;
+    }
+
+    // Adds the loop-erased walk to the tree.
+    i = start;
+    while( !(open_[i] & kVisited) )
+    {
+      const unsigned k = static_cast<unsigned>( parent_[i] );
+      size_t j = i;
+      Step( i, k, x_size, y_size, j );
+      open_[i] |= static_cast<std::uint8_t>( (1u << k) | kVisited );
+      open_[j] |= static_cast<std::uint8_t>( 1u << ((k + 2) % 4) );
+      i = j;
+    }
+  }
+}
+
+// This private method generates the maze row by row, writing each row to
+// the Labyrinth as soon as it is complete.
+void LabyrinthGenerator::Eller( Labyrinth& l )
+{
+  const size_t x_size = l.XSize();
+  eller_.Reset( x_size, l.YSize() );
+  while( !eller_.Done() )
+  {
+    const size_t y = eller_.NextY();
+    ApplyOpen( l.MutableRowAt(y), eller_.NextRow(rng_), x_size );
+  }
+}
+
+// This private method breaks the Walls given in open_ in the Labyrinth.
+void LabyrinthGenerator::CommitOpen( Labyrinth& l )
+{
+  const size_t x_size = l.XSize();
+  for( size_t y = 0; y < l.YSize(); ++y )
+  {
+    ApplyOpen( l.MutableRowAt(y), &open_[y * x_size], x_size );
+  }
+}
+
+// This private method returns the union-find root of Room i, halving
+// paths along the way.
+size_t LabyrinthGenerator::FindRoot( size_t i )
+{
+  while( parent_[i] != i )
+  {
+    parent_[i] = parent_[parent_[i]];
+    i = parent_[i];
+  }
+  return i;
+}
+
+// This private method places the spawns, exit, Items and Inhabitants.
+void LabyrinthGenerator::PlaceContents( Labyrinth& l )
+{
+  const size_t x_size = l.XSize();
+  const size_t y_size = l.YSize();
+  const size_t rooms = x_size * y_size;
+
+  if( options_.place_spawns )
+  {
+    const size_t spawn_1 = RandomBelow( rooms );
+    size_t spawn_2 = spawn_1;
+    while( rooms > 1 && spawn_2 == spawn_1 )
+    {
+      spawn_2 = RandomBelow( rooms );
+    }
+    l.SetSpawn1( Coordinate(spawn_1 % x_size, spawn_1 / x_size) );
+    l.SetSpawn2( Coordinate(spawn_2 % x_size, spawn_2 / x_size) );
+  }
+
+  if( options_.place_exit )
+  {
+    // Every Room on the outside of the Labyrinth has an outer Wall.
+    const Direction d = kDirections[RandomBelow(4)];
+    Coordinate rm;
+    switch( d )
+    {
+      case Direction::kNorth:
+        rm = Coordinate( RandomBelow(x_size), 0 );
+        break;
+      case Direction::kEast:
+        rm = Coordinate( x_size - 1, RandomBelow(y_size) );
+        break;
+      case Direction::kSouth:
+        rm = Coordinate( RandomBelow(x_size), y_size - 1 );
+        break;
+      default:
+        rm = Coordinate( 0, RandomBelow(y_size) );
+        break;
+    }
+    l.SetExit( rm, d );
+  }
+
+  if( options_.place_treasure )
+  {
+    l.SetItem( RandomEmptyItemRoom(l), Item::kTreasure );
+  }
+  for( size_t i = 0; i < options_.bullets; ++i )
+  {
+    l.SetItem( RandomEmptyItemRoom(l), Item::kBullet );
+  }
+
+  for( size_t i = 0; i < options_.minotaurs; ++i )
+  {
+    l.SetInhabitant( RandomEmptyInhabitantRoom(l), Inhabitant::kMinotaur );
+  }
+  for( size_t i = 0; i < options_.mirrors; ++i )
+  {
+    l.SetInhabitant( RandomEmptyInhabitantRoom(l), Inhabitant::kMirror );
+  }
+}
+
+// This private method returns a random Room without an Item.
+Coordinate LabyrinthGenerator::RandomEmptyItemRoom( const Labyrinth& l )
+{
+  const size_t x_size = l.XSize();
+  const size_t rooms = x_size * l.YSize();
+  while( true )
+  {
+    const size_t i = RandomBelow( rooms );
+    const Coordinate rm( i % x_size, i / x_size );
+    if( l.ItemAt(rm) == Item::kNone )
+    {
+      return rm;
+    }
+  }
+}
+
+// This private method returns a random Room without an Inhabitant which
+// is not a spawn.
+Coordinate LabyrinthGenerator::RandomEmptyInhabitantRoom( const Labyrinth& l )
+{
+  const size_t x_size = l.XSize();
+  const size_t rooms = x_size * l.YSize();
+  while( true )
+  {
+    const size_t i = RandomBelow( rooms );
+    const Coordinate rm( i % x_size, i / x_size );
+    const bool is_spawn = options_.place_spawns &&
+                          ( rm == l.GetSpawn1() || rm == l.GetSpawn2() );
+    if( !is_spawn && l.GetInhabitant(rm) == Inhabitant::kNone )
+    {
+      return rm;
+    }
+  }
+}
@@ -0,0 +1,192 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ file contains the implementation of the LabyrinthGraph class,
+ * which stores the connections between the Rooms of a Labyrinth as
+ * adjacency lists.
+ *
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/room.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_graph.hpp"
+
+namespace
+{
+
+// The open Directions of a mask of Walls (in the layout of kWallMask),
+// from north to west, so a Room's moves are found with one lookup rather
+// than a test of each Wall.
+struct MaskMoves
+{
+  std::uint8_t count;
+  std::uint8_t walls[4];  // Bits of kWallMask: 0 north, 1 east, etc.
+};
+
+constexpr MaskMoves kMaskMoves[16] =
+{
+  { 0, { 0, 0, 0, 0 } },  // ----
+  { 1, { 0, 0, 0, 0 } },  // N---
+  { 1, { 1, 0, 0, 0 } },  // -E--
+  { 2, { 0, 1, 0, 0 } },  // NE--
+  { 1, { 2, 0, 0, 0 } },  // --S-
+  { 2, { 0, 2, 0, 0 } },  // N-S-
+  { 2, { 1, 2, 0, 0 } },  // -ES-
+  { 3, { 0, 1, 2, 0 } },  // NES-
+  { 1, { 3, 0, 0, 0 } },  // ---W
+  { 2, { 0, 3, 0, 0 } },  // N--W
+  { 2, { 1, 3, 0, 0 } },  // -E-W
+  { 3, { 0, 1, 3, 0 } },  // NE-W
+  { 2, { 2, 3, 0, 0 } },  // --SW
+  { 3, { 0, 2, 3, 0 } },  // N-SW
+  { 3, { 1, 2, 3, 0 } },  // -ESW
+  { 4, { 0, 1, 2, 3 } },  // NESW
+};
+
+// Directions of the bits of kWallMask.
+constexpr Direction kWallDirections[4] = { Direction::kNorth,
+                                           Direction::kEast,
+                                           Direction::kSouth,
+                                           Direction::kWest };
+
+}  // Local namespace
+
+// Parameterized constructor
+// An exception is thrown if:
+//   l is null (invalid_argument)
+//   The Labyrinth has too many Rooms to be numbered in 32 bits
+//     (length_error)
+LabyrinthGraph::LabyrinthGraph( const Labyrinth* const l ) :
+  l_(l)
+{
+  if( l == nullptr )
+  {
+    throw std::invalid_argument( "Error: LabyrinthGraph() was given an "\
+      "invalid (null) pointer for the Labyrinth.\n" );
+  }
+  Build();
+}
+
+// This method builds the graph from the current layout of the Labyrinth.
+// An exception is thrown if:
+//   The Labyrinth has too many Rooms to be numbered in 32 bits
+//     (length_error)
+void LabyrinthGraph::Build()
+{
+  const size_t x_size = l_->XSize();
+  const size_t y_size = l_->YSize();
+  if( y_size > std::numeric_limits<std::uint32_t>::max() / x_size )
+  {
+    throw std::length_error( "Error: Build() was given a Labyrinth with "\
+      "too many Rooms to number in 32 bits.\n" );
+  }
+
+  // Index differences of the neighbour through each Wall; a broken Wall
+  // always leads to another Room of the Labyrinth, so the neighbours do not
+  // need to be checked against its bounds.
+  const std::uint32_t x = static_cast<std::uint32_t>( x_size );
+  const std::uint32_t steps[4] = { 0u - x, 1u, x, 0u - 1u };
+
+  offsets_.resize( x_size * y_size + 1 );
+  neighbours_.clear();
+  directions_.clear();
+
+  std::uint32_t i = 0;
+  for( size_t y = 0; y < y_size; ++y )
+  {
+    for( const Room& rm : l_->RowAt(y) )
+    {
+      offsets_[i] = static_cast<std::uint32_t>( neighbours_.size() );
+      const MaskMoves& moves = kMaskMoves[ rm.OpenMask() ];
+      for( unsigned k = 0; k < moves.count; ++k )
+      {
+        neighbours_.push_back( i + steps[moves.walls[k]] );
+        directions_.push_back( kWallDirections[moves.walls[k]] );
+      }
+      ++i;
+    }
+  }
+  offsets_[i] = static_cast<std::uint32_t>( neighbours_.size() );
+
+  x_size_ = x_size;
+  version_ = l_->TopologyVersion();
+}
+
+// This method rebuilds the graph if it is out of date, and returns true if
+// it was rebuilt.
+bool LabyrinthGraph::Refresh()
+{
+  if( !Stale() )
+  {
+    return false;
+  }
+  Build();
+  return true;
+}
+
+// This method returns true if the graph has not been built for the
+// current layout of the Labyrinth.
+bool LabyrinthGraph::Stale() const
+{
+  return version_ != l_->TopologyVersion();
+}
+
+// This method returns the number of Rooms in the graph.
+size_t LabyrinthGraph::Rooms() const
+{
+  return offsets_.size() - 1;
+}
+
+// This method returns the number of connections between Rooms.
+size_t LabyrinthGraph::Connections() const
+{
+  return neighbours_.size() / 2;
+}
+
+// This method returns the index of the given Room.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+std::uint32_t LabyrinthGraph::IndexOf( const Coordinate rm ) const
+{
+  if( rm.x >= x_size_ || rm.y >= Rooms() / x_size_ )
+  {
+    throw std::domain_error( "Error: IndexOf() was given a Coordinate "\
+      "outside of the Labyrinth.\n" );
+  }
+  return static_cast<std::uint32_t>( rm.y * x_size_ + rm.x );
+}
+
+// This method returns the Coordinate of Room i, which is not checked.
+Coordinate LabyrinthGraph::ToCoordinate( const std::uint32_t i ) const
+  noexcept
+{
+  return Coordinate( i % x_size_, i / x_size_ );
+}
+
+// This method returns the neighbours of Room i which are connected to it.
+// Room i is not checked.
+NeighbourRange LabyrinthGraph::Neighbours( const std::uint32_t i ) const
+  noexcept
+{
+  const std::uint32_t first = offsets_[i];
+  return NeighbourRange( neighbours_.data() + first,
+                         directions_.data() + first,
+                         offsets_[i + 1] - first );
+}
+
+// This method returns the number of neighbours of Room i, which is not
+// checked.
+unsigned LabyrinthGraph::Degree( const std::uint32_t i ) const noexcept
+{
+  return offsets_[i + 1] - offsets_[i];
+}
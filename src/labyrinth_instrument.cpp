@@ -0,0 +1,248 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ file contains the implementation of the LabyrinthInstrument
+ * class, which counts and times the hot paths of Labyrinth and
+ * LabyrinthMap when the code is compiled with LABYRINTH_INSTRUMENT defined.
+ *
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <vector>
+
+#include "../include/labyrinth_instrument.hpp"
+
+namespace
+{
+
+// The counters of one thread. Only the owning thread writes them, so each
+// is updated with a relaxed load and store rather than a read-modify-write;
+// they are atomic so that Snapshot() may read them at the same time.
+struct ThreadCounters
+{
+  std::atomic<std::uint64_t> calls[kInstrumentOps];
+  std::atomic<std::uint64_t> errors[kInstrumentOps];
+  std::atomic<std::uint64_t> total_time[kInstrumentOps];
+  std::atomic<std::uint64_t> histogram[kInstrumentOps][kInstrumentBuckets];
+  std::atomic<std::uint64_t> counters[kInstrumentCounters];
+};
+
+// Every block of counters. Threads only lock it when they start and stop
+// counting.
+struct Registry
+{
+  std::mutex mutex;
+  std::vector<ThreadCounters*> live;
+  ThreadCounters retired;  // The totals of threads which have exited
+};
+
+// The block of counters of the calling thread, which is registered on
+// first use and added to the retired totals when the thread exits.
+class ThreadSlot
+{
+  public:
+
+    ThreadSlot();
+    ~ThreadSlot();
+
+    ThreadCounters* const counters;
+};
+
+// This local function returns the registry. It is never destroyed, so
+// threads which exit after main() returns can still retire their counters.
+Registry& GetRegistry();
+
+// This local function returns the counters of the calling thread.
+ThreadCounters& Local();
+
+// This local function adds n to a counter of the calling thread.
+void Add( std::atomic<std::uint64_t>& counter, const std::uint64_t n );
+
+// This local function adds every counter of from into the totals.
+void Accumulate( const ThreadCounters& from, InstrumentSnapshot& totals );
+
+// This local function returns the histogram bucket of a time.
+size_t Bucket( std::uint64_t time );
+
+ThreadSlot::ThreadSlot() :
+  counters(new ThreadCounters())
+{
+  Registry& r = GetRegistry();
+  std::lock_guard<std::mutex> lock( r.mutex );
+  r.live.push_back( counters );
+}
+
+ThreadSlot::~ThreadSlot()
+{
+  Registry& r = GetRegistry();
+  std::lock_guard<std::mutex> lock( r.mutex );
+  for( size_t i = 0; i < kInstrumentOps; ++i )
+  {
+    Add( r.retired.calls[i], counters->calls[i].load() );
+    Add( r.retired.errors[i], counters->errors[i].load() );
+    Add( r.retired.total_time[i], counters->total_time[i].load() );
+    for( size_t b = 0; b < kInstrumentBuckets; ++b )
+    {
+      Add( r.retired.histogram[i][b], counters->histogram[i][b].load() );
+    }
+  }
+  for( size_t c = 0; c < kInstrumentCounters; ++c )
+  {
+    Add( r.retired.counters[c], counters->counters[c].load() );
+  }
+  r.live.erase( std::find(r.live.begin(), r.live.end(), counters) );
+  delete counters;
+}
+
+// This local function returns the registry.
+Registry& GetRegistry()
+{
+  // Value-initialized, so every retired counter starts at 0.
+  static Registry* const registry = new Registry();
+  return *registry;
+}
+
+// This local function returns the counters of the calling thread.
+ThreadCounters& Local()
+{
+  thread_local ThreadSlot slot;
+  return *slot.counters;
+}
+
+// This local function adds n to a counter of the calling thread.
+void Add( std::atomic<std::uint64_t>& counter, const std::uint64_t n )
+{
+  counter.store( counter.load(std::memory_order_relaxed) + n,
+                 std::memory_order_relaxed );
+}
+
+// This local function adds every counter of from into the totals.
+void Accumulate( const ThreadCounters& from, InstrumentSnapshot& totals )
+{
+  for( size_t i = 0; i < kInstrumentOps; ++i )
+  {
+    InstrumentOpStats& op = totals.ops[i];
+    op.calls += from.calls[i].load( std::memory_order_relaxed );
+    op.errors += from.errors[i].load( std::memory_order_relaxed );
+    op.total_time += from.total_time[i].load( std::memory_order_relaxed );
+    for( size_t b = 0; b < kInstrumentBuckets; ++b )
+    {
+      op.histogram[b] +=
+        from.histogram[i][b].load( std::memory_order_relaxed );
+    }
+  }
+  for( size_t c = 0; c < kInstrumentCounters; ++c )
+  {
+    totals.counters[c] += from.counters[c].load( std::memory_order_relaxed );
+  }
+}
+
+// This local function returns the histogram bucket of a time.
+size_t Bucket( std::uint64_t time )
+{
+  size_t b = 0;
+  while( time > 1 && b + 1 < kInstrumentBuckets )
+  {
+    time >>= 1;
+    ++b;
+  }
+  return b;
+}
+
+}  // Local namespace
+
+// This method returns true if the code was compiled with
+// LABYRINTH_INSTRUMENT defined.
+bool LabyrinthInstrument::Enabled()
+{
+#ifdef LABYRINTH_INSTRUMENT
+  return true;
+#else
+  return false;
+#endif
+}
+
+// This method returns the totals of every thread.
+InstrumentSnapshot LabyrinthInstrument::Snapshot()
+{
+  InstrumentSnapshot totals;
+  Registry& r = GetRegistry();
+  std::lock_guard<std::mutex> lock( r.mutex );
+  Accumulate( r.retired, totals );
+  for( const ThreadCounters* const c : r.live )
+  {
+    Accumulate( *c, totals );
+  }
+  totals.threads = r.live.size();
+  return totals;
+}
+
+// These methods return the name of an operation or counter.
+const char* LabyrinthInstrument::Name( const InstrumentOp op )
+{
+  switch( op )
+  {
+    case InstrumentOp::kConnectRooms:   return "ConnectRooms";
+    case InstrumentOp::kDirectionCheck: return "DirectionCheck";
+    case InstrumentOp::kSetExit:        return "SetExit";
+    case InstrumentOp::kTakeItem:       return "TakeItem";
+    case InstrumentOp::kDisplay:        return "Display";
+    case InstrumentOp::kUpdateBorders:  return "UpdateBorders";
+    case InstrumentOp::kUpdateRooms:    return "UpdateRooms";
+  }
+  return "Unknown";
+}
+
+const char* LabyrinthInstrument::Name( const InstrumentCounter counter )
+{
+  switch( counter )
+  {
+    case InstrumentCounter::kBoundsFailures: return "BoundsFailures";
+    case InstrumentCounter::kMapRebuilds:    return "MapRebuilds";
+    case InstrumentCounter::kRoomsRedrawn:   return "RoomsRedrawn";
+    case InstrumentCounter::kRenderBytes:    return "RenderBytes";
+  }
+  return "Unknown";
+}
+
+// These methods add to the counters of the calling thread.
+void LabyrinthInstrument::Record( const InstrumentOp op,
+                                  const std::uint64_t time,
+                                  const bool failed )
+{
+  ThreadCounters& c = Local();
+  const size_t i = static_cast<size_t>( op );
+  Add( c.calls[i], 1 );
+  Add( c.errors[i], failed ? 1 : 0 );
+  Add( c.total_time[i], time );
+  Add( c.histogram[i][Bucket(time)], 1 );
+}
+
+void LabyrinthInstrument::Count( const InstrumentCounter counter,
+                                 const std::uint64_t n )
+{
+  Add( Local().counters[static_cast<size_t>(counter)], n );
+}
+
+// Parameterized constructor
+InstrumentScope::InstrumentScope( const InstrumentOp op ) :
+  op_(op),
+  start_(std::chrono::steady_clock::now())
+{
+}
+
+// Destructor
+InstrumentScope::~InstrumentScope()
+{
+  const std::uint64_t time = static_cast<std::uint64_t>(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - start_ ).count() );
+  LabyrinthInstrument::Record( op_, time, std::uncaught_exception() );
+}
@@ -0,0 +1,492 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ file contains the implementation of the LabyrinthJournal class,
+ * which records every change to a Labyrinth in an append-only binary file
+ * and replays it.
+ *
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/room.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_observer.hpp"
+#include "../include/labyrinth_journal.hpp"
+
+constexpr std::uint32_t LabyrinthJournal::kMagic;
+constexpr std::uint16_t LabyrinthJournal::kVersion;
+constexpr size_t LabyrinthJournal::kHeaderSize;
+constexpr size_t LabyrinthJournal::kDefaultCapacity;
+constexpr size_t LabyrinthJournal::kAllEvents;
+
+namespace
+{
+
+// The header of a journal, as it is stored.
+struct JournalHeader
+{
+  std::uint32_t magic;
+  std::uint16_t version;
+  std::uint16_t header_size;
+  std::uint32_t x_size;
+  std::uint32_t y_size;
+  std::uint8_t mode;
+  std::uint8_t reserved_bytes[3];
+  std::uint32_t reserved[3];
+};
+
+static_assert( sizeof(JournalHeader) == LabyrinthJournal::kHeaderSize,
+               "The header of a journal must stay 32 bytes." );
+
+// This local function returns l.
+// An exception is thrown if:
+//   l is null (invalid_argument)
+const Labyrinth* CheckLabyrinth( const Labyrinth* const l );
+
+// This local function returns the mask of indices of a ring buffer with
+// the given capacity.
+// An exception is thrown if:
+//   capacity is 0 or not a power of 2 (invalid_argument)
+size_t CheckCapacity( const size_t capacity );
+
+// This local function returns a value with its byte order reversed.
+std::uint32_t ByteSwap( const std::uint32_t value );
+
+// This local function returns the kind of event which changes a Room from
+// before to after.
+JournalEventKind Classify( const std::uint16_t before,
+                           const std::uint16_t after );
+
+// This local function returns a spawn event for the given Room.
+JournalEvent SpawnEvent( const Coordinate rm, const JournalEventKind kind );
+
+// This local function returns l.
+// An exception is thrown if:
+//   l is null (invalid_argument)
+const Labyrinth* CheckLabyrinth( const Labyrinth* const l )
+{
+  if( l == nullptr )
+  {
+    throw std::invalid_argument( "Error: LabyrinthJournal() was given an "\
+      "invalid (null) pointer for the Labyrinth.\n" );
+  }
+  return l;
+}
+
+// This local function returns the mask of indices of a ring buffer with
+// the given capacity.
+// An exception is thrown if:
+//   capacity is 0 or not a power of 2 (invalid_argument)
+size_t CheckCapacity( const size_t capacity )
+{
+  if( capacity == 0 || (capacity & (capacity - 1)) != 0 )
+  {
+    throw std::invalid_argument( "Error: LabyrinthJournal() was given a "\
+      "capacity which is not a power of 2.\n" );
+  }
+  return capacity - 1;
+}
+
+// This local function returns a value with its byte order reversed.
+std::uint32_t ByteSwap( const std::uint32_t value )
+{
+  return ( value >> 24 ) | ( (value >> 8) & 0xFF00 ) |
+         ( (value << 8) & 0xFF0000 ) | ( value << 24 );
+}
+
+// This local function returns the kind of event which changes a Room from
+// before to after.
+JournalEventKind Classify( const std::uint16_t before,
+                           const std::uint16_t after )
+{
+  const std::uint16_t changed = before ^ after;
+  if( (changed & ~Room::kWallMask) == 0 )
+  {
+    return JournalEventKind::kWalls;
+  }
+  else if( (changed & ~(Room::kWallMask | Room::kExitMask)) == 0 )
+  {
+    return JournalEventKind::kExit;
+  }
+  else if( (changed & ~Room::kInhabitantMask) == 0 )
+  {
+    return JournalEventKind::kInhabitant;
+  }
+  else if( (changed & ~Room::kItemMask) == 0 )
+  {
+    return JournalEventKind::kItem;
+  }
+  return JournalEventKind::kRoom;
+}
+
+// This local function returns a spawn event for the given Room.
+JournalEvent SpawnEvent( const Coordinate rm, const JournalEventKind kind )
+{
+  JournalEvent e;
+  e.x = static_cast<std::uint16_t>( rm.x );
+  e.y = static_cast<std::uint16_t>( rm.y );
+  e.before = 0;
+  e.after = 0;
+  e.kind = kind;
+  e.reserved = 0;
+  return e;
+}
+
+}  // Local namespace
+
+// Parameterized constructor
+// The file at the given path is replaced, and the current state of the
+// Labyrinth is recorded.
+// An exception is thrown if:
+//   l is null (invalid_argument)
+//   capacity is 0 or not a power of 2 (invalid_argument)
+//   The file cannot be written (runtime_error)
+LabyrinthJournal::LabyrinthJournal( const Labyrinth* const l,
+                                    const std::string& path,
+                                    const size_t capacity )
+  :
+  l_(CheckLabyrinth(l)),
+  rooms_(l->XSize() * l->YSize(), Room::kWallMask),
+  mask_(CheckCapacity(capacity)),
+  ring_(new JournalEvent[capacity]),
+  head_(0),
+  tail_(0),
+  written_(0),
+  failed_(false),
+  stop_(false),
+  file_(path, std::ios::binary | std::ios::trunc)
+{
+  JournalHeader header;
+  std::memset( &header, 0, sizeof(header) );
+  header.magic = kMagic;
+  header.version = kVersion;
+  header.header_size = kHeaderSize;
+  header.x_size = static_cast<std::uint32_t>( l_->XSize() );
+  header.y_size = static_cast<std::uint32_t>( l_->YSize() );
+  header.mode = ( l_->Mode() == LabyrinthMode::kSmall ? 0 : 1 );
+  file_.write( reinterpret_cast<const char*>(&header), sizeof(header) );
+  if( !file_ )
+  {
+    throw std::runtime_error( "Error: LabyrinthJournal() could not write "\
+      "the file.\n" );
+  }
+
+  flusher_ = std::thread( &LabyrinthJournal::FlushEvents, this );
+  try
+  {
+    AllRoomsChanged();
+    spawn_1_ = l_->GetSpawn1();
+    spawn_2_ = l_->GetSpawn2();
+    Record( SpawnEvent(spawn_1_, JournalEventKind::kSpawn1) );
+    Record( SpawnEvent(spawn_2_, JournalEventKind::kSpawn2) );
+    l_->AddObserver( this );
+  }
+  catch( ... )
+  {
+    stop_.store( true, std::memory_order_release );
+    wake_.notify_one();
+    flusher_.join();
+    throw;
+  }
+}
+
+// Destructor
+// Every event recorded is written to the file before it returns.
+LabyrinthJournal::~LabyrinthJournal()
+{
+  l_->RemoveObserver( this );
+  stop_.store( true, std::memory_order_release );
+  wake_.notify_one();
+  flusher_.join();
+}
+
+// This method waits until every event recorded so far is written to the
+// file, and returns true if every write succeeded.
+bool LabyrinthJournal::Flush()
+{
+  while( written_.load(std::memory_order_acquire) < recorded_ )
+  {
+    wake_.notify_one();
+    std::this_thread::yield();
+  }
+  return !failed_.load( std::memory_order_relaxed );
+}
+
+// This method returns the number of events recorded.
+size_t LabyrinthJournal::Recorded() const
+{
+  return recorded_;
+}
+
+// This method returns the number of times the game thread waited for a
+// full ring buffer.
+size_t LabyrinthJournal::Stalls() const
+{
+  return stalls_;
+}
+
+// This method returns a Labyrinth with the state recorded by the first
+// events of the journal at the given path (every event by default).
+// Rooms are written as they were recorded, without the checks of the
+// methods which changed them.
+// An exception is thrown if:
+//   The file cannot be read (runtime_error)
+//   The file is not a journal of this version (runtime_error)
+//   The file has an event outside the Labyrinth (runtime_error)
+//   The file has an event which leaves a Room invalid, or with a broken
+//     Wall other than the exit on the edge of the Labyrinth
+//     (runtime_error)
+//   The header has an invalid size (domain_error)
+Labyrinth LabyrinthJournal::Replay( const std::string& path,
+                                    const size_t events )
+{
+  std::ifstream file( path, std::ios::binary );
+  if( !file )
+  {
+    throw std::runtime_error( "Error: Replay() could not open the file.\n" );
+  }
+
+  JournalHeader header;
+  std::memset( &header, 0, sizeof(header) );
+  file.read( reinterpret_cast<char*>(&header), sizeof(header) );
+  if( header.magic == ByteSwap(kMagic) )
+  {
+    throw std::runtime_error( "Error: Replay() was given a file written "\
+      "with a different byte order.\n" );
+  }
+  else if( !file || header.magic != kMagic ||
+           header.header_size != kHeaderSize || header.mode > 1 )
+  {
+    throw std::runtime_error( "Error: Replay() was given a file which is "\
+      "not a journal.\n" );
+  }
+  else if( header.version != kVersion )
+  {
+    throw std::runtime_error( "Error: Replay() was given a file of an "\
+      "unsupported version.\n" );
+  }
+
+  Labyrinth l( header.x_size,
+               header.y_size,
+               header.mode == 0 ? LabyrinthMode::kSmall :
+                                  LabyrinthMode::kLarge );
+
+  // Events are read in batches; each Room keeps the last word recorded,
+  // and the exit and Treasure are in the last Room which gained them.
+  std::vector<JournalEvent> batch( kDefaultCapacity );
+  size_t remaining = events;
+  bool walls_changed = false;
+  while( remaining > 0 )
+  {
+    const size_t wanted = std::min( remaining, batch.size() );
+    file.read( reinterpret_cast<char*>(batch.data()),
+               wanted * sizeof(JournalEvent) );
+    const size_t count =
+      static_cast<size_t>( file.gcount() ) / sizeof(JournalEvent);
+
+    for( size_t i = 0; i < count; ++i )
+    {
+      const JournalEvent& e = batch[i];
+      const Coordinate rm( e.x, e.y );
+      if( !l.WithinBounds(rm) )
+      {
+        throw std::runtime_error( "Error: Replay() was given a file with "\
+          "an event outside of the Labyrinth.\n" );
+      }
+
+      if( e.kind == JournalEventKind::kSpawn1 )
+      {
+        l.spawn_1_ = rm;
+        continue;
+      }
+      else if( e.kind == JournalEventKind::kSpawn2 )
+      {
+        l.spawn_2_ = rm;
+        continue;
+      }
+
+      // A Room open to the outside would lead graphs and searches out of
+      // the Labyrinth.
+      if( !l.PackedRoomFits(rm, e.after) )
+      {
+        throw std::runtime_error( "Error: Replay() was given a file with "\
+          "an event which leaves a Room invalid, or open to the "\
+          "outside.\n" );
+      }
+
+      const Room after = Room::FromPacked( e.after );
+      l.MutableRowAt( e.y )[e.x] = after;
+      if( e.after & Room::kExitMask )
+      {
+        l.exit_set_ = true;
+        l.exit_ = rm;
+      }
+      else if( e.before & Room::kExitMask )
+      {
+        l.exit_set_ = false;
+      }
+      if( after.GetItem() == Item::kTreasure )
+      {
+        l.treasure_set_ = true;
+        l.treasure_ = rm;
+      }
+      else if( Room::FromPacked(e.before).GetItem() == Item::kTreasure )
+      {
+        l.treasure_set_ = false;
+      }
+      walls_changed |= ( (e.before ^ e.after) & Room::kWallMask ) != 0;
+    }
+
+    remaining -= count;
+    if( count < wanted )
+    {
+      break;
+    }
+  }
+
+  if( walls_changed )
+  {
+    ++l.topology_version_;
+  }
+  return l;
+}
+
+// These methods record the change.
+void LabyrinthJournal::RoomChanged( const Coordinate rm )
+{
+  RecordRoom( rm.y * l_->XSize() + rm.x, rm,
+              l_->RoomAtUnchecked(rm).Packed() );
+}
+
+void LabyrinthJournal::AllRoomsChanged()
+{
+  size_t i = 0;
+  for( size_t y = 0; y < l_->YSize(); ++y )
+  {
+    const RoomRow row = l_->RowAt( y );
+    for( size_t x = 0; x < row.size(); ++x, ++i )
+    {
+      RecordRoom( i, Coordinate(x, y), row[x].Packed() );
+    }
+  }
+}
+
+void LabyrinthJournal::SpawnsChanged()
+{
+  if( !(l_->GetSpawn1() == spawn_1_) )
+  {
+    spawn_1_ = l_->GetSpawn1();
+    Record( SpawnEvent(spawn_1_, JournalEventKind::kSpawn1) );
+  }
+  if( !(l_->GetSpawn2() == spawn_2_) )
+  {
+    spawn_2_ = l_->GetSpawn2();
+    Record( SpawnEvent(spawn_2_, JournalEventKind::kSpawn2) );
+  }
+}
+
+// PRIVATE METHODS:
+
+// This private method records the Room at the given index, if it
+// changed.
+void LabyrinthJournal::RecordRoom( const size_t i, const Coordinate rm,
+                                   const std::uint16_t after )
+{
+  const std::uint16_t before = rooms_[i];
+  if( before == after )
+  {
+    return;
+  }
+  rooms_[i] = after;
+
+  JournalEvent e;
+  e.x = static_cast<std::uint16_t>( rm.x );
+  e.y = static_cast<std::uint16_t>( rm.y );
+  e.before = before;
+  e.after = after;
+  e.kind = Classify( before, after );
+  e.reserved = 0;
+  Record( e );
+}
+
+// This private method copies an event into the ring buffer, waiting
+// while it is full.
+// Only the game thread moves head_, so it is read and stored rather than
+// incremented atomically; the release store publishes the event to the
+// flush thread.
+void LabyrinthJournal::Record( const JournalEvent& e )
+{
+  const size_t head = head_.load( std::memory_order_relaxed );
+  if( head - tail_.load(std::memory_order_acquire) > mask_ )
+  {
+    ++stalls_;
+    do
+    {
+      wake_.notify_one();
+      std::this_thread::yield();
+    } while( head - tail_.load(std::memory_order_acquire) > mask_ );
+  }
+
+  ring_[head & mask_] = e;
+  head_.store( head + 1, std::memory_order_release );
+  ++recorded_;
+}
+
+// This private method is run by the flush thread: it writes the events
+// in the ring buffer to the file until the journal is destroyed.
+// stop_ is read before head_, so once it is set and the buffer is empty,
+// every event has been written. A wake-up may be missed if it comes just
+// before the thread waits, which only delays the batch by the timeout.
+void LabyrinthJournal::FlushEvents()
+{
+  for( ;; )
+  {
+    const bool stopping = stop_.load( std::memory_order_acquire );
+    const size_t tail = tail_.load( std::memory_order_relaxed );
+    const size_t head = head_.load( std::memory_order_acquire );
+    if( head == tail )
+    {
+      if( stopping )
+      {
+        return;
+      }
+      std::unique_lock<std::mutex> lock( wake_mutex_ );
+      wake_.wait_for( lock, std::chrono::milliseconds(1) );
+      continue;
+    }
+
+    // The events may wrap around the end of the buffer.
+    const size_t first = tail & mask_;
+    const size_t count = head - tail;
+    const size_t before_end = std::min( count, mask_ + 1 - first );
+    file_.write( reinterpret_cast<const char*>(&ring_[first]),
+                 before_end * sizeof(JournalEvent) );
+    file_.write( reinterpret_cast<const char*>(&ring_[0]),
+                 (count - before_end) * sizeof(JournalEvent) );
+    file_.flush();
+    if( !file_ )
+    {
+      failed_.store( true, std::memory_order_relaxed );
+    }
+
+    tail_.store( head, std::memory_order_release );
+    written_.store( head, std::memory_order_release );
+  }
+}
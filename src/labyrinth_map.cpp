@@ -1,127 +1,398 @@
 /*
  *
  * Author: Jeffrey Leung
- * Last edited: 2016-02-01
+ * Last edited: 2026-10-14
  *
  * This C++ header file contains the LabyrinthMap class which creates, updates,
  * and displays a map of a given Labyrinth.
  *
  */
 
-#include <cstring>
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
 #include <iostream>
 #include <stdexcept>
 #include <string>
+#include <vector>
+
+#include <unistd.h>
 
 #include "../include/room_properties.hpp"
+#include "../include/room.hpp"
+#include "../include/room_row.hpp"
+#include "../include/labyrinth_observer.hpp"
 #include "../include/labyrinth.hpp"
+#include "../include/labyrinth_visibility.hpp"
 #include "../include/labyrinth_map.hpp"
+#include "../include/labyrinth_instrument.hpp"
+#include "../include/work_stealing_pool.hpp"
 
-// This method returns whether a given Wall coordinate has a wall in the
-// given direction.
-// An exception is thrown if:
-//   d is kNone (invalid_argument)
-bool LabyrinthMapCoordinateBorder::IsWall( const Direction d ) const
-{
-  switch( d )
-  {
-    case Direction::kNorth:
-      return wall_north_;
-    case Direction::kEast:
-      return wall_east_;
-    case Direction::kSouth:
-      return wall_south_;
-    case Direction::kWest:
-      return wall_west_;
-    default:
-      throw std::invalid_argument( "Error: IsWall() was given an invalid " \
-        "direction (kNone).\n" );
+namespace
+{
+
+// A UTF-8 character and its length in bytes.
+struct Glyph
+{
+  const char* text;
+  size_t length;
+};
+
+// Characters indexed by the Wall bits of a LabyrinthMapBorder, taken from
+// the Unicode section of:
+// https://en.wikipedia.org/wiki/Box-drawing_character
+const Glyph kBorderGlyphs[16] =
+{
+  { " ", 1 },       // None
+  { u8"╵", 3 },     // North
+  { u8"╶", 3 },     // East
+  { u8"└", 3 },     // North, East
+  { u8"╷", 3 },     // South
+  { u8"│", 3 },     // North, South
+  { u8"┌", 3 },     // East, South
+  { u8"├", 3 },     // North, East, South
+  { u8"╴", 3 },     // West
+  { u8"┘", 3 },     // North, West
+  { u8"─", 3 },     // East, West
+  { u8"┴", 3 },     // North, East, West
+  { u8"┐", 3 },     // South, West
+  { u8"┤", 3 },     // North, South, West
+  { u8"┬", 3 },     // East, South, West
+  { u8"┼", 3 },     // All
+};
+
+const char kLegend[] =
+  "        LEGEND\n"
+  u8"┌─────────────────────┐\n"
+  u8"│ INHABITANTS         │\n"
+  u8"│ Minotaur (live):  M │\n"
+  u8"│ Minotaur (dead):  m │\n"
+  u8"│ Mirror (intact):  O │\n"
+  u8"│ Mirror (cracked): 0 │\n"
+  u8"│                     │\n"
+  u8"│ ITEMS               │\n"
+  u8"│ Bullet:           • │\n"
+  u8"│ Treasure:         T │\n"
+  u8"└─────────────────────┘\n";
+
+// Characters of an overview, indexed by the rank of the most important
+// contents of a block of Rooms (see OverviewRank()).
+const Glyph kOverviewGlyphs[7] =
+{
+  { "#", 1 },       // Only walled Rooms
+  { ".", 1 },       // Rooms connected to others
+  { u8"•", 3 },     // A Bullet
+  { "O", 1 },       // An intact Mirror
+  { "M", 1 },       // A live Minotaur
+  { "E", 1 },       // The exit
+  { "T", 1 },       // The Treasure
+};
+
+// This local function returns the rank of the most important contents of
+// the Room in an overview, as an index of kOverviewGlyphs.
+std::uint8_t OverviewRank( const Room& rm );
+
+// This local function returns the rank of the most important contents of
+// the Room in an overview, as an index of kOverviewGlyphs.
+std::uint8_t OverviewRank( const Room& rm )
+{
+  const Item itm = rm.GetItem();
+  const Inhabitant inh = rm.GetInhabitant();
+  if( itm == Item::kTreasure )
+  {
+    return 6;
+  }
+  else if( rm.Packed() & Room::kExitMask )
+  {
+    return 5;
   }
+  else if( inh == Inhabitant::kMinotaur )
+  {
+    return 4;
+  }
+  else if( inh == Inhabitant::kMirror )
+  {
+    return 3;
+  }
+  else if( itm == Item::kBullet )
+  {
+    return 2;
+  }
+  return rm.OpenMask() != 0 ? 1 : 0;
 }
 
-// This method sets the Wall of a given Wall coordinate to either
-// exist or not exist.
-// May be used to set a wall which already exists, or remove a Wall
-// which has already been removed.
+}  // Local namespace
+
+constexpr std::uint8_t LabyrinthMapBorder::kNorth;
+constexpr std::uint8_t LabyrinthMapBorder::kEast;
+constexpr std::uint8_t LabyrinthMapBorder::kSouth;
+constexpr std::uint8_t LabyrinthMapBorder::kWest;
+constexpr std::uint8_t LabyrinthMapBorder::kWalls;
+constexpr std::uint8_t LabyrinthMapBorder::kExit;
+constexpr size_t LabyrinthMap::kRebuildBandRooms;
+
+// Parameterized constructor
 // An exception is thrown if:
-//   d is kNone (invalid_argument)
-void LabyrinthMapCoordinateBorder::SetWall( const Direction d,
-                                            const bool exists )
-{
-  switch( d )
-  {
-    case Direction::kNorth:
-      wall_north_ = exists;
-      return;
-    case Direction::kEast:
-      wall_east_ = exists;
-      return;
-    case Direction::kSouth:
-      wall_south_ = exists;
-      return;
-    case Direction::kWest:
-      wall_west_ = exists;
-      return;
-    default:
-      throw std::invalid_argument( "Error: SetWall() was given an invalid "\
-        "direction (kNone).\n" );
+//   l is null (invalid_argument)
+//   A size of 0 is given (domain_error)
+//   A size greater than that of the Labyrinth is given (domain_error)
+LabyrinthMap::LabyrinthMap( const Labyrinth* const l,
+                            const size_t x_size,
+                            const size_t y_size ) :
+  LabyrinthMap( l, x_size, y_size, nullptr )
+{
+}
+
+// Parameterized constructor
+// The cells of the map, and its record of changed Rooms, are allocated
+// from the arena.
+// An exception is thrown if:
+//   l is null (invalid_argument)
+//   A size of 0 is given (domain_error)
+//   A size greater than that of the Labyrinth is given (domain_error)
+LabyrinthMap::LabyrinthMap( const Labyrinth* const l,
+                            const size_t x_size,
+                            const size_t y_size,
+                            LabyrinthArena& arena ) :
+  LabyrinthMap( l, x_size, y_size, &arena )
+{
+}
+
+// Destructor
+LabyrinthMap::~LabyrinthMap()
+{
+  l_->RemoveObserver( this );
+}
+
+// This method displays a map of the current Labyrinth on std::cout.
+void LabyrinthMap::Display()
+{
+  Display( std::cout );
+}
+
+// This method displays a map of the current Labyrinth on the given
+// stream, with a single write.
+void LabyrinthMap::Display( std::ostream& os )
+{
+  const std::string& frame = Render();
+  os.write( frame.data(), static_cast<std::streamsize>(frame.size()) );
+  os.flush();
+}
+
+// This method displays a map of the current Labyrinth on the given file
+// descriptor, with a single write where possible.
+// An exception is thrown if:
+//   The file descriptor cannot be written to (runtime_error)
+void LabyrinthMap::Display( const int fd )
+{
+  const std::string& frame = Render();
+  size_t written = 0;
+  while( written < frame.size() )
+  {
+    const ssize_t n = write( fd, frame.data() + written,
+                             frame.size() - written );
+    if( n < 0 )
+    {
+      if( errno == EINTR )
+      {
+        continue;
+      }
+      throw std::runtime_error( "Error: Display() could not write to the "\
+        "file descriptor.\n" );
+    }
+    written += static_cast<size_t>( n );
   }
-  return;
 }
 
-// This method returns whether a given Wall coordinate has the exit.
-bool LabyrinthMapCoordinateBorder::IsExit() const
+// This method returns the complete text of a map of the current
+// Labyrinth, in UTF-8. The text is kept in a buffer which is reused by
+// the next call.
+const std::string& LabyrinthMap::Render()
+{
+  return RenderFrame( nullptr, 0, Window{ 0, 0, x_size_, y_size_ }, true );
+}
+
+// These methods display and return a map of the Rooms which have been
+// revealed to the given Player.
+// An exception is thrown if:
+//   v is not the same size as the map (invalid_argument)
+//   The Player does not exist (invalid_argument)
+void LabyrinthMap::Display( std::ostream& os,
+                            const LabyrinthVisibility& v,
+                            const size_t player )
 {
-  return exit_;
+  const std::string& frame = Render( v, player );
+  os.write( frame.data(), static_cast<std::streamsize>(frame.size()) );
+  os.flush();
 }
 
-// This method sets whether or not a given Wall coordinate has the exit.
-// May be used to set an exit where the exit already exists, or to remove
-// an exit where none exists.
-void LabyrinthMapCoordinateBorder::SetExit( const bool b )
+const std::string& LabyrinthMap::Render( const LabyrinthVisibility& v,
+                                         const size_t player )
 {
-  exit_ = b;
+  CheckVisibility( v, player, "Render" );
+  return RenderFrame( &v, player, Window{ 0, 0, x_size_, y_size_ }, true );
 }
 
-// This method returns the inhabitant of the current Room.
-Inhabitant LabyrinthMapCoordinateRoom::GetInhabitant() const
+// These methods display and return a map of the largest window of
+// Rooms which fits in the given number of columns and rows of text,
+// centred on the given Room as far as the edges of the Labyrinth allow.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+//   The columns and rows do not fit one Room (4 x 3) (invalid_argument)
+void LabyrinthMap::DisplayWindow( std::ostream& os,
+                                  const Coordinate centre,
+                                  const size_t columns,
+                                  const size_t rows )
 {
-  return i_;
+  const std::string& frame = RenderWindow( centre, columns, rows );
+  os.write( frame.data(), static_cast<std::streamsize>(frame.size()) );
+  os.flush();
 }
 
-// This method sets the current inhabitant of the map's Room.
-// May be used to set the inhabitant to the same inhabitant, or to
-// no inhabitant.
-void LabyrinthMapCoordinateRoom::SetInhabitant( const Inhabitant inh )
+const std::string& LabyrinthMap::RenderWindow( const Coordinate centre,
+                                               const size_t columns,
+                                               const size_t rows )
 {
-  i_ = inh;
+  return RenderFrame( nullptr, 0,
+                      FitWindow(centre, columns, rows, "RenderWindow"),
+                      false );
 }
 
-// This method returns the item in a given Room.
-Item LabyrinthMapCoordinateRoom::ItemAt() const
+// These methods display and return a window of the Rooms which have
+// been revealed to the given Player.
+// An exception is thrown if:
+//   v is not the same size as the map (invalid_argument)
+//   The Player does not exist (invalid_argument)
+//   The Room is outside the Labyrinth (domain_error)
+//   The columns and rows do not fit one Room (4 x 3) (invalid_argument)
+void LabyrinthMap::DisplayWindow( std::ostream& os,
+                                  const LabyrinthVisibility& v,
+                                  const size_t player,
+                                  const Coordinate centre,
+                                  const size_t columns,
+                                  const size_t rows )
 {
-  return itm_;
+  const std::string& frame = RenderWindow( v, player, centre, columns, rows );
+  os.write( frame.data(), static_cast<std::streamsize>(frame.size()) );
+  os.flush();
 }
 
-// This method sets the item in a given map's Room.
-// May be used to set the same item or remove a non-existent item.
-void LabyrinthMapCoordinateRoom::SetItem( const Item i )
+const std::string& LabyrinthMap::RenderWindow( const LabyrinthVisibility& v,
+                                               const size_t player,
+                                               const Coordinate centre,
+                                               const size_t columns,
+                                               const size_t rows )
 {
-  itm_ = i;
+  CheckVisibility( v, player, "RenderWindow" );
+  return RenderFrame( &v, player,
+                      FitWindow(centre, columns, rows, "RenderWindow"),
+                      false );
 }
 
-// Parameterized constructor
+// These methods display and return an overview of the whole Labyrinth
+// in at most the given number of columns and rows of text, with each
+// character showing the most important thing in a block of Rooms.
 // An exception is thrown if:
-//   l is null (invalid_argument)
-//   A size of 0 is given (domain_error)
+//   The columns or rows are 0 (invalid_argument)
+void LabyrinthMap::DisplayOverview( std::ostream& os,
+                                    const size_t columns,
+                                    const size_t rows )
+{
+  const std::string& frame = RenderOverview( columns, rows );
+  os.write( frame.data(), static_cast<std::streamsize>(frame.size()) );
+  os.flush();
+}
+
+const std::string& LabyrinthMap::RenderOverview( const size_t columns,
+                                                 const size_t rows )
+{
+  if( columns == 0 || rows == 0 )
+  {
+    throw std::invalid_argument( "Error: RenderOverview() was given no "\
+      "columns or rows.\n" );
+  }
+
+  // Blocks are square, with the smallest side which fits both ways
+  const size_t block = std::max( (x_size_ + columns - 1) / columns,
+                                 (y_size_ + rows - 1) / rows );
+  const size_t x_blocks = ( x_size_ + block - 1 ) / block;
+
+  frame_.clear();
+  overview_ranks_.resize( x_blocks );
+  for( size_t y_first = 0; y_first < y_size_; y_first += block )
+  {
+    std::fill( overview_ranks_.begin(), overview_ranks_.end(), 0 );
+    const size_t y_end = std::min( y_first + block, y_size_ );
+    for( size_t y = y_first; y < y_end; ++y )
+    {
+      const RoomRow row = l_->RowAt( y );
+      for( size_t b = 0; b < x_blocks; ++b )
+      {
+        const size_t x_end = std::min( (b + 1) * block, x_size_ );
+        for( size_t x = b * block; x < x_end; ++x )
+        {
+          overview_ranks_[b] = std::max( overview_ranks_[b],
+                                         OverviewRank(row[x]) );
+        }
+      }
+    }
+
+    for( const std::uint8_t rank : overview_ranks_ )
+    {
+      frame_.append( kOverviewGlyphs[rank].text,
+                     kOverviewGlyphs[rank].length );
+    }
+    frame_ += '\n';
+  }
+  return frame_;
+}
+
+// This method gives every cell of a map of the current Labyrinth to
+// the backend, one Map row at a time.
+// Exceptions thrown by the backend are passed on.
+void LabyrinthMap::Render( LabyrinthMapBackend& backend )
+{
+  LABYRINTH_INSTRUMENT_SCOPE( InstrumentOp::kDisplay );
+  Synchronize();
+
+  cell_row_.resize( map_x_size_ );
+  backend.Begin( map_x_size_, map_y_size_ );
+  for( size_t y = 0; y < map_y_size_; ++y )
+  {
+    for( size_t x = 0; x < map_x_size_; ++x )
+    {
+      cell_row_[x] = CellAt( Coordinate(x, y) );
+    }
+    backend.Row( cell_row_.data() );
+  }
+  backend.End();
+}
+
+// This method rebuilds the whole map on the workers of the pool from
+// now on, in bands of rows (if the Labyrinth has enough Rooms), or on
+// the calling thread if pool is null (the default).
+void LabyrinthMap::SetRebuildPool( WorkStealingPool* const pool )
+{
+  rebuild_pool_ = pool;
+}
+
+// PRIVATE METHODS:
+
+// Parameterized constructor
+// Used by the public constructors; arena may be null.
 LabyrinthMap::LabyrinthMap( const Labyrinth* const l,
                             const size_t x_size,
-                            const size_t y_size ) :
+                            const size_t y_size,
+                            LabyrinthArena* const arena ) :
   l_(l),
   x_size_(x_size),
   y_size_(y_size),
+  rooms_(ArenaAllocator<LabyrinthMapRoom>(arena)),
+  borders_(ArenaAllocator<LabyrinthMapBorder>(arena)),
   map_x_size_(x_size * 2 + 1),
-  map_y_size_(y_size * 2 + 1)
+  map_y_size_(y_size * 2 + 1),
+  dirty_(ArenaAllocator<bool>(arena)),
+  dirty_rooms_(ArenaAllocator<size_t>(arena))
 {
   if( l == nullptr )
   {
@@ -146,85 +417,335 @@ LabyrinthMap::LabyrinthMap( const Labyrinth* const l,
     throw std::domain_error( "Error: LabyrinthMap() was given an empty "\
       "y size.\n" );
   }
+  else if( x_size > l->XSize() || y_size > l->YSize() )
+  {
+    throw std::domain_error( "Error: LabyrinthMap() was given a size "\
+      "greater than that of the Labyrinth.\n" );
+  }
 
-  // Creation of the map array
-  auto map_temp_1 = std::make_unique<
-    std::unique_ptr<std::unique_ptr<LabyrinthMapCoordinate>[]>[]
-  >(map_y_size_);
+  // The map arrays are created by the first render (see Materialize()).
+  l_->AddObserver( this );
+}
 
-  map_ = std::move( map_temp_1 );
+// This private method renders the Rooms of the window into frame_,
+// with only the Rooms revealed to the Player if v is not null, and with
+// the axes and legend if labels is true.
+// Walls on the edges of the window which lead out of it are not drawn, as
+// CleanBorders() does for the edges of the whole map.
+const std::string& LabyrinthMap::RenderFrame(
+  const LabyrinthVisibility* const v,
+  const size_t player,
+  const Window& w,
+  const bool labels )
+{
+  LABYRINTH_INSTRUMENT_SCOPE( InstrumentOp::kDisplay );
+  Synchronize();
 
-  Coordinate c;
-  for( size_t y = 0; y < map_y_size_; ++y )
+  frame_.clear();
+  if( labels )
   {
-    auto map_temp_2 = std::make_unique<
-      std::unique_ptr<LabyrinthMapCoordinate>[]
-    >(map_x_size_);
+    LabelXAxis( frame_ );
+  }
 
-    map_[y] = std::move( map_temp_2 );
+  const size_t x_begin = w.x_first * 2;
+  const size_t x_last = ( w.x_first + w.x_rooms ) * 2;
+  const size_t y_begin = w.y_first * 2;
+  const size_t y_last = ( w.y_first + w.y_rooms ) * 2;
+  for( size_t y = y_begin; y <= y_last; ++y )
+  {
+    if( labels )
+    {
+      LabelYAxis( y, frame_ );
+    }
 
-    for( size_t x = 0; x < map_x_size_; ++x )
+    std::uint8_t row_walls = LabyrinthMapBorder::kWalls;
+    if( y == y_begin )
+    {
+      row_walls &= ~LabyrinthMapBorder::kNorth;
+    }
+    if( y == y_last )
+    {
+      row_walls &= ~LabyrinthMapBorder::kSouth;
+    }
+
+    for( size_t x = x_begin; x <= x_last; ++x )
     {
-      c.x = x;
-      c.y = y;
-      if( IsRoom(c) )
+      const Coordinate c(x, y);
+      if( x % 2 == 1 && y % 2 == 1 )
       {
-        // Longer form necessary to use a pointer to a superclass of Room
-        std::unique_ptr<LabyrinthMapCoordinate> map_temp_3
-          (new LabyrinthMapCoordinateRoom);
-        map_[y][x] = std::move( map_temp_3 );
+        if( v == nullptr || RoomRevealed(*v, player, x / 2, y / 2) )
+        {
+          DisplayRoom( c, frame_ );
+        }
+        else
+        {
+          frame_ += "  ";
+        }
       }
       else
       {
-        // Longer form necessary to use a pointer to a superclass of Border
-        std::unique_ptr<LabyrinthMapCoordinate> map_temp_3
-          (new LabyrinthMapCoordinateBorder);
-        map_[y][x] = std::move( map_temp_3 );
+        std::uint8_t walls = ( v == nullptr ) ?
+          row_walls : ( row_walls & RevealedWalls(c, *v, player) );
+        if( x == x_begin )
+        {
+          walls &= ~LabyrinthMapBorder::kWest;
+        }
+        if( x == x_last )
+        {
+          walls &= ~LabyrinthMapBorder::kEast;
+        }
+        DisplayBorder( c, frame_, walls );
+
+        // Doubles the horizontal draw distance of a Map Room (and the Borders
+        // directly above/below a Map Room) from 1 to 2 characters
+        if( x % 2 == 1 )
+        {
+          DisplayBorder( c, frame_, walls );
+        }
       }
     }
+    frame_ += '\n';
   }
 
-  CleanBorders();
-  UpdateBorders();
-  UpdateRooms();
+  if( labels )
+  {
+    frame_ += "\n\n";
+    DisplayLegend( frame_ );
+  }
+  LABYRINTH_INSTRUMENT_COUNT( InstrumentCounter::kRenderBytes,
+                              frame_.size() );
+  return frame_;
 }
 
-// This method displays a map of the current Labyrinth.
-void LabyrinthMap::Display()
+// This private method returns the MapCell of the given Map Coordinate.
+MapCell LabyrinthMap::CellAt( const Coordinate c ) const
+{
+  if( c.x % 2 == 1 && c.y % 2 == 1 )
+  {
+    const LabyrinthMapRoom& map_rm =
+      rooms_[((c.y - 1) / 2) * x_size_ + (c.x - 1) / 2];
+    if( map_rm.itm == Item::kTreasure )
+    {
+      return MapCell::kTreasure;
+    }
+    switch( map_rm.inh )
+    {
+      case Inhabitant::kMinotaur:
+        return MapCell::kMinotaur;
+      case Inhabitant::kMirror:
+        return MapCell::kMirror;
+      default:
+        break;
+    }
+    if( map_rm.itm == Item::kBullet )
+    {
+      return MapCell::kBullet;
+    }
+    switch( map_rm.inh )
+    {
+      case Inhabitant::kMinotaurDead:
+        return MapCell::kMinotaurDead;
+      case Inhabitant::kMirrorCracked:
+        return MapCell::kMirrorCracked;
+      default:
+        return MapCell::kOpen;
+    }
+  }
+
+  const std::uint8_t bits = BorderAt( c ).bits;
+  if( bits & LabyrinthMapBorder::kExit )
+  {
+    return MapCell::kExit;
+  }
+  return ( bits & LabyrinthMapBorder::kWalls ) ? MapCell::kWall :
+                                                 MapCell::kOpen;
+}
+
+// This private method returns the window of Rooms described for
+// RenderWindow(): as many Rooms as fit, centred on the given Room, then
+// moved inside the Labyrinth.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+//   The columns and rows do not fit one Room (4 x 3) (invalid_argument)
+LabyrinthMap::Window LabyrinthMap::FitWindow( const Coordinate centre,
+                                              const size_t columns,
+                                              const size_t rows,
+                                              const char* const caller )
+  const
 {
-  UpdateBorders();
-  UpdateRooms();
+  if( centre.x >= x_size_ || centre.y >= y_size_ )
+  {
+    throw std::domain_error( std::string("Error: ") + caller + "() was "\
+      "given a Coordinate outside of the Labyrinth.\n" );
+  }
+  else if( columns < 4 || rows < 3 )
+  {
+    throw std::invalid_argument( std::string("Error: ") + caller + "() "\
+      "was given too few columns or rows for a Room.\n" );
+  }
 
-  LabelXAxis();
+  Window w;
+  w.x_rooms = std::min( (columns - 1) / 3, x_size_ );
+  w.y_rooms = std::min( (rows - 1) / 2, y_size_ );
+  w.x_first = std::min( centre.x - std::min(centre.x, w.x_rooms / 2),
+                        x_size_ - w.x_rooms );
+  w.y_first = std::min( centre.y - std::min(centre.y, w.y_rooms / 2),
+                        y_size_ - w.y_rooms );
+  return w;
+}
 
-  for( size_t y = 0; y < map_y_size_; ++y )
+// This private method throws if v cannot be rendered with the map.
+// An exception is thrown if:
+//   v is not the same size as the map (invalid_argument)
+//   The Player does not exist (invalid_argument)
+void LabyrinthMap::CheckVisibility( const LabyrinthVisibility& v,
+                                    const size_t player,
+                                    const char* const caller ) const
+{
+  if( v.XSize() != x_size_ || v.YSize() != y_size_ )
   {
-    LabelYAxis( y );
-    for( size_t x = 0; x < map_x_size_; ++x )
+    throw std::invalid_argument( std::string("Error: ") + caller + "() "\
+      "was given a LabyrinthVisibility of a different size.\n" );
+  }
+  else if( player >= v.Players() )
+  {
+    throw std::invalid_argument( std::string("Error: ") + caller + "() "\
+      "was given a player which does not exist.\n" );
+  }
+}
+
+// This private method returns true if the Labyrinth Room is revealed to
+// the Player, and false if it is not or is outside the Labyrinth.
+bool LabyrinthMap::RoomRevealed( const LabyrinthVisibility& v,
+                                 const size_t player,
+                                 const size_t x,
+                                 const size_t y ) const
+{
+  return x < x_size_ && y < y_size_ &&
+         v.RevealedUnchecked( player, Coordinate(x, y) );
+}
+
+// This private method returns the Wall bits of the given Border which
+// are next to a Room revealed to the Player.
+// A Wall between two Rooms (or a Room and the outer wall) is shown if either
+// Room is revealed, and a corner only draws towards the Walls which are
+// shown. Rooms before the first row or column wrap around to sizes which
+// are never within the Labyrinth.
+std::uint8_t LabyrinthMap::RevealedWalls( const Coordinate c,
+                                          const LabyrinthVisibility& v,
+                                          const size_t player ) const
+{
+  // Whether the Wall at a Map Coordinate with one odd component is shown
+  const auto shown = [this, &v, player]( const size_t x, const size_t y )
+  {
+    if( x % 2 == 1 )
     {
-      Coordinate c(x, y);
-      if( IsRoom(c) )
-      {
-        std::cout << DisplayRoom(c);
-      }
-      else
-      {
-        std::cout << DisplayBorder(c);
+      return RoomRevealed( v, player, x / 2, y / 2 - 1 ) ||
+             RoomRevealed( v, player, x / 2, y / 2 );
+    }
+    return RoomRevealed( v, player, x / 2 - 1, y / 2 ) ||
+           RoomRevealed( v, player, x / 2, y / 2 );
+  };
 
-        // Doubles the horizontal draw distance of a Map Room (and the Borders
-        // directly above/below a Map Room) from 1 to 2 characters
-        if( x % 2 == 1 )
-        {
-          std::cout << DisplayBorder(c);
-        }
-      }
+  if( c.x % 2 == 1 || c.y % 2 == 1 )
+  {
+    return shown( c.x, c.y ) ? LabyrinthMapBorder::kWalls : 0;
+  }
+
+  std::uint8_t walls = 0;
+  if( c.y > 0 && shown(c.x, c.y - 1) )
+  {
+    walls |= LabyrinthMapBorder::kNorth;
+  }
+  if( c.x + 1 < map_x_size_ && shown(c.x + 1, c.y) )
+  {
+    walls |= LabyrinthMapBorder::kEast;
+  }
+  if( c.y + 1 < map_y_size_ && shown(c.x, c.y + 1) )
+  {
+    walls |= LabyrinthMapBorder::kSouth;
+  }
+  if( c.x > 0 && shown(c.x - 1, c.y) )
+  {
+    walls |= LabyrinthMapBorder::kWest;
+  }
+  return walls;
+}
+
+// These private methods record changes to the Labyrinth.
+// Nothing is recorded before the map is materialized, as it is then built
+// from the current Labyrinth.
+void LabyrinthMap::RoomChanged( const Coordinate rm )
+{
+  if( !materialized_ || all_dirty_ || rm.x >= x_size_ || rm.y >= y_size_ )
+  {
+    return;
+  }
+
+  const size_t i = rm.y * x_size_ + rm.x;
+  if( !dirty_[i] )
+  {
+    dirty_[i] = true;
+    dirty_rooms_.push_back( i );
+  }
+}
+
+void LabyrinthMap::AllRoomsChanged()
+{
+  all_dirty_ = materialized_;
+}
+
+// This private method allocates the Map Rooms and Borders and builds them
+// from the Labyrinth, the first time the map is rendered.
+void LabyrinthMap::Materialize()
+{
+  LABYRINTH_INSTRUMENT_COUNT( InstrumentCounter::kMapRebuilds, 1 );
+  rooms_.resize( x_size_ * y_size_ );
+  borders_.resize( (y_size_ + 1) * map_x_size_ + y_size_ * (x_size_ + 1) );
+
+  CleanBorders();
+  Rebuild();
+  UpdateExit();
+
+  dirty_.assign( x_size_ * y_size_, false );
+  materialized_ = true;
+}
+
+// This private method updates the Map where the Labyrinth changed,
+// materializing it first if needed.
+void LabyrinthMap::Synchronize()
+{
+  if( !materialized_ )
+  {
+    Materialize();
+    return;
+  }
+
+  if( all_dirty_ )
+  {
+    LABYRINTH_INSTRUMENT_COUNT( InstrumentCounter::kMapRebuilds, 1 );
+    Rebuild();
+  }
+  else
+  {
+    LABYRINTH_INSTRUMENT_COUNT( InstrumentCounter::kRoomsRedrawn,
+                                dirty_rooms_.size() );
+    for( const size_t i : dirty_rooms_ )
+    {
+      const Coordinate c_laby( i % x_size_, i / x_size_ );
+      const Room& rm = l_->RowAt( c_laby.y )[c_laby.x];
+      UpdateRoomBorders( c_laby, rm );
+      UpdateRoomContents( c_laby, rm );
     }
-    std::cout << std::endl;
   }
+  UpdateExit();
 
-  std::cout << std::endl << std::endl;
-  DisplayLegend();
-  return;
+  for( const size_t i : dirty_rooms_ )
+  {
+    dirty_[i] = false;
+  }
+  dirty_rooms_.clear();
+  all_dirty_ = false;
 }
 
 // This private method returns true if the Coordinate is within the bounds
@@ -252,20 +773,21 @@ bool LabyrinthMap::IsRoom( const Coordinate c ) const
   }
 }
 
-// This private method returns a reference to the Map Coordinate at
-// the given Coordinate.
-// An exception is thrown if:
-//   The Coordinate is outside of the Map (domain_error)
-LabyrinthMapCoordinate&
-LabyrinthMap::MapCoordinateAt( const Coordinate c ) const
+// This private method returns a reference to the Map Border at the
+// given Coordinate, which must designate a Border of the Map.
+LabyrinthMapBorder& LabyrinthMap::BorderAt( const Coordinate c )
 {
-  if( !WithinBoundsOfMap(c) )
+  const size_t row_pair = (c.y / 2) * (map_x_size_ + x_size_ + 1);
+  if( c.y % 2 == 0 )
   {
-    throw std::domain_error( "Error: MapCoordinateAt() was given a "\
-      "Coordinate outside of the Map.\n" );
+    return borders_[row_pair + c.x];
   }
+  return borders_[row_pair + map_x_size_ + c.x / 2];
+}
 
-  return *(map_[c.y][c.x]);
+const LabyrinthMapBorder& LabyrinthMap::BorderAt( const Coordinate c ) const
+{
+  return const_cast<LabyrinthMap*>( this )->BorderAt( c );
 }
 
 // This private method converts a Labyrinth Coordinate to the same
@@ -324,181 +846,203 @@ void LabyrinthMap::MapToLabyrinth( Coordinate& c ) const
 // for that.
 void LabyrinthMap::CleanBorders()
 {
-  // Removing excess bounds on the exterior of the Labyrinth
-  for( size_t x = 0; x < map_x_size_; ++x )
-  {
-    map_[0][x]->SetWall( Direction::kNorth, false );
-    map_[map_y_size_-1][x]->SetWall( Direction::kSouth, false );
-  }
-  for( size_t y = 0; y < map_y_size_; ++y )
-  {
-    map_[y][0]->SetWall( Direction::kWest, false );
-    map_[y][map_x_size_-1]->SetWall( Direction::kEast, false );
-  }
-
-  // Removing excess bounds directly adjacent to Rooms
+  // Walks through the Borders in storage order, one Map row at a time
+  LabyrinthMapBorder* border = borders_.data();
   for( size_t y = 0; y < map_y_size_; ++y )
   {
-    for( size_t x = 0; x < map_x_size_; ++x )
-    {
-      Coordinate c(x, y);
-      if( !IsRoom(c) )
-      {
-        if( x % 2 == 1 )
-        {
-          map_[y][x]->SetWall( Direction::kNorth, false );
-          map_[y][x]->SetWall( Direction::kSouth, false );
-        }
-        else if( y % 2 == 1 )
-        {
-          map_[y][x]->SetWall( Direction::kWest, false );
-          map_[y][x]->SetWall( Direction::kEast, false );
-        }
-      }
-    }
-  }
-
-}
-
-// This private method updates the Map Borders by checking the contents
-// of the Labyrinth.
-// Borders in the Map but not in the Labyrinth will be removed from
-// the Map; borders in the Labyrinth but not in the Map will not
-// be added to the Map.
-void LabyrinthMap::UpdateBorders()
-{
-  // Loops through the Labyrinth, not the Map
-  for( size_t y = 0; y < y_size_; ++y )
-  {
-    for( size_t x = 0; x < x_size_; ++x )
+    const size_t row_length = (y % 2 == 0) ? map_x_size_ : x_size_ + 1;
+    for( size_t i = 0; i < row_length; ++i, ++border )
     {
-      Coordinate c_laby(x, y);
-      Coordinate c_map = c_laby;
-      try
+      // Removing excess bounds on the exterior of the Labyrinth
+      if( y == 0 )
       {
-        LabyrinthToMap(c_map);
+        border->Set( LabyrinthMapBorder::kNorth, false );
       }
-      catch( const std::exception& e )
+      if( y == map_y_size_ - 1 )
       {
-        std::cout << e.what();
+        border->Set( LabyrinthMapBorder::kSouth, false );
       }
-      Coordinate c_edit_1 = c_map;
-      Coordinate c_edit_2 = c_map;
-      Coordinate c_edit_3 = c_map;
-
-      RoomBorder rb_east;
-      RoomBorder rb_south;
-      try
+      if( i == 0 )
       {
-        rb_east  = l_->DirectionCheck( c_laby, Direction::kEast );
-        rb_south = l_->DirectionCheck( c_laby, Direction::kSouth );
+        border->Set( LabyrinthMapBorder::kWest, false );
       }
-      catch( const std::exception& e )
+      if( i == row_length - 1 )
       {
-        std::cout << e.what();
+        border->Set( LabyrinthMapBorder::kEast, false );
       }
-      const bool east_border = (rb_east != RoomBorder::kRoom) ? true : false;
-      const bool south_border = (rb_south != RoomBorder::kRoom) ? true : false;
 
-      // Sets the east border of the relevant Map coordinate
-      c_edit_1 = c_map;
-      (c_edit_1.x)++;
-      (c_edit_1.y)--;
-
-      c_edit_2 = c_map;
-      (c_edit_2.x)++;
-
-      c_edit_3 = c_map;
-      (c_edit_3.x)++;
-      (c_edit_3.y)++;
-
-      try
+      // Removing excess bounds directly adjacent to Rooms
+      if( y % 2 == 1 )
       {
-        (MapCoordinateAt(c_edit_1)).SetWall( Direction::kSouth, east_border );
-        (MapCoordinateAt(c_edit_2)).SetWall( Direction::kNorth, east_border );
-        (MapCoordinateAt(c_edit_2)).SetWall( Direction::kSouth, east_border );
-        (MapCoordinateAt(c_edit_3)).SetWall( Direction::kNorth, east_border );
+        border->Set( LabyrinthMapBorder::kWest | LabyrinthMapBorder::kEast,
+                     false );
       }
-      catch( const std::exception& e )
+      else if( i % 2 == 1 )
       {
-        std::cout << e.what();
+        border->Set( LabyrinthMapBorder::kNorth | LabyrinthMapBorder::kSouth,
+                     false );
       }
+    }
+  }
+}
 
-      // Sets the south border of the relevant Map coordinate
-      c_edit_1 = c_map;
-      (c_edit_1.y)++;
-      (c_edit_1.x)--;
-
-      c_edit_2 = c_map;
-      (c_edit_2.y)++;
-
-      c_edit_3 = c_map;
-      (c_edit_3.y)++;
-      (c_edit_3.x)++;
-
-      try
-      {
-        (MapCoordinateAt(c_edit_1)).SetWall( Direction::kEast, south_border );
-        (MapCoordinateAt(c_edit_2)).SetWall( Direction::kWest, south_border );
-        (MapCoordinateAt(c_edit_2)).SetWall( Direction::kEast, south_border );
-        (MapCoordinateAt(c_edit_3)).SetWall( Direction::kWest, south_border );
-      }
-      catch( const std::exception& e )
-      {
-        std::cout << e.what();
-      }
+// This private method updates every Map Border and Map Room from the
+// Labyrinth, on rebuild_pool_ if there is one.
+//
+// Each Room only writes its own Map Room and the Borders around it, so a
+// band of Labyrinth rows y_first to y_end writes Map rows 2 * y_first to
+// 2 * y_end: only the Border row at each end is shared with the next band.
+// The even bands are updated first, then the odd bands, so that bands which
+// run at the same time never share a row.
+void LabyrinthMap::Rebuild()
+{
+  size_t bands = 0;
+  if( rebuild_pool_ != nullptr )
+  {
+    bands = std::min( { 2 * rebuild_pool_->Workers(),
+                        x_size_ * y_size_ / kRebuildBandRooms,
+                        y_size_ } );
+  }
+  if( bands < 2 )
+  {
+    UpdateBorders( 0, y_size_ );
+    UpdateRooms( 0, y_size_ );
+    return;
+  }
 
-    }  // For loop
-  }  // For loop
+  for( size_t phase = 0; phase < 2; ++phase )
+  {
+    for( size_t band = phase; band < bands; band += 2 )
+    {
+      const size_t y_first = band * y_size_ / bands;
+      const size_t y_end = (band + 1) * y_size_ / bands;
+      rebuild_pool_->Submit( [this, y_first, y_end]( const size_t )
+                             {
+                               UpdateBorders( y_first, y_end );
+                               UpdateRooms( y_first, y_end );
+                             },
+                             band / 2 );
+    }
+    rebuild_pool_->Wait();
+  }
+}
 
+// This private method updates the Map Borders by checking the contents
+// of the Labyrinth rows from y_first up to (not including) y_end.
+// Borders in the Map but not in the Labyrinth will be removed from
+// the Map; borders in the Labyrinth but not in the Map will not
+// be added to the Map.
+void LabyrinthMap::UpdateBorders( const size_t y_first, const size_t y_end )
+{
+  LABYRINTH_INSTRUMENT_SCOPE( InstrumentOp::kUpdateBorders );
+  // Loops through the Labyrinth, not the Map, one contiguous row at a time
+  for( size_t y = y_first; y < y_end; ++y )
+  {
+    const RoomRow row = l_->RowAt( y );
+    for( size_t x = 0; x < x_size_; ++x )
+    {
+      UpdateRoomBorders( Coordinate(x, y), row[x] );
+    }
+  }
 }
 
 // This private method updates the Map Rooms by checking the contents
-// of the Labyrinth.
-void LabyrinthMap::UpdateRooms()
+// of the Labyrinth rows from y_first up to (not including) y_end.
+void LabyrinthMap::UpdateRooms( const size_t y_first, const size_t y_end )
 {
-  for( size_t y = 0; y < y_size_; ++y )
+  LABYRINTH_INSTRUMENT_SCOPE( InstrumentOp::kUpdateRooms );
+  for( size_t y = y_first; y < y_end; ++y )
   {
+    const RoomRow row = l_->RowAt( y );
     for( size_t x = 0; x < x_size_; ++x )
     {
-      Coordinate c_laby(x, y);
-      Coordinate c_map = c_laby;
-      try
-      {
-        LabyrinthToMap(c_map);
-      }
-      catch( const std::exception& e )
-      {
-        std::cout << e.what();
-      }
+      UpdateRoomContents( Coordinate(x, y), row[x] );
+    }
+  }
 
-      try
-      {
-        MapCoordinateAt(c_map).SetInhabitant( l_->GetInhabitant(c_laby) );
-      }
-      catch( const std::exception& e )
-      {
-        std::cout << e.what();
-      }
+  return;
+}
 
-      try
-      {
-        MapCoordinateAt(c_map).SetItem( l_->ItemAt(c_laby) );
-      }
-      catch( const std::exception& e )
+// These private methods update the east and south Map Borders, and the
+// contents, of a single Map Room from the given Labyrinth Room.
+void LabyrinthMap::UpdateRoomBorders( const Coordinate c_laby, const Room& rm )
+{
+  const size_t x = c_laby.x * 2 + 1;
+  const size_t y = c_laby.y * 2 + 1;
+
+  const RoomBorder rb_east  = rm.DirectionCheck( Direction::kEast );
+  const RoomBorder rb_south = rm.DirectionCheck( Direction::kSouth );
+  const bool east_border = (rb_east != RoomBorder::kRoom) ? true : false;
+  const bool south_border = (rb_south != RoomBorder::kRoom) ? true : false;
+
+  // Sets the east border of the relevant Map coordinate
+  BorderAt( Coordinate(x + 1, y - 1) ).Set( LabyrinthMapBorder::kSouth,
+                                            east_border );
+  BorderAt( Coordinate(x + 1, y) ).Set( LabyrinthMapBorder::kNorth |
+                                        LabyrinthMapBorder::kSouth,
+                                        east_border );
+  BorderAt( Coordinate(x + 1, y + 1) ).Set( LabyrinthMapBorder::kNorth,
+                                            east_border );
+
+  // Sets the south border of the relevant Map coordinate
+  BorderAt( Coordinate(x - 1, y + 1) ).Set( LabyrinthMapBorder::kEast,
+                                            south_border );
+  BorderAt( Coordinate(x, y + 1) ).Set( LabyrinthMapBorder::kWest |
+                                        LabyrinthMapBorder::kEast,
+                                        south_border );
+  BorderAt( Coordinate(x + 1, y + 1) ).Set( LabyrinthMapBorder::kWest,
+                                            south_border );
+}
+
+// This private method marks the Map Border with the exit of the
+// Labyrinth, and clears the mark it last made if the exit has moved or
+// been removed (e.g. by Labyrinth::Rollback()).
+void LabyrinthMap::UpdateExit()
+{
+  bool marked = false;
+  Coordinate border;
+  if( l_->ExitSet() )
+  {
+    const Coordinate exit = l_->GetExit();
+    const Direction d = l_->GetExitDirection();
+    if( exit.x < x_size_ && exit.y < y_size_ && d != Direction::kNone )
+    {
+      marked = true;
+      border = Coordinate( exit.x * 2 + 1, exit.y * 2 + 1 );
+      switch( d )
       {
-        std::cout << e.what();
+        case Direction::kNorth: --border.y; break;
+        case Direction::kEast:  ++border.x; break;
+        case Direction::kSouth: ++border.y; break;
+        default:                --border.x; break;
       }
     }
   }
 
-  return;
+  if( exit_marked_ && !(marked && border == exit_border_) )
+  {
+    BorderAt( exit_border_ ).Set( LabyrinthMapBorder::kExit, false );
+  }
+  if( marked )
+  {
+    BorderAt( border ).Set( LabyrinthMapBorder::kExit, true );
+  }
+  exit_marked_ = marked;
+  exit_border_ = border;
+}
+
+void LabyrinthMap::UpdateRoomContents( const Coordinate c_laby,
+                                       const Room& rm )
+{
+  LabyrinthMapRoom& map_rm = rooms_[c_laby.y * x_size_ + c_laby.x];
+  map_rm.inh = rm.GetInhabitant();
+  map_rm.itm = rm.GetItem();
 }
 
-// This private method displays the x-axis label as well as numbering
+// This private method appends the x-axis label as well as numbering
 // of the x-coordinates of Rooms.
-// Only to be used by Display().
-void LabyrinthMap::LabelXAxis() const
+// Only to be used by Render().
+void LabyrinthMap::LabelXAxis( std::string& out ) const
 {
   // X label
   //
@@ -507,66 +1051,55 @@ void LabyrinthMap::LabelXAxis() const
   // because the final map consists of Rooms which have 1 Border character
   // and 2 space characters.
   const size_t kXMiddle = (x_size_ * 3)/2 + 1;
-  for( size_t i = 0; i < kXMiddle; ++i )
-  {
-    std::cout << " ";
-  }
-  std::cout << "     ";  // Alignment with y-axis label
-  std::cout << "X" << std::endl << std::endl;
+  out.append( kXMiddle, ' ' );
+  out += "     ";  // Alignment with y-axis label
+  out += "X\n\n";
 
   // X-axis marks
-  std::cout << "     ";  // Alignment with y-axis label
+  out += "     ";  // Alignment with y-axis label
   for( size_t i = 0; i < x_size_; ++i )
   {
     if( i < 10 )  // Correcting for digit positions
     {
-      std::cout << " ";
+      out += ' ';
     }
-    std::cout << " " << i;
+    out += ' ';
+    out += std::to_string( i );
   }
-  std::cout << std::endl;
-
-  return;
+  out += '\n';
 }
 
-// This private method displays numbering of the y-coordinates of a Room
+// This private method appends numbering of the y-coordinates of a Room
 // as well as the y-axis label (if in the correct position), or padding
 // if the row has no Rooms.
-// Only to be used by Display().
-// Should be called every time a row of the Map is printed.
-void LabyrinthMap::LabelYAxis( const size_t y ) const
+// Only to be used by Render().
+// Should be called every time a row of the Map is rendered.
+void LabyrinthMap::LabelYAxis( const size_t y, std::string& out ) const
 {
   // Y-axis label position
   const size_t kYMiddle = (y_size_)/2 + 1;
 
   // Y label
-  if( y == kYMiddle )
-  {
-    std::cout << "Y";
-  }
-  else
-  {
-    std::cout << " ";
-  }
+  out += ( y == kYMiddle ) ? 'Y' : ' ';
 
   // Numbers rows with Rooms
   if( y % 2 == 1 )
   {
     if( y < 10 )  // Correcting for digit positions
     {
-      std::cout << " ";
+      out += ' ';
     }
-    Coordinate c(1, y);
-    MapToLabyrinth(c);
-    std::cout << " " << c.y << " ";
+    out += ' ';
+    out += std::to_string( (y - 1) / 2 );
+    out += ' ';
   }
   else
   {
-    std::cout << "    ";  // Alignment
+    out += "    ";  // Alignment
   }
 }
 
-// This private method returns characters with the contents of the
+// This private method appends characters with the contents of the
 // given Room Coordinate.
 // Legend of symbols:
 //   Inhabitants:
@@ -579,183 +1112,59 @@ void LabyrinthMap::LabelYAxis( const size_t y ) const
 //     None:
 //     Bullet:   •
 //     Treasure: T
-// An exception is thrown if:
-//   The Coordinate is outside of the Labyrinth (domain_error)
-//   The Coordinate designates a Border (logic_error)
-std::string LabyrinthMap::DisplayRoom( const Coordinate c ) const
+// The Coordinate must designate a Room of the Map.
+void LabyrinthMap::DisplayRoom( const Coordinate c, std::string& out ) const
 {
-  if( !WithinBoundsOfMap(c) )
-  {
-    throw std::domain_error( "Error: DisplayRoom() was given an invalid "\
-      "Coordinate.\n" );
-  }
-  else if( !IsRoom(c) )
-  {
-    throw std::logic_error( "Error: DisplayRoom() was given a "\
-      "Border Coordinate.\n" );
-  }
+  const LabyrinthMapRoom& map_rm =
+    rooms_[((c.y - 1) / 2) * x_size_ + (c.x - 1) / 2];
 
-  std::string s;
-
-  Inhabitant inh = Inhabitant::kNone;
-  try
-  {
-    inh = MapCoordinateAt(c).GetInhabitant();
-  }
-  catch( const std::exception& e )
-  {
-    std::cout << e.what();
-  }
-  switch( inh )
+  switch( map_rm.inh )
   {
     case Inhabitant::kMinotaur:
-      s += "M";
+      out += 'M';
       break;
     case Inhabitant::kMinotaurDead:
-      s += "m";
+      out += 'm';
       break;
     case Inhabitant::kMirror:
-      s += "O";
+      out += 'O';
       break;
     case Inhabitant::kMirrorCracked:
-      s += "0";
+      out += '0';
       break;
     default:
-      s += " ";
+      out += ' ';
       break;
   }
 
-  Item itm = Item::kNone;
-  try
-  {
-    itm = MapCoordinateAt(c).ItemAt();
-  }
-  catch( const std::exception& e )
-  {
-    std::cout << e.what();
-  }
-  switch( itm )
+  switch( map_rm.itm )
   {
     case Item::kBullet:
-      s += "•";
+      out += u8"•";
       break;
     case Item::kTreasure:
-      s += "T";
+      out += 'T';
       break;
     default:
-      s += " ";
+      out += ' ';
       break;
   }
-
-  return s;
 }
 
-// This private method returns a character representing the given
-// Border Coordinate.
-// An exception is thrown if:
-//   The Coordinate is outside of the Labyrinth (domain_error)
-//   The Coordinate designates a Room (logic_error)
-std::string LabyrinthMap::DisplayBorder( const Coordinate c ) const
+// This private method appends a character representing the given
+// Border Coordinate, with only the Wall bits in walls.
+// The Coordinate must designate a Border of the Map.
+void LabyrinthMap::DisplayBorder( const Coordinate c,
+                                  std::string& out,
+                                  const std::uint8_t walls ) const
 {
-  if( !WithinBoundsOfMap(c) )
-  {
-    throw std::domain_error( "Error: DisplayBorder() was given an invalid "\
-      "Coordinate.\n" );
-  }
-  else if( IsRoom(c) )
-  {
-    throw std::logic_error( "Error: DisplayBorder() was given a "\
-      "Room Coordinate.\n" );
-  }
-
-  bool n;
-  bool e;
-  bool s;
-  bool w;
-
-  try
-  {
-    n = MapCoordinateAt(c).IsWall( Direction::kNorth );
-    e = MapCoordinateAt(c).IsWall( Direction::kEast );
-    s = MapCoordinateAt(c).IsWall( Direction::kSouth );
-    w = MapCoordinateAt(c).IsWall( Direction::kWest );
-  }
-  catch( std::exception& e )
-  {
-    std::cout << e.what();
-  }
-
-  char borders_nesw[5] = "0000";
-
-  if( n )
-  {
-    borders_nesw[0] = '1';
-  }
-  if( e )
-  {
-    borders_nesw[1] = '1';
-  }
-  if( s )
-  {
-    borders_nesw[2] = '1';
-  }
-  if( w )
-  {
-    borders_nesw[3] = '1';
-  }
-
-  // A true abomination lies ahead.
-  // Please let me know if you have any alternative ideas so I can put this
-  // out of its misery.
-  //
-  // Characters taken from the Unicode section of:
-  // https://en.wikipedia.org/wiki/Box-drawing_character
-
-  if( strcmp(borders_nesw, "0000") == 0 ) return " ";
-
-  else if( strcmp(borders_nesw, "1000") == 0 ) return u8"╵";
-  else if( strcmp(borders_nesw, "0100") == 0 ) return u8"╶";
-  else if( strcmp(borders_nesw, "0010") == 0 ) return u8"╷";
-  else if( strcmp(borders_nesw, "0001") == 0 ) return u8"╴";
-
-  else if( strcmp(borders_nesw, "1100") == 0 ) return u8"└";
-  else if( strcmp(borders_nesw, "1010") == 0 ) return u8"│";
-  else if( strcmp(borders_nesw, "1001") == 0 ) return u8"┘";
-  else if( strcmp(borders_nesw, "0110") == 0 ) return u8"┌";
-  else if( strcmp(borders_nesw, "0101") == 0 ) return u8"─";
-  else if( strcmp(borders_nesw, "0011") == 0 ) return u8"┐";
-
-  else if( strcmp(borders_nesw, "1110") == 0 ) return u8"├";
-  else if( strcmp(borders_nesw, "1101") == 0 ) return u8"┴";
-  else if( strcmp(borders_nesw, "1011") == 0 ) return u8"┤";
-  else if( strcmp(borders_nesw, "0111") == 0 ) return u8"┬";
-
-  else if( strcmp(borders_nesw, "1111") == 0 ) return u8"┼";
-
-  else
-  {
-    throw std::logic_error( "Error: DisplayBorder()'s check for "\
-      "NESW values missed a possible value.\n" );
-  }
+  const Glyph& glyph =
+    kBorderGlyphs[BorderAt(c).bits & walls & LabyrinthMapBorder::kWalls];
+  out.append( glyph.text, glyph.length );
 }
 
-// This private method displays a legend for the Map symbols.
-void LabyrinthMap::DisplayLegend() const
+// This private method appends a legend for the Map symbols.
+void LabyrinthMap::DisplayLegend( std::string& out ) const
 {
-  std::cout << "        LEGEND" << std::endl;
-  std::cout << "┌─────────────────────┐" << std::endl;
-
-  std::cout << "│ INHABITANTS         │" << std::endl;
-  std::cout << "│ Minotaur (live):  M │" << std::endl;
-  std::cout << "│ Minotaur (dead):  m │" << std::endl;
-  std::cout << "│ Mirror (intact):  O │" << std::endl;
-  std::cout << "│ Mirror (cracked): 0 │" << std::endl;
-
-  std::cout << "│                     │" << std::endl;
-
-  std::cout << "│ ITEMS               │" << std::endl;
-  std::cout << "│ Bullet:           • │" << std::endl;
-  std::cout << "│ Treasure:         T │" << std::endl;
-
-  std::cout << "└─────────────────────┘" << std::endl;
+  out += kLegend;
 }
@@ -0,0 +1,418 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ file contains the implementation of the output formats of a
+ * LabyrinthMap other than its UTF-8 text: compact ASCII, a 1-bit PBM bitmap
+ * and an indexed-colour PNG image.
+ *
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../include/labyrinth_map.hpp"
+#include "../include/labyrinth_map_backend.hpp"
+
+constexpr size_t PngMapBackend::kChunkSize;
+
+namespace
+{
+
+// Characters of AsciiMapBackend, indexed by MapCell.
+const char kAsciiCells[] = " #ETMO*m0";
+
+// Colours of PngMapBackend (red, green, blue), indexed by MapCell.
+const std::uint8_t kPalette[][3] =
+{
+  { 255, 255, 255 },  // Open
+  {   0,   0,   0 },  // Wall
+  {   0, 160,   0 },  // Exit
+  { 255, 200,   0 },  // Treasure
+  { 200,   0,   0 },  // Minotaur (live)
+  {   0, 120, 255 },  // Mirror (intact)
+  { 128, 128, 128 },  // Bullet
+  { 100,   0,   0 },  // Minotaur (dead)
+  { 150, 200, 255 },  // Mirror (cracked)
+};
+
+// Deflate lengths of a run (3 to 258) which begin each length code from
+// 257, and the number of extra bits after each code.
+const std::uint16_t kLengthBase[29] =
+{
+  3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+  35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+const std::uint8_t kLengthExtra[29] =
+{
+  0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+  3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+
+// Largest number of bytes which can be added to an Adler-32 sum before it
+// must be reduced.
+constexpr size_t kAdlerBlock = 5552;
+constexpr std::uint32_t kAdlerModulus = 65521;
+
+// This local function returns the CRC-32 of the data, continuing from crc
+// (which is 0 for new data).
+std::uint32_t Crc32( std::uint32_t crc,
+                     const std::uint8_t* const data,
+                     const size_t size );
+
+// This local function appends value to out, most significant byte first.
+void AppendBigEndian( std::vector<std::uint8_t>& out,
+                      const std::uint32_t value );
+
+// This local function returns the first count bits of code in reverse
+// order, as Huffman codes are stored from their most significant bit.
+std::uint32_t ReverseBits( std::uint32_t code, const unsigned count );
+
+// This local function returns the CRC-32 of the data, continuing from crc
+// (which is 0 for new data).
+std::uint32_t Crc32( std::uint32_t crc,
+                     const std::uint8_t* const data,
+                     const size_t size )
+{
+  static const std::vector<std::uint32_t> table = []()
+  {
+    std::vector<std::uint32_t> t( 256 );
+    for( std::uint32_t n = 0; n < 256; ++n )
+    {
+      std::uint32_t c = n;
+      for( unsigned k = 0; k < 8; ++k )
+      {
+        c = ( c & 1 ) ? 0xEDB88320u ^ ( c >> 1 ) : c >> 1;
+      }
+      t[n] = c;
+    }
+    return t;
+  }();
+
+  crc = ~crc;
+  for( size_t i = 0; i < size; ++i )
+  {
+    crc = table[(crc ^ data[i]) & 0xFF] ^ ( crc >> 8 );
+  }
+  return ~crc;
+}
+
+// This local function appends value to out, most significant byte first.
+void AppendBigEndian( std::vector<std::uint8_t>& out,
+                      const std::uint32_t value )
+{
+  out.push_back( static_cast<std::uint8_t>(value >> 24) );
+  out.push_back( static_cast<std::uint8_t>(value >> 16) );
+  out.push_back( static_cast<std::uint8_t>(value >> 8) );
+  out.push_back( static_cast<std::uint8_t>(value) );
+}
+
+// This local function returns the first count bits of code in reverse
+// order, as Huffman codes are stored from their most significant bit.
+std::uint32_t ReverseBits( std::uint32_t code, const unsigned count )
+{
+  std::uint32_t reversed = 0;
+  for( unsigned i = 0; i < count; ++i, code >>= 1 )
+  {
+    reversed = ( reversed << 1 ) | ( code & 1 );
+  }
+  return reversed;
+}
+
+}  // Local namespace
+
+// ASCII:
+
+// Parameterized constructor
+// The stream must outlive the backend.
+AsciiMapBackend::AsciiMapBackend( std::ostream& os ) :
+  os_(os)
+{
+}
+
+void AsciiMapBackend::Begin( const size_t width, const size_t )
+{
+  line_.assign( width + 1, '\n' );
+}
+
+// An exception is thrown if:
+//   The stream cannot be written (runtime_error)
+void AsciiMapBackend::Row( const MapCell* const cells )
+{
+  const size_t width = line_.size() - 1;
+  for( size_t x = 0; x < width; ++x )
+  {
+    line_[x] = kAsciiCells[static_cast<size_t>(cells[x])];
+  }
+  os_.write( line_.data(), static_cast<std::streamsize>(line_.size()) );
+  if( !os_ )
+  {
+    throw std::runtime_error( "Error: Row() could not write the "\
+      "stream.\n" );
+  }
+}
+
+// PBM:
+
+// Parameterized constructor
+// The stream must outlive the backend.
+PbmMapBackend::PbmMapBackend( std::ostream& os ) :
+  os_(os)
+{
+}
+
+// An exception is thrown if:
+//   The stream cannot be written (runtime_error)
+void PbmMapBackend::Begin( const size_t width, const size_t height )
+{
+  width_ = width;
+  row_.assign( (width + 7) / 8, 0 );
+  os_ << "P4\n" << width << ' ' << height << '\n';
+  if( !os_ )
+  {
+    throw std::runtime_error( "Error: Begin() could not write the "\
+      "stream.\n" );
+  }
+}
+
+void PbmMapBackend::Row( const MapCell* const cells )
+{
+  std::fill( row_.begin(), row_.end(), 0 );
+  for( size_t x = 0; x < width_; ++x )
+  {
+    if( cells[x] == MapCell::kWall )
+    {
+      row_[x / 8] |= static_cast<std::uint8_t>( 0x80 >> (x % 8) );
+    }
+  }
+  os_.write( reinterpret_cast<const char*>(row_.data()),
+             static_cast<std::streamsize>(row_.size()) );
+  if( !os_ )
+  {
+    throw std::runtime_error( "Error: Row() could not write the "\
+      "stream.\n" );
+  }
+}
+
+// PNG:
+
+// Parameterized constructor
+// The stream must outlive the backend.
+PngMapBackend::PngMapBackend( std::ostream& os ) :
+  os_(os)
+{
+}
+
+// An exception is thrown if:
+//   The stream cannot be written (runtime_error)
+void PngMapBackend::Begin( const size_t width, const size_t height )
+{
+  width_ = width;
+  row_.assign( 1 + (width + 1) / 2, 0 );
+  pending_.clear();
+  bits_ = 0;
+  bit_count_ = 0;
+  adler_a_ = 1;
+  adler_b_ = 0;
+
+  const std::uint8_t signature[8] = { 137, 'P', 'N', 'G', '\r', '\n', 26,
+                                      '\n' };
+  os_.write( reinterpret_cast<const char*>(signature), sizeof(signature) );
+
+  // Bit depth 4, indexed colour, deflate, no interlacing
+  std::vector<std::uint8_t> header;
+  AppendBigEndian( header, static_cast<std::uint32_t>(width) );
+  AppendBigEndian( header, static_cast<std::uint32_t>(height) );
+  const std::uint8_t format[5] = { 4, 3, 0, 0, 0 };
+  header.insert( header.end(), format, format + sizeof(format) );
+  WriteChunk( "IHDR", header.data(), header.size() );
+  WriteChunk( "PLTE", &kPalette[0][0], sizeof(kPalette) );
+
+  // The zlib header: deflate with a 32 KiB window
+  pending_.push_back( 0x78 );
+  pending_.push_back( 0x01 );
+}
+
+void PngMapBackend::Row( const MapCell* const cells )
+{
+  std::fill( row_.begin(), row_.end(), 0 );
+  for( size_t x = 0; x < width_; ++x )
+  {
+    const unsigned index = static_cast<unsigned>( cells[x] );
+    row_[1 + x / 2] |= static_cast<std::uint8_t>(
+      x % 2 == 0 ? index << 4 : index );
+  }
+
+  for( size_t i = 0; i < row_.size(); i += kAdlerBlock )
+  {
+    const size_t end = std::min( i + kAdlerBlock, row_.size() );
+    for( size_t j = i; j < end; ++j )
+    {
+      adler_a_ += row_[j];
+      adler_b_ += adler_a_;
+    }
+    adler_a_ %= kAdlerModulus;
+    adler_b_ %= kAdlerModulus;
+  }
+
+  CompressRow();
+  if( pending_.size() >= kChunkSize )
+  {
+    WritePending();
+  }
+}
+
+void PngMapBackend::End()
+{
+  // An empty final block, then the bits are padded to a byte
+  PutBits( 1, 1 );
+  PutBits( 1, 2 );
+  PutEndOfBlock();
+  if( bit_count_ > 0 )
+  {
+    PutBits( 0, 8 - bit_count_ );
+  }
+  AppendBigEndian( pending_, (adler_b_ << 16) | adler_a_ );
+  WritePending();
+  WriteChunk( "IEND", nullptr, 0 );
+}
+
+// PRIVATE METHODS:
+
+// This private method appends the bits of value, from the least
+// significant, to the compressed bytes.
+void PngMapBackend::PutBits( const std::uint32_t value, const unsigned count )
+{
+  bits_ |= value << bit_count_;
+  bit_count_ += count;
+  while( bit_count_ >= 8 )
+  {
+    pending_.push_back( static_cast<std::uint8_t>(bits_) );
+    bits_ >>= 8;
+    bit_count_ -= 8;
+  }
+}
+
+// This private method appends a literal byte, a run of the byte before
+// (3 to 258 bytes long), or the end of a block, with the fixed Huffman
+// codes of deflate.
+void PngMapBackend::PutLiteral( const unsigned value )
+{
+  if( value < 144 )
+  {
+    PutBits( ReverseBits(0x30 + value, 8), 8 );
+  }
+  else
+  {
+    PutBits( ReverseBits(0x190 + value - 144, 9), 9 );
+  }
+}
+
+void PngMapBackend::PutRun( const size_t length )
+{
+  size_t code = 28;
+  while( kLengthBase[code] > length )
+  {
+    --code;
+  }
+
+  // Length codes 257 to 279 have 7 bits, and 280 to 285 have 8 bits
+  const unsigned symbol = static_cast<unsigned>( 257 + code );
+  if( symbol < 280 )
+  {
+    PutBits( ReverseBits(symbol - 256, 7), 7 );
+  }
+  else
+  {
+    PutBits( ReverseBits(0xC0 + symbol - 280, 8), 8 );
+  }
+  PutBits( static_cast<std::uint32_t>(length - kLengthBase[code]),
+           kLengthExtra[code] );
+
+  // Distance 1 (the byte before) is distance code 0, of 5 bits
+  PutBits( 0, 5 );
+}
+
+void PngMapBackend::PutEndOfBlock()
+{
+  PutBits( 0, 7 );
+}
+
+// This private method appends row_ as a compressed block, in which each
+// run of a repeated byte is a literal followed by a copy of it.
+void PngMapBackend::CompressRow()
+{
+  PutBits( 0, 1 );  // Not the final block
+  PutBits( 1, 2 );  // Fixed Huffman codes
+
+  const size_t size = row_.size();
+  size_t i = 0;
+  while( i < size )
+  {
+    const std::uint8_t value = row_[i];
+    PutLiteral( value );
+    size_t run = 0;
+    while( i + 1 + run < size && run < 258 && row_[i + 1 + run] == value )
+    {
+      ++run;
+    }
+    if( run >= 3 )
+    {
+      PutRun( run );
+      i += 1 + run;
+    }
+    else
+    {
+      ++i;
+    }
+  }
+  PutEndOfBlock();
+}
+
+// This private method writes the pending compressed bytes as an IDAT
+// chunk.
+// An exception is thrown if:
+//   The stream cannot be written (runtime_error)
+void PngMapBackend::WritePending()
+{
+  if( !pending_.empty() )
+  {
+    WriteChunk( "IDAT", pending_.data(), pending_.size() );
+    pending_.clear();
+  }
+}
+
+// This private method writes a chunk with the given type and data.
+// An exception is thrown if:
+//   The stream cannot be written (runtime_error)
+void PngMapBackend::WriteChunk( const char* const type,
+                                const std::uint8_t* const data,
+                                const size_t size )
+{
+  std::vector<std::uint8_t> length;
+  AppendBigEndian( length, static_cast<std::uint32_t>(size) );
+  const std::uint8_t* const type_bytes =
+    reinterpret_cast<const std::uint8_t*>( type );
+  std::vector<std::uint8_t> crc;
+  AppendBigEndian( crc, Crc32(Crc32(0, type_bytes, 4), data, size) );
+
+  os_.write( reinterpret_cast<const char*>(length.data()), 4 );
+  os_.write( type, 4 );
+  if( size > 0 )
+  {
+    os_.write( reinterpret_cast<const char*>(data),
+               static_cast<std::streamsize>(size) );
+  }
+  os_.write( reinterpret_cast<const char*>(crc.data()), 4 );
+  if( !os_ )
+  {
+    throw std::runtime_error( "Error: WriteChunk() could not write the "\
+      "stream.\n" );
+  }
+}
@@ -0,0 +1,215 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ file contains the implementation of the LabyrinthPipeline class,
+ * which generates, validates and saves many Labyrinths in parallel.
+ *
+ */
+
+#include <bitset>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../include/coordinate.hpp"
+#include "../include/room.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_generator.hpp"
+#include "../include/labyrinth_file.hpp"
+#include "../include/work_stealing_pool.hpp"
+#include "../include/labyrinth_pipeline.hpp"
+
+namespace
+{
+
+// Largest size of a LabyrinthMode::kSmall Labyrinth made by a pipeline.
+constexpr size_t kSmallMaxSize = 20;
+
+// This local function returns the mode for a Labyrinth of the given size.
+LabyrinthMode ModeFor( const size_t x_size, const size_t y_size );
+
+// This local function returns the nanoseconds since the given time.
+std::uint64_t NanosecondsSince(
+  const std::chrono::steady_clock::time_point start );
+
+// This local function returns the mode for a Labyrinth of the given size.
+LabyrinthMode ModeFor( const size_t x_size, const size_t y_size )
+{
+  return x_size <= kSmallMaxSize && y_size <= kSmallMaxSize ?
+         LabyrinthMode::kSmall : LabyrinthMode::kLarge;
+}
+
+// This local function returns the nanoseconds since the given time.
+std::uint64_t NanosecondsSince(
+  const std::chrono::steady_clock::time_point start )
+{
+  return static_cast<std::uint64_t>(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - start ).count() );
+}
+
+}  // Local namespace
+
+// Parameterized constructor
+// An exception is thrown if:
+//   A size of 0 is given, or a size greater than the maximum of
+//     LabyrinthMode::kLarge (domain_error)
+LabyrinthPipeline::LabyrinthPipeline( const PipelineOptions& options ) :
+  options_(options),
+  pool_(options.workers)
+{
+  // A Labyrinth checks the sizes; a kLarge Labyrinth does not allocate its
+  // Rooms until they are modified.
+  Labyrinth( options_.x_size, options_.y_size,
+             ModeFor(options_.x_size, options_.y_size) );
+
+  for( size_t i = 0; i < pool_.Workers(); ++i )
+  {
+    workers_.push_back( std::make_unique<Worker>(options_.generator) );
+  }
+}
+
+// This method makes a Labyrinth for each seed, in parallel, and returns
+// their results in the order of the seeds.
+std::vector<PipelineResult> LabyrinthPipeline::Run(
+  const std::vector<std::uint64_t>& seeds )
+{
+  std::vector<PipelineResult> results( seeds.size() );
+  for( size_t i = 0; i < seeds.size(); ++i )
+  {
+    results[i].seed = seeds[i];
+    PipelineResult* const result = &results[i];
+    pool_.Submit( [this, result]( const size_t worker )
+                  {
+                    Produce( *workers_[worker], *result );
+                  },
+                  i % pool_.Workers() );
+  }
+  pool_.Wait();
+  return results;
+}
+
+// This method returns the options of the pipeline.
+const PipelineOptions& LabyrinthPipeline::Options() const
+{
+  return options_;
+}
+
+// This method checks a Labyrinth.
+MazeValidation LabyrinthPipeline::Validate( const Labyrinth& l )
+{
+  std::vector<std::uint32_t> queue;
+  std::vector<std::uint8_t> seen;
+  return Validate( l, queue, seen );
+}
+
+// PRIVATE METHODS:
+
+LabyrinthPipeline::Worker::Worker( const GeneratorOptions& options ) :
+  generator(options)
+{
+}
+
+// This private method makes the Labyrinth of one seed.
+void LabyrinthPipeline::Produce( Worker& w, PipelineResult& result ) const
+{
+  try
+  {
+    auto start = std::chrono::steady_clock::now();
+    Labyrinth l( options_.x_size, options_.y_size,
+                 ModeFor(options_.x_size, options_.y_size) );
+    w.generator.SetSeed( result.seed );
+    w.generator.Generate( l );
+    result.generate_time = NanosecondsSince( start );
+
+    start = std::chrono::steady_clock::now();
+    result.validation = Validate( l, w.queue, w.seen );
+    result.validate_time = NanosecondsSince( start );
+
+    if( !options_.directory.empty() &&
+        ( result.validation.Valid() || options_.save_invalid ) )
+    {
+      start = std::chrono::steady_clock::now();
+      const std::string path = options_.directory + "/" + options_.prefix +
+                               std::to_string( result.seed ) + ".laby";
+      LabyrinthFile::Save( l, path );
+      result.path = path;
+      result.write_time = NanosecondsSince( start );
+    }
+  }
+  catch( const std::exception& e )
+  {
+    result.error = e.what();
+  }
+}
+
+// This private method checks a Labyrinth with the given scratch space.
+MazeValidation LabyrinthPipeline::Validate( const Labyrinth& l,
+                                            std::vector<std::uint32_t>& queue,
+                                            std::vector<std::uint8_t>& seen )
+{
+  const size_t rooms = l.XSize() * l.YSize();
+  size_t degrees = 0;
+  const size_t reached = Flood( l, queue, seen, degrees );
+
+  // Each connection is counted from both of its Rooms. A connected graph
+  // is a tree (one path between any two Rooms) exactly when it has one
+  // connection fewer than it has Rooms.
+  MazeValidation v;
+  v.connected = reached == rooms;
+  v.perfect = v.connected && degrees / 2 == rooms - 1;
+
+  const auto reachable = [&l, &seen]( const Coordinate rm )
+  {
+    return seen[rm.y * l.XSize() + rm.x] != 0;
+  };
+  v.exit_reachable = l.ExitSet() && reachable( l.GetExit() );
+  v.treasure_reachable = l.TreasureSet() && reachable( l.GetTreasure() ) &&
+                         reachable( l.GetSpawn2() );
+  return v;
+}
+
+// This private method marks every Room reachable from spawn 1 in seen,
+// returns how many there are, and adds the number of connections of each
+// of them to degrees.
+size_t LabyrinthPipeline::Flood( const Labyrinth& l,
+                                 std::vector<std::uint32_t>& queue,
+                                 std::vector<std::uint8_t>& seen,
+                                 size_t& degrees )
+{
+  const size_t x_size = l.XSize();
+  seen.assign( x_size * l.YSize(), 0 );
+  queue.clear();
+
+  const Coordinate spawn = l.GetSpawn1();
+  const std::uint32_t first =
+    static_cast<std::uint32_t>( spawn.y * x_size + spawn.x );
+  seen[first] = 1;
+  queue.push_back( first );
+
+  // The queue is never popped, so its size is the number of Rooms reached.
+  for( size_t next = 0; next < queue.size(); ++next )
+  {
+    const size_t i = queue[next];
+    const Coordinate rm( i % x_size, i / x_size );
+    const std::uint8_t open = l.RoomAtUnchecked( rm ).OpenMask();
+    degrees += std::bitset<4>( open ).count();
+
+    // Open Directions always lead to a Room within the Labyrinth.
+    const size_t neighbours[4] = { i - x_size, i + 1, i + x_size, i - 1 };
+    for( unsigned d = 0; d < 4; ++d )
+    {
+      if( (open >> d) & 1 && !seen[neighbours[d]] )
+      {
+        seen[neighbours[d]] = 1;
+        queue.push_back( static_cast<std::uint32_t>(neighbours[d]) );
+      }
+    }
+  }
+  return queue.size();
+}
@@ -0,0 +1,425 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ file contains the implementation of the LabyrinthQuery class,
+ * which answers questions about every Room of a Labyrinth at once by
+ * scanning its packed Rooms, and the RoomBitset class.
+ *
+ */
+
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/room.hpp"
+#include "../include/room_row.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_query.hpp"
+
+namespace
+{
+
+// Rooms are scanned in blocks of one 64-bit word of results.
+constexpr size_t kBlock = 64;
+
+// This local function returns the number of bits set in the word.
+size_t PopCount( const std::uint64_t word );
+
+// This local function returns a word with bit i set if the packed
+// encoding of Room i, masked, equals any of the values. At most kBlock
+// Rooms are scanned.
+std::uint64_t MatchBlock( const Room* const rooms,
+                          const size_t n,
+                          const std::uint16_t mask,
+                          const std::uint16_t* const values,
+                          const size_t count );
+
+// This local function adds the number of Rooms connected to 0 to 4 other
+// Rooms to counts.
+void CountDegrees( const Room* const rooms,
+                   const size_t n,
+                   std::array<size_t, 5>& counts );
+
+// This local function returns the number of bits set in the word.
+size_t PopCount( const std::uint64_t word )
+{
+  return std::bitset<64>( word ).count();
+}
+
+// This local function returns a word with bit i set if the packed
+// encoding of Room i, masked, equals any of the values.
+std::uint64_t MatchBlock( const Room* const rooms,
+                          const size_t n,
+                          const std::uint16_t mask,
+                          const std::uint16_t* const values,
+                          const size_t count )
+{
+#if defined(__AVX2__)
+  if( n == kBlock )
+  {
+    const __m256i m = _mm256_set1_epi16( static_cast<short>(mask) );
+    __m256i hits[4];
+    for( size_t c = 0; c < 4; ++c )
+    {
+      const __m256i v = _mm256_and_si256( m, _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(rooms + 16 * c)) );
+      __m256i hit = _mm256_setzero_si256();
+      for( size_t k = 0; k < count; ++k )
+      {
+        hit = _mm256_or_si256( hit, _mm256_cmpeq_epi16( v,
+          _mm256_set1_epi16(static_cast<short>(values[k])) ) );
+      }
+      hits[c] = hit;
+    }
+
+    // Packing interleaves the 128-bit halves of its operands, so they are
+    // permuted back into the order of the Rooms.
+    const __m256i lo = _mm256_permute4x64_epi64(
+      _mm256_packs_epi16(hits[0], hits[1]), 0xD8 );
+    const __m256i hi = _mm256_permute4x64_epi64(
+      _mm256_packs_epi16(hits[2], hits[3]), 0xD8 );
+    return static_cast<std::uint64_t>(
+             static_cast<std::uint32_t>(_mm256_movemask_epi8(lo)) ) |
+           static_cast<std::uint64_t>(
+             static_cast<std::uint32_t>(_mm256_movemask_epi8(hi)) ) << 32;
+  }
+#elif defined(__SSE2__)
+  if( n == kBlock )
+  {
+    const __m128i m = _mm_set1_epi16( static_cast<short>(mask) );
+    std::uint64_t word = 0;
+    for( size_t c = 0; c < 4; ++c )
+    {
+      __m128i hits[2];
+      for( size_t h = 0; h < 2; ++h )
+      {
+        const __m128i v = _mm_and_si128( m, _mm_loadu_si128(
+          reinterpret_cast<const __m128i*>(rooms + 16 * c + 8 * h)) );
+        __m128i hit = _mm_setzero_si128();
+        for( size_t k = 0; k < count; ++k )
+        {
+          hit = _mm_or_si128( hit, _mm_cmpeq_epi16( v,
+            _mm_set1_epi16(static_cast<short>(values[k])) ) );
+        }
+        hits[h] = hit;
+      }
+      const unsigned bits = static_cast<unsigned>(
+        _mm_movemask_epi8(_mm_packs_epi16(hits[0], hits[1])) );
+      word |= static_cast<std::uint64_t>( bits ) << (16 * c);
+    }
+    return word;
+  }
+#endif
+
+  std::uint64_t word = 0;
+  for( size_t i = 0; i < n; ++i )
+  {
+    const std::uint16_t masked = rooms[i].Packed() & mask;
+    for( size_t k = 0; k < count; ++k )
+    {
+      if( masked == values[k] )
+      {
+        word |= std::uint64_t( 1 ) << i;
+        break;
+      }
+    }
+  }
+  return word;
+}
+
+// This local function adds the number of Rooms connected to 0 to 4 other
+// Rooms to counts.
+// The degree of a Room is 4, less its Walls, less 1 if it has the exit.
+// Each degree is counted in 16-bit lanes, which cannot overflow since a
+// row has at most 65536 Rooms (at most 8192 per lane).
+void CountDegrees( const Room* const rooms,
+                   const size_t n,
+                   std::array<size_t, 5>& counts )
+{
+  size_t i = 0;
+
+#if defined(__AVX2__)
+  const __m256i walls  = _mm256_set1_epi16( Room::kWallMask );
+  const __m256i exits  = _mm256_set1_epi16( Room::kExitMask );
+  const __m256i fives  = _mm256_set1_epi16( 5 );
+  const __m256i threes = _mm256_set1_epi16( 3 );
+  __m256i lanes[5];
+  for( __m256i& lane : lanes )
+  {
+    lane = _mm256_setzero_si256();
+  }
+  for( ; i + 16 <= n; i += 16 )
+  {
+    const __m256i p = _mm256_loadu_si256(
+      reinterpret_cast<const __m256i*>(rooms + i) );
+    const __m256i w = _mm256_and_si256( p, walls );
+    __m256i c = _mm256_add_epi16( _mm256_and_si256(w, fives),
+      _mm256_and_si256(_mm256_srli_epi16(w, 1), fives) );
+    c = _mm256_add_epi16( _mm256_and_si256(c, threes),
+      _mm256_and_si256(_mm256_srli_epi16(c, 2), threes) );
+
+    // no_exit is -1 in Rooms without the exit, so 3 - c - no_exit is the
+    // degree.
+    const __m256i no_exit = _mm256_cmpeq_epi16(
+      _mm256_and_si256(p, exits), _mm256_setzero_si256() );
+    const __m256i degree = _mm256_sub_epi16(
+      _mm256_sub_epi16(threes, c), no_exit );
+    for( size_t d = 0; d < counts.size(); ++d )
+    {
+      lanes[d] = _mm256_sub_epi16( lanes[d], _mm256_cmpeq_epi16(degree,
+        _mm256_set1_epi16(static_cast<short>(d))) );
+    }
+  }
+  for( size_t d = 0; d < counts.size(); ++d )
+  {
+    std::uint16_t sums[16];
+    _mm256_storeu_si256( reinterpret_cast<__m256i*>(sums), lanes[d] );
+    for( const std::uint16_t sum : sums )
+    {
+      counts[d] += sum;
+    }
+  }
+#elif defined(__SSE2__)
+  const __m128i walls  = _mm_set1_epi16( Room::kWallMask );
+  const __m128i exits  = _mm_set1_epi16( Room::kExitMask );
+  const __m128i fives  = _mm_set1_epi16( 5 );
+  const __m128i threes = _mm_set1_epi16( 3 );
+  __m128i lanes[5];
+  for( __m128i& lane : lanes )
+  {
+    lane = _mm_setzero_si128();
+  }
+  for( ; i + 8 <= n; i += 8 )
+  {
+    const __m128i p = _mm_loadu_si128(
+      reinterpret_cast<const __m128i*>(rooms + i) );
+    const __m128i w = _mm_and_si128( p, walls );
+    __m128i c = _mm_add_epi16( _mm_and_si128(w, fives),
+      _mm_and_si128(_mm_srli_epi16(w, 1), fives) );
+    c = _mm_add_epi16( _mm_and_si128(c, threes),
+      _mm_and_si128(_mm_srli_epi16(c, 2), threes) );
+
+    // no_exit is -1 in Rooms without the exit, so 3 - c - no_exit is the
+    // degree.
+    const __m128i no_exit = _mm_cmpeq_epi16(
+      _mm_and_si128(p, exits), _mm_setzero_si128() );
+    const __m128i degree = _mm_sub_epi16( _mm_sub_epi16(threes, c),
+                                          no_exit );
+    for( size_t d = 0; d < counts.size(); ++d )
+    {
+      lanes[d] = _mm_sub_epi16( lanes[d], _mm_cmpeq_epi16(degree,
+        _mm_set1_epi16(static_cast<short>(d))) );
+    }
+  }
+  for( size_t d = 0; d < counts.size(); ++d )
+  {
+    std::uint16_t sums[8];
+    _mm_storeu_si128( reinterpret_cast<__m128i*>(sums), lanes[d] );
+    for( const std::uint16_t sum : sums )
+    {
+      counts[d] += sum;
+    }
+  }
+#endif
+
+  for( ; i < n; ++i )
+  {
+    ++counts[ PopCount(rooms[i].OpenMask()) ];
+  }
+}
+
+}  // Local namespace
+
+// Parameterized constructor
+// Every bit is cleared.
+RoomBitset::RoomBitset( const size_t x_size, const size_t y_size ) :
+  x_size_(x_size),
+  y_size_(y_size),
+  words_per_row_((x_size + kBlock - 1) / kBlock),
+  words_(words_per_row_ * y_size, 0)
+{
+}
+
+// These methods return the size of the Labyrinth which was scanned.
+size_t RoomBitset::XSize() const
+{
+  return x_size_;
+}
+
+size_t RoomBitset::YSize() const
+{
+  return y_size_;
+}
+
+// This method returns true if the bit of the Room is set.
+// An exception is thrown if:
+//   The Room is outside the bitset (domain_error)
+bool RoomBitset::Test( const Coordinate rm ) const
+{
+  if( rm.x >= x_size_ || rm.y >= y_size_ )
+  {
+    throw std::domain_error( "Error: Test() was given an invalid "\
+      "Coordinate.\n" );
+  }
+  return ( words_[rm.y * words_per_row_ + rm.x / kBlock] >>
+           (rm.x % kBlock) ) & 1;
+}
+
+// This method returns the number of bits which are set.
+size_t RoomBitset::Count() const
+{
+  size_t count = 0;
+  for( const std::uint64_t word : words_ )
+  {
+    count += PopCount( word );
+  }
+  return count;
+}
+
+// This method returns the Rooms whose bits are set, in row-major order.
+std::vector<Coordinate> RoomBitset::Coordinates() const
+{
+  std::vector<Coordinate> rooms;
+  rooms.reserve( Count() );
+  for( size_t y = 0; y < y_size_; ++y )
+  {
+    for( size_t w = 0; w < words_per_row_; ++w )
+    {
+      std::uint64_t word = words_[y * words_per_row_ + w];
+      while( word != 0 )
+      {
+        // The lowest set bit is counted by the bits below it.
+        const std::uint64_t lowest = word & (~word + 1);
+        rooms.push_back( Coordinate(w * kBlock + PopCount(lowest - 1), y) );
+        word ^= lowest;
+      }
+    }
+  }
+  return rooms;
+}
+
+// These methods return the words of a row, and the number of words in
+// each row. The row is not checked.
+const std::uint64_t* RoomBitset::RowWords( const size_t y ) const
+{
+  return words_.data() + y * words_per_row_;
+}
+
+size_t RoomBitset::WordsPerRow() const
+{
+  return words_per_row_;
+}
+
+// These methods return the number of Rooms with the Inhabitant or Item.
+size_t LabyrinthQuery::CountInhabitants( const Labyrinth& l,
+                                         const Inhabitant inh )
+{
+  const std::uint16_t value = static_cast<std::uint16_t>(
+    static_cast<unsigned>(inh) << Room::kInhabitantShift );
+  return Scan( l, Room::kInhabitantMask, &value, 1, nullptr );
+}
+
+size_t LabyrinthQuery::CountItems( const Labyrinth& l, const Item itm )
+{
+  const std::uint16_t value = static_cast<std::uint16_t>(
+    static_cast<unsigned>(itm) << Room::kItemShift );
+  return Scan( l, Room::kItemMask, &value, 1, nullptr );
+}
+
+// These methods return the Rooms with the Inhabitant or Item.
+RoomBitset LabyrinthQuery::FindInhabitants( const Labyrinth& l,
+                                            const Inhabitant inh )
+{
+  const std::uint16_t value = static_cast<std::uint16_t>(
+    static_cast<unsigned>(inh) << Room::kInhabitantShift );
+  RoomBitset found( l.XSize(), l.YSize() );
+  Scan( l, Room::kInhabitantMask, &value, 1, &found );
+  return found;
+}
+
+RoomBitset LabyrinthQuery::FindItems( const Labyrinth& l, const Item itm )
+{
+  const std::uint16_t value = static_cast<std::uint16_t>(
+    static_cast<unsigned>(itm) << Room::kItemShift );
+  RoomBitset found( l.XSize(), l.YSize() );
+  Scan( l, Room::kItemMask, &value, 1, &found );
+  return found;
+}
+
+// This method returns the Rooms with a Wall in exactly three Directions.
+RoomBitset LabyrinthQuery::DeadEnds( const Labyrinth& l )
+{
+  // Every Wall mask with one bit clear.
+  const std::uint16_t values[4] = { 0x7, 0xB, 0xD, 0xE };
+  RoomBitset found( l.XSize(), l.YSize() );
+  Scan( l, Room::kWallMask, values, 4, &found );
+  return found;
+}
+
+// This method returns the number of Rooms connected to 0 to 4 other
+// Rooms.
+std::array<size_t, 5> LabyrinthQuery::DegreeHistogram( const Labyrinth& l )
+{
+  std::array<size_t, 5> counts = {};
+  for( size_t y = 0; y < l.YSize(); ++y )
+  {
+    const RoomRow row = l.RowAt( y );
+    CountDegrees( row.begin(), row.size(), counts );
+  }
+  return counts;
+}
+
+// This method returns the instruction set which the scans were compiled
+// for.
+const char* LabyrinthQuery::InstructionSet()
+{
+#if defined(__AVX2__)
+  return "AVX2";
+#elif defined(__SSE2__)
+  return "SSE2";
+#else
+  return "scalar";
+#endif
+}
+
+// PRIVATE METHODS:
+
+// This private method finds the Rooms whose packed encoding, masked,
+// equals any of the values, and returns how many there are.
+size_t LabyrinthQuery::Scan( const Labyrinth& l,
+                             const std::uint16_t mask,
+                             const std::uint16_t* const values,
+                             const size_t count,
+                             RoomBitset* const found )
+{
+  size_t total = 0;
+  for( size_t y = 0; y < l.YSize(); ++y )
+  {
+    const RoomRow row = l.RowAt( y );
+    for( size_t x = 0, w = 0; x < row.size(); x += kBlock, ++w )
+    {
+      const std::uint64_t word =
+        MatchBlock( row.begin() + x, std::min(kBlock, row.size() - x),
+                    mask, values, count );
+      total += PopCount( word );
+      if( found )
+      {
+        found->words_[y * found->words_per_row_ + w] = word;
+      }
+    }
+  }
+  return total;
+}
@@ -0,0 +1,369 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ file contains the implementation of the LabyrinthSolver class,
+ * which finds shortest paths between Rooms of a Labyrinth.
+ *
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/room.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_graph.hpp"
+#include "../include/labyrinth_solver.hpp"
+
+constexpr size_t LabyrinthSolver::kUnreachable;
+
+namespace
+{
+
+// This local function returns l.
+// An exception is thrown if:
+//   l is null (invalid_argument)
+const Labyrinth* CheckLabyrinth( const Labyrinth* const l );
+
+// This local function returns l.
+// An exception is thrown if:
+//   l is null (invalid_argument)
+const Labyrinth* CheckLabyrinth( const Labyrinth* const l )
+{
+  if( l == nullptr )
+  {
+    throw std::invalid_argument( "Error: LabyrinthSolver() was given an "\
+      "invalid (null) pointer for the Labyrinth.\n" );
+  }
+  return l;
+}
+
+}  // Local namespace
+
+// Parameterized constructor
+// An exception is thrown if:
+//   l is null (invalid_argument)
+//   The Labyrinth has too many Rooms to be numbered in 32 bits
+//     (length_error)
+LabyrinthSolver::LabyrinthSolver( const Labyrinth* const l ) :
+  l_(CheckLabyrinth(l)),
+  graph_(l)
+{
+}
+
+// This method finds a shortest path between the given Rooms, and stores
+// it in path (the Rooms from start to goal, inclusive).
+// Returns true if a path was found, and false (with an empty path)
+// otherwise.
+// An exception is thrown if:
+//   One or both Rooms are outside the Labyrinth (domain_error)
+bool LabyrinthSolver::FindPath( const Coordinate start,
+                                const Coordinate goal,
+                                std::vector<Coordinate>& path,
+                                const SolverAlgorithm a )
+{
+  const size_t x_size = l_->XSize();
+  if( start.x >= x_size || start.y >= l_->YSize() ||
+      goal.x >= x_size || goal.y >= l_->YSize() )
+  {
+    throw std::domain_error( "Error: FindPath() was given a Coordinate "\
+      "outside of the Labyrinth.\n" );
+  }
+
+  path.clear();
+  BeginQuery();
+  const std::uint32_t s = static_cast<std::uint32_t>( start.y * x_size +
+                                                      start.x );
+  const std::uint32_t g = static_cast<std::uint32_t>( goal.y * x_size +
+                                                      goal.x );
+
+  if( a == SolverAlgorithm::kBidirectional )
+  {
+    std::uint32_t meet;
+    if( !Bidirectional(s, g, meet) )
+    {
+      return false;
+    }
+
+    for( std::uint32_t i = meet; i != s; i = parent_[i] )
+    {
+      path.push_back( graph_.ToCoordinate(i) );
+    }
+    path.push_back( start );
+    std::reverse( path.begin(), path.end() );
+    for( std::uint32_t i = meet; i != g; )
+    {
+      i = parent_back_[i];
+      path.push_back( graph_.ToCoordinate(i) );
+    }
+    return true;
+  }
+
+  const bool found = ( a == SolverAlgorithm::kAStar ) ? AStar( s, g ) :
+                                                        BreadthFirst( s, g );
+  if( !found )
+  {
+    return false;
+  }
+
+  for( std::uint32_t i = g; i != s; i = parent_[i] )
+  {
+    path.push_back( graph_.ToCoordinate(i) );
+  }
+  path.push_back( start );
+  std::reverse( path.begin(), path.end() );
+  return true;
+}
+
+// This method finds a shortest path along the given route.
+// Returns true if a path was found, and false otherwise.
+// An exception is thrown if:
+//   The route uses the Treasure, which is not in a Room (logic_error)
+//   The route uses the exit, which has not been set (logic_error)
+bool LabyrinthSolver::FindRoute( const SolverRoute r,
+                                 std::vector<Coordinate>& path,
+                                 const SolverAlgorithm a )
+{
+  switch( r )
+  {
+    case SolverRoute::kSpawn1ToTreasure:
+      return FindPath( l_->GetSpawn1(), l_->GetTreasure(), path, a );
+    case SolverRoute::kSpawn2ToTreasure:
+      return FindPath( l_->GetSpawn2(), l_->GetTreasure(), path, a );
+    case SolverRoute::kTreasureToExit:
+      return FindPath( l_->GetTreasure(), l_->GetExit(), path, a );
+    case SolverRoute::kSpawn1ToExit:
+      return FindPath( l_->GetSpawn1(), l_->GetExit(), path, a );
+    case SolverRoute::kSpawn2ToExit:
+      return FindPath( l_->GetSpawn2(), l_->GetExit(), path, a );
+  }
+  return false;
+}
+
+// This method returns the number of steps between the given Rooms, or
+// kUnreachable if there is no path.
+// An exception is thrown if:
+//   One or both Rooms are outside the Labyrinth (domain_error)
+size_t LabyrinthSolver::Distance( const Coordinate start,
+                                  const Coordinate goal )
+{
+  const size_t x_size = l_->XSize();
+  if( start.x >= x_size || start.y >= l_->YSize() ||
+      goal.x >= x_size || goal.y >= l_->YSize() )
+  {
+    throw std::domain_error( "Error: Distance() was given a Coordinate "\
+      "outside of the Labyrinth.\n" );
+  }
+
+  BeginQuery();
+  const std::uint32_t g = static_cast<std::uint32_t>( goal.y * x_size +
+                                                      goal.x );
+  if( !BreadthFirst(static_cast<std::uint32_t>(start.y * x_size + start.x),
+                    g) )
+  {
+    return kUnreachable;
+  }
+  return cost_[g];
+}
+
+// PRIVATE METHODS:
+
+// This private method starts a new query, refreshing the graph, resizing
+// the scratch buffers if the Labyrinth is new and resetting them if the
+// query number wraps.
+void LabyrinthSolver::BeginQuery()
+{
+  graph_.Refresh();
+  const size_t rooms = graph_.Rooms();
+  if( seen_.size() != rooms )
+  {
+    seen_.assign( rooms, 0 );
+    seen_back_.assign( rooms, 0 );
+    parent_.resize( rooms );
+    parent_back_.resize( rooms );
+    cost_.resize( rooms );
+    cost_back_.resize( rooms );
+    queue_.resize( rooms );
+    queue_back_.resize( rooms );
+    query_ = 0;
+  }
+
+  ++query_;
+  if( query_ == 0 )
+  {
+    std::fill( seen_.begin(), seen_.end(), 0 );
+    std::fill( seen_back_.begin(), seen_back_.end(), 0 );
+    query_ = 1;
+  }
+}
+
+// These private methods search from start to goal, leaving parent_ set
+// along the path. They return true if goal was reached.
+bool LabyrinthSolver::BreadthFirst( const std::uint32_t start,
+                                    const std::uint32_t goal )
+{
+  size_t head = 0;
+  size_t tail = 0;
+  seen_[start] = query_;
+  parent_[start] = start;
+  cost_[start] = 0;
+  queue_[tail++] = start;
+
+  while( head < tail )
+  {
+    const std::uint32_t i = queue_[head++];
+    if( i == goal )
+    {
+      return true;
+    }
+
+    for( const std::uint32_t j : graph_.Neighbours(i) )
+    {
+      if( seen_[j] != query_ )
+      {
+        seen_[j] = query_;
+        parent_[j] = i;
+        cost_[j] = cost_[i] + 1;
+        queue_[tail++] = j;
+      }
+    }
+  }
+  return false;
+}
+
+bool LabyrinthSolver::AStar( const std::uint32_t start,
+                             const std::uint32_t goal )
+{
+  const size_t x_size = l_->XSize();
+  const size_t goal_x = goal % x_size;
+  const size_t goal_y = goal / x_size;
+
+  // Manhattan distance, which never overestimates in a grid.
+  auto heuristic = [&]( const std::uint32_t i ) -> std::uint64_t
+  {
+    const size_t x = i % x_size;
+    const size_t y = i / x_size;
+    return ( x > goal_x ? x - goal_x : goal_x - x ) +
+           ( y > goal_y ? y - goal_y : goal_y - y );
+  };
+
+  // Heap entries are (estimated total cost << 32) | Room, smallest first.
+  heap_.clear();
+  seen_[start] = query_;
+  parent_[start] = start;
+  cost_[start] = 0;
+  heap_.push_back( (heuristic(start) << 32) | start );
+
+  while( !heap_.empty() )
+  {
+    std::pop_heap( heap_.begin(), heap_.end(),
+                   std::greater<std::uint64_t>() );
+    const std::uint64_t top = heap_.back();
+    heap_.pop_back();
+
+    const std::uint32_t i = static_cast<std::uint32_t>( top & 0xFFFFFFFFu );
+    if( (top >> 32) > cost_[i] + heuristic(i) )
+    {
+      continue;  // A cheaper entry for this Room was already expanded
+    }
+    if( i == goal )
+    {
+      return true;
+    }
+
+    for( const std::uint32_t j : graph_.Neighbours(i) )
+    {
+      const std::uint32_t cost = cost_[i] + 1;
+      if( seen_[j] != query_ || cost < cost_[j] )
+      {
+        seen_[j] = query_;
+        parent_[j] = i;
+        cost_[j] = cost;
+        heap_.push_back( ((cost + heuristic(j)) << 32) | j );
+        std::push_heap( heap_.begin(), heap_.end(),
+                        std::greater<std::uint64_t>() );
+      }
+    }
+  }
+  return false;
+}
+
+// This private method searches from both ends, and returns the Room
+// where the searches met through meet.
+//
+// Each step expands a whole level of the smaller frontier, and the
+// shortest of the meetings found in that level is kept.
+bool LabyrinthSolver::Bidirectional( const std::uint32_t start,
+                                     const std::uint32_t goal,
+                                     std::uint32_t& meet )
+{
+  if( start == goal )
+  {
+    meet = start;
+    parent_[start] = start;
+    return true;
+  }
+
+  size_t head = 0, tail = 0;
+  size_t head_back = 0, tail_back = 0;
+  seen_[start] = query_;
+  parent_[start] = start;
+  cost_[start] = 0;
+  queue_[tail++] = start;
+  seen_back_[goal] = query_;
+  parent_back_[goal] = goal;
+  cost_back_[goal] = 0;
+  queue_back_[tail_back++] = goal;
+
+  while( head < tail && head_back < tail_back )
+  {
+    const bool forward = (tail - head) <= (tail_back - head_back);
+
+    std::vector<std::uint32_t>& queue   = forward ? queue_ : queue_back_;
+    std::vector<std::uint32_t>& seen    = forward ? seen_ : seen_back_;
+    std::vector<std::uint32_t>& parent  = forward ? parent_ : parent_back_;
+    std::vector<std::uint32_t>& cost    = forward ? cost_ : cost_back_;
+    std::vector<std::uint32_t>& other   = forward ? seen_back_ : seen_;
+    std::vector<std::uint32_t>& other_c = forward ? cost_back_ : cost_;
+    size_t& h = forward ? head : head_back;
+    size_t& t = forward ? tail : tail_back;
+
+    std::uint64_t best = static_cast<std::uint64_t>( -1 );
+    const size_t level_end = t;
+    while( h < level_end )
+    {
+      const std::uint32_t i = queue[h++];
+      for( const std::uint32_t j : graph_.Neighbours(i) )
+      {
+        if( seen[j] == query_ )
+        {
+          continue;
+        }
+        seen[j] = query_;
+        parent[j] = i;
+        cost[j] = cost[i] + 1;
+        queue[t++] = j;
+
+        if( other[j] == query_ &&
+            static_cast<std::uint64_t>(cost[j]) + other_c[j] < best )
+        {
+          best = static_cast<std::uint64_t>( cost[j] ) + other_c[j];
+          meet = j;
+        }
+      }
+    }
+
+    if( best != static_cast<std::uint64_t>(-1) )
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
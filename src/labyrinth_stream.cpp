@@ -0,0 +1,236 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ file contains the implementation of the LabyrinthStreamGenerator
+ * class, which generates a maze row by row into a RoomRowSink without ever
+ * holding the whole maze in memory.
+ *
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <unordered_set>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/room.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/eller_row_generator.hpp"
+#include "../include/labyrinth_generator.hpp"
+#include "../include/labyrinth_stream.hpp"
+
+// Parameterized constructor
+// An exception is thrown if:
+//   band_rows is 0 (invalid_argument)
+LabyrinthStreamGenerator::LabyrinthStreamGenerator(
+  const GeneratorOptions& options,
+  const size_t band_rows ) :
+  options_(options),
+  band_rows_(band_rows),
+  rng_(options.seed)
+{
+  if( band_rows == 0 )
+  {
+    throw std::invalid_argument( "Error: LabyrinthStreamGenerator() was "\
+      "given a band of 0 rows.\n" );
+  }
+}
+
+// This method generates a maze of the given size into the sink.
+// The same options, seed and size always generate the same maze.
+// An exception is thrown if:
+//   A size of 0 is given (domain_error)
+//   There are more Items or Inhabitants than Rooms (invalid_argument)
+void LabyrinthStreamGenerator::Generate( const size_t x_size,
+                                         const size_t y_size,
+                                         RoomRowSink& sink )
+{
+  if( x_size == 0 || y_size == 0 )
+  {
+    throw std::domain_error( "Error: Generate() was given an empty size.\n" );
+  }
+
+  rng_.seed( options_.seed );
+  const LabyrinthStreamInfo info = Plan( x_size, y_size );
+  eller_.Reset( x_size, y_size );
+  band_.resize( band_rows_ * x_size );
+
+  sink.Begin( info );
+
+  auto next_placement = placements_.cbegin();
+  size_t band_y = 0;
+  size_t rows_in_band = 0;
+  while( !eller_.Done() )
+  {
+    const size_t y = eller_.NextY();
+    const std::uint8_t* const open = eller_.NextRow( rng_ );
+    Room* const row = &band_[rows_in_band * x_size];
+
+    for( size_t x = 0; x < x_size; ++x )
+    {
+      row[x] = Room();
+      row[x].ClearWalls( open[x] );
+    }
+
+    if( info.exit_set && info.exit.y == y )
+    {
+      row[info.exit.x].CreateExit( info.exit_direction );
+    }
+
+    const size_t row_end = (y + 1) * x_size;
+    while( next_placement != placements_.cend() &&
+           next_placement->index < row_end )
+    {
+      Room& rm = row[next_placement->index - y * x_size];
+      if( next_placement->is_item )
+      {
+        rm.SetItem( next_placement->itm );
+      }
+      else
+      {
+        rm.SetInhabitant( next_placement->inh );
+      }
+      ++next_placement;
+    }
+
+    ++rows_in_band;
+    if( rows_in_band == band_rows_ || eller_.Done() )
+    {
+      sink.Rows( band_y, band_.data(), rows_in_band );
+      band_y += rows_in_band;
+      rows_in_band = 0;
+    }
+  }
+
+  sink.End();
+}
+
+// This method changes the seed used by the next call to Generate().
+void LabyrinthStreamGenerator::SetSeed( const std::uint64_t seed )
+{
+  options_.seed = seed;
+}
+
+// PRIVATE METHODS:
+
+// This private method returns a random number in [0, n).
+size_t LabyrinthStreamGenerator::RandomBelow( const size_t n )
+{
+  return static_cast<size_t>( rng_() % n );
+}
+
+// This private method decides the spawns, exit and placements.
+LabyrinthStreamInfo LabyrinthStreamGenerator::Plan( const size_t x_size,
+                                                    const size_t y_size )
+{
+  const size_t rooms = x_size * y_size;
+  const size_t items = options_.bullets + (options_.place_treasure ? 1 : 0);
+  size_t spawns = 0;
+  if( options_.place_spawns )
+  {
+    spawns = rooms > 1 ? 2 : 1;
+  }
+  if( items > rooms )
+  {
+    throw std::invalid_argument( "Error: Generate() was asked to place more "\
+      "Items than there are Rooms.\n" );
+  }
+  else if( options_.minotaurs + options_.mirrors > rooms - spawns )
+  {
+    throw std::invalid_argument( "Error: Generate() was asked to place more "\
+      "Inhabitants than there are Rooms without a spawn.\n" );
+  }
+
+  LabyrinthStreamInfo info;
+  info.x_size = x_size;
+  info.y_size = y_size;
+  placements_.clear();
+
+  std::unordered_set<size_t> inhabitant_rooms;
+  if( options_.place_spawns )
+  {
+    const size_t spawn_1 = RandomBelow( rooms );
+    size_t spawn_2 = spawn_1;
+    while( rooms > 1 && spawn_2 == spawn_1 )
+    {
+      spawn_2 = RandomBelow( rooms );
+    }
+    info.spawn_1 = Coordinate( spawn_1 % x_size, spawn_1 / x_size );
+    info.spawn_2 = Coordinate( spawn_2 % x_size, spawn_2 / x_size );
+    inhabitant_rooms.insert( spawn_1 );
+    inhabitant_rooms.insert( spawn_2 );
+  }
+
+  if( options_.place_exit )
+  {
+    // Every Room on the outside of the maze has an outer Wall.
+    const Direction directions[4] = { Direction::kNorth, Direction::kEast,
+                                      Direction::kSouth, Direction::kWest };
+    info.exit_set = true;
+    info.exit_direction = directions[RandomBelow(4)];
+    switch( info.exit_direction )
+    {
+      case Direction::kNorth:
+        info.exit = Coordinate( RandomBelow(x_size), 0 );
+        break;
+      case Direction::kEast:
+        info.exit = Coordinate( x_size - 1, RandomBelow(y_size) );
+        break;
+      case Direction::kSouth:
+        info.exit = Coordinate( RandomBelow(x_size), y_size - 1 );
+        break;
+      default:
+        info.exit = Coordinate( 0, RandomBelow(y_size) );
+        break;
+    }
+  }
+
+  std::unordered_set<size_t> item_rooms;
+  Placement kind;
+  kind.is_item = true;
+  kind.inh = Inhabitant::kNone;
+  if( options_.place_treasure )
+  {
+    kind.itm = Item::kTreasure;
+    AddPlacements( 1, rooms, kind, item_rooms );
+    info.treasure_set = true;
+    info.treasure = Coordinate( placements_.back().index % x_size,
+                                placements_.back().index / x_size );
+  }
+  kind.itm = Item::kBullet;
+  AddPlacements( options_.bullets, rooms, kind, item_rooms );
+
+  kind.is_item = false;
+  kind.itm = Item::kNone;
+  kind.inh = Inhabitant::kMinotaur;
+  AddPlacements( options_.minotaurs, rooms, kind, inhabitant_rooms );
+  kind.inh = Inhabitant::kMirror;
+  AddPlacements( options_.mirrors, rooms, kind, inhabitant_rooms );
+
+  std::stable_sort( placements_.begin(), placements_.end() );
+  return info;
+}
+
+// This private method adds count Placements of the given kind in
+// distinct random Rooms which are not yet taken, and marks them taken.
+void LabyrinthStreamGenerator::AddPlacements(
+  const size_t count,
+  const size_t rooms,
+  const Placement& kind,
+  std::unordered_set<size_t>& taken )
+{
+  for( size_t i = 0; i < count; ++i )
+  {
+    Placement p = kind;
+    do
+    {
+      p.index = RandomBelow( rooms );
+    } while( taken.count(p.index) != 0 );
+    taken.insert( p.index );
+    placements_.push_back( p );
+  }
+}
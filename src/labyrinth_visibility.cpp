@@ -0,0 +1,165 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ file contains the implementation of the LabyrinthVisibility
+ * class, which keeps the Rooms of a Labyrinth that each Player has
+ * explored.
+ *
+ */
+
+#include <bitset>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../include/coordinate.hpp"
+#include "../include/turn_engine.hpp"
+#include "../include/labyrinth_visibility.hpp"
+
+// Parameterized constructor
+// No Room is revealed.
+// An exception is thrown if:
+//   A size of 0 is given (domain_error)
+LabyrinthVisibility::LabyrinthVisibility( const size_t x_size,
+                                          const size_t y_size,
+                                          const size_t players ) :
+  x_size_(x_size),
+  y_size_(y_size),
+  players_(players),
+  words_per_player_((x_size * y_size + 63) / 64)
+{
+  if( x_size == 0 || y_size == 0 )
+  {
+    throw std::domain_error( "Error: LabyrinthVisibility() was given an "\
+      "empty size.\n" );
+  }
+  words_.assign( players_ * words_per_player_, 0 );
+}
+
+// These methods return the sizes of the Labyrinth and the number of
+// Players.
+size_t LabyrinthVisibility::XSize() const
+{
+  return x_size_;
+}
+
+size_t LabyrinthVisibility::YSize() const
+{
+  return y_size_;
+}
+
+size_t LabyrinthVisibility::Players() const
+{
+  return players_;
+}
+
+// This method reveals a Room to a Player, and returns true if it had not
+// been revealed before.
+// An exception is thrown if:
+//   The Player does not exist (invalid_argument)
+//   The Room is outside the Labyrinth (domain_error)
+bool LabyrinthVisibility::Reveal( const size_t player, const Coordinate rm )
+{
+  Check( "Reveal", player, rm );
+  const size_t i = rm.y * x_size_ + rm.x;
+  std::uint64_t& word = words_[player * words_per_player_ + i / 64];
+  const std::uint64_t bit = std::uint64_t( 1 ) << (i % 64);
+  const bool hidden = (word & bit) == 0;
+  word |= bit;
+  return hidden;
+}
+
+// This method reveals the Rooms which Players entered in a batch of
+// TurnEngine events, and returns the number of Rooms which had not been
+// revealed before.
+// An exception is thrown if:
+//   An event is of a Player which does not exist (invalid_argument)
+//   An event is outside the Labyrinth (domain_error)
+size_t LabyrinthVisibility::Reveal( const std::vector<TurnEvent>& events )
+{
+  size_t revealed = 0;
+  for( const TurnEvent& e : events )
+  {
+    if( e.kind == TurnEventKind::kMoved ||
+        e.kind == TurnEventKind::kRespawned )
+    {
+      revealed += Reveal( e.player, Coordinate(e.x, e.y) );
+    }
+  }
+  return revealed;
+}
+
+// This method returns true if the Room has been revealed to the Player.
+// An exception is thrown if:
+//   The Player does not exist (invalid_argument)
+//   The Room is outside the Labyrinth (domain_error)
+bool LabyrinthVisibility::Revealed( const size_t player,
+                                    const Coordinate rm ) const
+{
+  Check( "Revealed", player, rm );
+  return RevealedUnchecked( player, rm );
+}
+
+// This method returns true if the Room has been revealed to the Player,
+// without checking either of them.
+bool LabyrinthVisibility::RevealedUnchecked( const size_t player,
+                                             const Coordinate rm )
+  const noexcept
+{
+  const size_t i = rm.y * x_size_ + rm.x;
+  return ( words_[player * words_per_player_ + i / 64] >> (i % 64) ) & 1;
+}
+
+// This method returns the number of Rooms revealed to the Player.
+// An exception is thrown if:
+//   The Player does not exist (invalid_argument)
+size_t LabyrinthVisibility::RevealedCount( const size_t player ) const
+{
+  Check( "RevealedCount", player );
+  size_t count = 0;
+  for( size_t w = 0; w < words_per_player_; ++w )
+  {
+    count += std::bitset<64>( words_[player * words_per_player_ + w] ).count();
+  }
+  return count;
+}
+
+// This method hides every Room from the Player again.
+// An exception is thrown if:
+//   The Player does not exist (invalid_argument)
+void LabyrinthVisibility::Clear( const size_t player )
+{
+  Check( "Clear", player );
+  for( size_t w = 0; w < words_per_player_; ++w )
+  {
+    words_[player * words_per_player_ + w] = 0;
+  }
+}
+
+// PRIVATE METHODS:
+
+// This private method throws if the Player or Room does not exist.
+void LabyrinthVisibility::Check( const char* const method,
+                                 const size_t player,
+                                 const Coordinate rm ) const
+{
+  Check( method, player );
+  if( rm.x >= x_size_ || rm.y >= y_size_ )
+  {
+    throw std::domain_error( std::string("Error: ") + method + "() was "\
+      "given a Coordinate outside of the Labyrinth.\n" );
+  }
+}
+
+void LabyrinthVisibility::Check( const char* const method,
+                                 const size_t player ) const
+{
+  if( player >= players_ )
+  {
+    throw std::invalid_argument( std::string("Error: ") + method + "() was "\
+      "given a player which does not exist.\n" );
+  }
+}
@@ -0,0 +1,120 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ file contains the implementation of the Player class, which is a
+ * description of the inventory, location, and status of a player.
+ *
+ */
+
+#include <stdexcept>
+
+#include "../include/coordinate.hpp"
+#include "../include/player.hpp"
+
+// Parameterized constructor
+Player::Player( const Coordinate location,
+                const unsigned bullets,
+                const unsigned extra_lives ) :
+  location_(location), bullets_(bullets), extra_lives_(extra_lives)
+{
+}
+
+// These methods return and set the Room which the player is in.
+Coordinate Player::Location() const
+{
+  return location_;
+}
+
+void Player::SetLocation( const Coordinate rm )
+{
+  location_ = rm;
+}
+
+// This method returns the number of bullets the player holds.
+unsigned Player::Bullets() const
+{
+  return bullets_;
+}
+
+// This method gives the player another bullet.
+void Player::AddBullet()
+{
+  ++bullets_;
+}
+
+// This method takes a bullet from the player.
+// An exception is thrown if:
+//   The player has no bullets (logic_error)
+void Player::UseBullet()
+{
+  if( bullets_ == 0 )
+  {
+    throw std::logic_error( "Error: UseBullet() was called when the player "\
+      "has no bullets.\n" );
+  }
+  --bullets_;
+}
+
+// This method returns the number of extra lives the player has left.
+unsigned Player::ExtraLives() const
+{
+  return extra_lives_;
+}
+
+// This method takes an extra life from the player.
+// An exception is thrown if:
+//   The player has no extra lives (logic_error)
+void Player::UseExtraLife()
+{
+  if( extra_lives_ == 0 )
+  {
+    throw std::logic_error( "Error: UseExtraLife() was called when the "\
+      "player has no extra lives.\n" );
+  }
+  --extra_lives_;
+}
+
+// This method returns true if the player holds the Treasure.
+bool Player::HasTreasure() const
+{
+  return treasure_;
+}
+
+// This method gives the Treasure to the player.
+// An exception is thrown if:
+//   The player already holds the Treasure (logic_error)
+void Player::TakeTreasure()
+{
+  if( treasure_ )
+  {
+    throw std::logic_error( "Error: TakeTreasure() was called when the "\
+      "player already holds the Treasure.\n" );
+  }
+  treasure_ = true;
+}
+
+// This method takes the Treasure from the player.
+// An exception is thrown if:
+//   The player does not hold the Treasure (logic_error)
+void Player::DropTreasure()
+{
+  if( !treasure_ )
+  {
+    throw std::logic_error( "Error: DropTreasure() was called when the "\
+      "player does not hold the Treasure.\n" );
+  }
+  treasure_ = false;
+}
+
+// These methods return and set whether the player is still playing.
+PlayerStatus Player::Status() const
+{
+  return status_;
+}
+
+void Player::SetStatus( const PlayerStatus s )
+{
+  status_ = s;
+}
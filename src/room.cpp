@@ -1,19 +1,29 @@
 /*
  *
  * Author: Jeffrey Leung
- * Last edited: 2016-01-25
+ * Last edited: 2026-10-14
  *
  * This program contains implementations of a Room class, which is a template
  * to create a Labyrinth.
  *
  */
 
+#include <cstdint>
 #include <iostream>
 #include <stdexcept>
 
 #include "../include/room_properties.hpp"
 #include "../include/room.hpp"
 
+// Out-of-line definitions of the packed layout constants
+constexpr std::uint16_t Room::kWallMask;
+constexpr unsigned      Room::kExitShift;
+constexpr std::uint16_t Room::kExitMask;
+constexpr unsigned      Room::kInhabitantShift;
+constexpr std::uint16_t Room::kInhabitantMask;
+constexpr unsigned      Room::kItemShift;
+constexpr std::uint16_t Room::kItemMask;
+
 // Default constructor
 // This constructor sets a basic, walled, empty Room.
 Room::Room()
@@ -30,38 +40,44 @@ Room::Room( const Inhabitant dark_thing,
             const bool wall_south,
             const bool wall_west )
 {
-  dark_thing_ = dark_thing;
-  object_     = object;
-  exit_       = exit;
-  wall_north_ = wall_north;
-  wall_east_  = wall_east;
-  wall_south_ = wall_south;
-  wall_west_  = wall_west;
+  bits_ = 0;
+  if( wall_north ) bits_ |= WallBit( Direction::kNorth );
+  if( wall_east )  bits_ |= WallBit( Direction::kEast );
+  if( wall_south ) bits_ |= WallBit( Direction::kSouth );
+  if( wall_west )  bits_ |= WallBit( Direction::kWest );
+
+  bits_ |= static_cast<std::uint16_t>(
+    static_cast<unsigned>(exit) << kExitShift );
+  SetInhabitant( dark_thing );
+  SetItem( object );
 }
 
 // This method returns the current inhabitant of the Room.
 Inhabitant Room::GetInhabitant() const
 {
-  return dark_thing_;
+  return static_cast<Inhabitant>( (bits_ & kInhabitantMask) >>
+                                  kInhabitantShift );
 }
 
 // This method changes the current inhabitant of the Room.
 void Room::SetInhabitant( const Inhabitant inh )
 {
-  dark_thing_ = inh;
+  bits_ = static_cast<std::uint16_t>( (bits_ & ~kInhabitantMask) |
+    (static_cast<unsigned>(inh) << kInhabitantShift) );
   return;
 }
 
 // This method returns the current item in the Room.
 Item Room::GetItem() const
 {
-  return object_;
+  return static_cast<Item>( (bits_ & kItemMask) >> kItemShift );
 }
 
 // This method changes the current item in the Room.
 void Room::SetItem( const Item itm )
 {
-  object_ = itm;
+  bits_ = static_cast<std::uint16_t>( (bits_ & ~kItemMask) |
+    (static_cast<unsigned>(itm) << kItemShift) );
   return;
 }
 
@@ -72,51 +88,38 @@ void Room::SetItem( const Item itm )
 //   The Wall has already been removed (logic_error)
 void Room::BreakWall( const Direction d )
 {
-  switch( d )
+  const std::uint16_t wall = WallBit( d );
+  if( wall == 0 )
+  {
+    throw std::invalid_argument( "Error: BreakWall() was given an "\
+      "invalid Direction (kNone).\n");
+  }
+  else if( !(bits_ & wall) )  // Wall already removed
   {
-    case( Direction::kNone ):
-      throw std::invalid_argument( "Error: BreakWall() was given an "\
-        "invalid Direction (kNone).\n");
-
-    case( Direction::kNorth ):
-      if( !wall_north_ )  // Wall already removed
-      {
-        throw std::logic_error( "Error: BreakWall() was given an "\
-          "already-removed Wall.\n" );
-      }
-      wall_north_ = false;
-      break;
-
-    case( Direction::kEast ):
-      if( !wall_east_ )
-      {
-        throw std::logic_error( "Error: BreakWall() was given an "\
-          "already-removed Wall.\n" );
-      }
-      wall_east_ = false;
-      break;
-
-    case( Direction::kSouth ):
-      if( !wall_south_ )
-      {
-        throw std::logic_error( "Error: BreakWall() was given an "\
-          "already-removed Wall.\n" );
-      }
-      wall_south_ = false;
-      break;
-
-    case( Direction::kWest ):
-      if( !wall_west_ )
-      {
-        throw std::logic_error( "Error: BreakWall() was given an "\
-          "already-removed Wall.\n" );
-      }
-      wall_west_ = false;
-      break;
+    throw std::logic_error( "Error: BreakWall() was given an "\
+      "already-removed Wall.\n" );
   }
+
+  bits_ = static_cast<std::uint16_t>( bits_ & ~wall );
   return;
 }
 
+// This method removes the Wall in the given direction without checking
+// whether it has already been removed. Direction::kNone is ignored.
+// Intended for generators which have already validated the layout.
+void Room::ClearWall( const Direction d )
+{
+  bits_ = static_cast<std::uint16_t>( bits_ & ~WallBit(d) );
+}
+
+// This method removes every Wall given by the mask, which uses the
+// layout of kWallMask (bit 0 north, 1 east, 2 south, 3 west), without
+// checking whether it has already been removed. Other bits are ignored.
+void Room::ClearWalls( const std::uint8_t mask )
+{
+  bits_ = static_cast<std::uint16_t>( bits_ & ~(mask & kWallMask) );
+}
+
 // This method creates an exit in the given direction. The Wall
 // should be intact (BreakWall() not called on it beforehand).
 // An exception is thrown if:
@@ -135,22 +138,22 @@ void Room::CreateExit( const Direction d )
     throw std::logic_error( "Error: CreateExit() was given a Wall "\
       "which has already been broken." );
   }
-  else if( exit_ != Direction::kNone )
+  else if( bits_ & kExitMask )
   {
     throw std::logic_error( "Error: CreateExit() was given a Room "\
       "which already has an exit.\n" );
   }
 
-  try
-  {
-    BreakWall(d);
-  }
-  catch( const std::exception& e )
-  {
-    std::cout << e.what();
-    return;
-  }
-  exit_ = d;
+  CreateExitUnchecked( d );
+}
+
+// This method creates an exit in the given direction without checking.
+// Direction d must not be kNone, its Wall must be intact, and the Room
+// must not already have an exit.
+void Room::CreateExitUnchecked( const Direction d ) noexcept
+{
+  bits_ = static_cast<std::uint16_t>( (bits_ & ~WallBit(d)) |
+    (static_cast<unsigned>(d) << kExitShift) );
 }
 
 // This method returns:
@@ -167,21 +170,61 @@ RoomBorder Room::DirectionCheck( const Direction d ) const
       "direction kNone.\n" ) ;
   }
 
-  if( d == exit_ )
+  return DirectionCheckUnchecked( d );
+}
+
+// This method returns the type of RoomBorder in the given direction
+// without checking it. Direction d must not be kNone.
+RoomBorder Room::DirectionCheckUnchecked( const Direction d ) const noexcept
+{
+  if( static_cast<unsigned>(d) == (bits_ & kExitMask) >> kExitShift )
   {
     return RoomBorder::kExit;
   }
-
-  else if( ( d == Direction::kNorth && !(wall_north_) ) ||
-           ( d == Direction::kEast  && !(wall_east_)  ) ||
-           ( d == Direction::kSouth && !(wall_south_) ) ||
-           ( d == Direction::kWest  && !(wall_west_)  ) )
+  else if( bits_ & WallBit(d) )
+  {
+    return RoomBorder::kWall;
+  }
+  else
   {
     return RoomBorder::kRoom;
   }
+}
 
-  else
+// This method returns a mask of the Directions which lead to another
+// Room (not a Wall or the exit), in the layout of kWallMask.
+std::uint8_t Room::OpenMask() const
+{
+  const unsigned exit = (bits_ & kExitMask) >> kExitShift;
+  return static_cast<std::uint8_t>( ~bits_ & kWallMask &
+                                    ~WallBit(static_cast<Direction>(exit)) );
+}
+
+// This method returns the packed 16-bit encoding of the Room.
+std::uint16_t Room::Packed() const
+{
+  return bits_;
+}
+
+// This method returns the Room with the given packed 16-bit encoding, as
+// returned by Packed(). Unused bits are cleared.
+Room Room::FromPacked( const std::uint16_t packed )
+{
+  Room rm;
+  rm.bits_ = static_cast<std::uint16_t>( packed &
+    (kWallMask | kExitMask | kInhabitantMask | kItemMask) );
+  return rm;
+}
+
+// PRIVATE METHODS:
+
+// This private method returns the bit of the Wall mask for the given
+// Direction, or 0 for Direction::kNone.
+std::uint16_t Room::WallBit( const Direction d ) noexcept
+{
+  if( d == Direction::kNone )
   {
-    return RoomBorder::kWall;
+    return 0;
   }
+  return static_cast<std::uint16_t>( 1u << (static_cast<unsigned>(d) - 1) );
 }
@@ -0,0 +1,339 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ file contains the implementation of the TurnEngine class, which
+ * plays batches of GameMoves for the Players of a Labyrinth according to
+ * GameInstructions.md, and reports what happened as compact TurnEvents.
+ *
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "../include/coordinate.hpp"
+#include "../include/room_properties.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/player.hpp"
+#include "../include/game_host.hpp"
+#include "../include/turn_engine.hpp"
+
+namespace
+{
+
+// This local function adds an event to the batch.
+void AddEvent( std::vector<TurnEvent>& events,
+               const std::uint32_t player,
+               const Coordinate rm,
+               const TurnEventKind kind );
+
+// This local function returns the Room in the given Direction.
+// Direction d must not be kNone.
+Coordinate Neighbour( const Coordinate rm, const Direction d );
+
+// This local function adds an event to the batch.
+void AddEvent( std::vector<TurnEvent>& events,
+               const std::uint32_t player,
+               const Coordinate rm,
+               const TurnEventKind kind )
+{
+  TurnEvent e;
+  e.player = player;
+  e.x = static_cast<std::uint16_t>( rm.x );
+  e.y = static_cast<std::uint16_t>( rm.y );
+  e.kind = kind;
+  events.push_back( e );
+}
+
+// This local function returns the Room in the given Direction.
+// Direction d must not be kNone.
+Coordinate Neighbour( const Coordinate rm, const Direction d )
+{
+  Coordinate next = rm;
+  switch( d )
+  {
+    case Direction::kNorth: --next.y; break;
+    case Direction::kEast:  ++next.x; break;
+    case Direction::kSouth: ++next.y; break;
+    default:                --next.x; break;
+  }
+  return next;
+}
+
+}  // Local namespace
+
+// Parameterized constructor
+// Every Player is placed in the primary spawn of the Labyrinth, and the
+// first takes the Item there (if any).
+// An exception is thrown if:
+//   players is 0, or too many to be numbered by GameMove (invalid_argument)
+TurnEngine::TurnEngine( Labyrinth& l,
+                        const size_t players,
+                        const TurnRules& rules ) :
+  x_size_(l.XSize()),
+  y_size_(l.YSize()),
+  spawn_2_(l.GetSpawn2())
+{
+  if( players == 0 ||
+      players > std::numeric_limits<std::uint32_t>::max() )
+  {
+    throw std::invalid_argument( "Error: TurnEngine() was given an invalid "\
+      "number of players.\n" );
+  }
+
+  players_.assign( players,
+                   Player(l.GetSpawn1(), rules.bullets, rules.extra_lives) );
+  std::vector<TurnEvent> ignored;
+  TakeItem( l, 0, ignored );
+}
+
+// This method plays a batch of moves and replaces the contents of
+// events with what happened, in order.
+// An exception is thrown if:
+//   l is not the same size as the Labyrinth which the engine was
+//     created with (invalid_argument)
+void TurnEngine::Resolve( Labyrinth& l,
+                          const std::vector<GameMove>& moves,
+                          std::vector<TurnEvent>& events )
+{
+  Resolve( l, moves.data(), moves.size(), events );
+}
+
+void TurnEngine::Resolve( Labyrinth& l,
+                          const GameMove* const moves,
+                          const size_t count,
+                          std::vector<TurnEvent>& events )
+{
+  if( l.XSize() != x_size_ || l.YSize() != y_size_ )
+  {
+    throw std::invalid_argument( "Error: Resolve() was given a Labyrinth "\
+      "which is not the size of the engine's Labyrinth.\n" );
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  events.clear();
+
+  // Validation pass: everything which does not depend on the moves before
+  // it in the batch. Whether a Player is still playing is checked as each
+  // move is played, since an earlier move may have ended their game.
+  valid_.resize( count );
+  for( size_t i = 0; i < count; ++i )
+  {
+    valid_[i] = moves[i].player < players_.size() &&
+                moves[i].direction <= Direction::kWest;
+  }
+
+  for( size_t i = 0; i < count; ++i )
+  {
+    const GameMove& m = moves[i];
+    if( !valid_[i] ||
+        players_[m.player].Status() != PlayerStatus::kPlaying )
+    {
+      const Coordinate rm = valid_[i] ? players_[m.player].Location() :
+                                        Coordinate( 0, 0 );
+      AddEvent( events, m.player, rm, TurnEventKind::kRejected );
+      ++stats_.rejected;
+      continue;
+    }
+    Play( l, m, events );
+  }
+
+  ++stats_.batches;
+  stats_.moves += count;
+  stats_.events += events.size();
+  stats_.resolve_time += static_cast<std::uint64_t>(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - start ).count() );
+}
+
+// This method returns the number of Players.
+size_t TurnEngine::Players() const
+{
+  return players_.size();
+}
+
+// This method returns a Player.
+// An exception is thrown if:
+//   The Player does not exist (invalid_argument)
+const Player& TurnEngine::PlayerAt( const size_t player ) const
+{
+  if( player >= players_.size() )
+  {
+    throw std::invalid_argument( "Error: PlayerAt() was given a player "\
+      "which does not exist.\n" );
+  }
+  return players_[player];
+}
+
+// This method returns the counters of the engine.
+TurnEngineStats TurnEngine::Stats() const
+{
+  return stats_;
+}
+
+// This method returns the number of moves resolved per second of time
+// spent in Resolve(), or 0 if none have been.
+double TurnEngine::MovesPerSecond() const
+{
+  if( stats_.resolve_time == 0 )
+  {
+    return 0;
+  }
+  return static_cast<double>( stats_.moves ) * 1e9 /
+         static_cast<double>( stats_.resolve_time );
+}
+
+// PRIVATE METHODS:
+
+// This private method plays a validated move.
+void TurnEngine::Play( Labyrinth& l,
+                       const GameMove& m,
+                       std::vector<TurnEvent>& events )
+{
+  Player& p = players_[m.player];
+  const Coordinate here = p.Location();
+
+  if( m.direction == Direction::kNone )
+  {
+    AddEvent( events, m.player, here, TurnEventKind::kStayed );
+    return;
+  }
+
+  switch( l.DirectionCheckUnchecked(here, m.direction) )
+  {
+    case RoomBorder::kWall:
+      AddEvent( events, m.player, here, TurnEventKind::kBlocked );
+      return;
+    case RoomBorder::kExit:
+      if( p.HasTreasure() )
+      {
+        p.SetStatus( PlayerStatus::kWon );
+        AddEvent( events, m.player, here, TurnEventKind::kEscaped );
+      }
+      else
+      {
+        AddEvent( events, m.player, here, TurnEventKind::kExitLocked );
+      }
+      return;
+    case RoomBorder::kRoom:
+      break;
+  }
+
+  // Eyes in the darkness are dealt with before the Player is in the Room.
+  const Coordinate next = Neighbour( here, m.direction );
+  const Inhabitant inh = l.GetInhabitantUnchecked( next );
+  bool shot = false;
+  if( m.shoot && ( inh == Inhabitant::kMinotaur ||
+                   inh == Inhabitant::kMirror ) )
+  {
+    if( p.Bullets() == 0 )
+    {
+      AddEvent( events, m.player, next, TurnEventKind::kMisfired );
+    }
+    else
+    {
+      p.UseBullet();
+      l.TryAttackEnemy( next );
+      AddEvent( events, m.player, next, inh == Inhabitant::kMinotaur ?
+                                        TurnEventKind::kShotMinotaur :
+                                        TurnEventKind::kCrackedMirror );
+      shot = true;
+    }
+  }
+  if( inh == Inhabitant::kMinotaur && !shot )
+  {
+    Kill( l, m.player, next, events );
+    return;
+  }
+
+  p.SetLocation( next );
+  AddEvent( events, m.player, next, TurnEventKind::kMoved );
+  TakeItem( l, m.player, events );
+}
+
+// This private method kills a Player who did not shoot the Minotaur in
+// the Room they tried to enter.
+void TurnEngine::Kill( Labyrinth& l,
+                       const std::uint32_t id,
+                       const Coordinate minotaur,
+                       std::vector<TurnEvent>& events )
+{
+  Player& p = players_[id];
+  AddEvent( events, id, minotaur, TurnEventKind::kKilled );
+
+  if( p.HasTreasure() )
+  {
+    p.DropTreasure();
+    l.DropTreasure( p.Location() );
+    AddEvent( events, id, p.Location(), TurnEventKind::kDroppedTreasure );
+  }
+
+  if( p.ExtraLives() == 0 )
+  {
+    p.SetStatus( PlayerStatus::kLost );
+    AddEvent( events, id, p.Location(), TurnEventKind::kLost );
+    return;
+  }
+
+  // The revolver and bullets are kept.
+  p.UseExtraLife();
+  p.SetLocation( spawn_2_ );
+  AddEvent( events, id, spawn_2_, TurnEventKind::kRespawned );
+  TakeItem( l, id, events );
+}
+
+// This private method makes a Player take the Item in their Room.
+void TurnEngine::TakeItem( Labyrinth& l,
+                           const std::uint32_t id,
+                           std::vector<TurnEvent>& events )
+{
+  Player& p = players_[id];
+  const Coordinate here = p.Location();
+  const Item itm = l.ItemAtUnchecked( here );
+  if( itm != Item::kBullet && itm != Item::kTreasure )
+  {
+    return;
+  }
+
+  l.TryTakeItem( here );
+  if( itm == Item::kBullet )
+  {
+    p.AddBullet();
+    AddEvent( events, id, here, TurnEventKind::kTookBullet );
+  }
+  else
+  {
+    p.TakeTreasure();
+    AddEvent( events, id, here, TurnEventKind::kTookTreasure );
+  }
+}
+
+// Parameterized constructor
+TurnEngineHandler::TurnEngineHandler( Labyrinth& l,
+                                      const size_t players,
+                                      const TurnRules& rules ) :
+  engine_(l, players, rules)
+{
+}
+
+// This method resolves the moves of a turn.
+void TurnEngineHandler::Turn( Labyrinth& l,
+                              const std::vector<GameMove>& moves )
+{
+  engine_.Resolve( l, moves, events_ );
+}
+
+// These methods return the engine and the events of the last turn.
+const TurnEngine& TurnEngineHandler::Engine() const
+{
+  return engine_;
+}
+
+const std::vector<TurnEvent>& TurnEngineHandler::Events() const
+{
+  return events_;
+}
@@ -0,0 +1,195 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ file contains the implementation of the WorkStealingPool class,
+ * which runs tasks on a fixed set of worker threads. Each worker has its own
+ * queue, and idle workers steal tasks from the queues of busy ones.
+ *
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../include/work_stealing_pool.hpp"
+
+// Parameterized constructor
+// 0 workers uses one worker per hardware thread.
+WorkStealingPool::WorkStealingPool( const size_t workers ) :
+  queued_(0), unfinished_(0), sleeping_(0), steals_(0)
+{
+  size_t count = workers;
+  if( count == 0 )
+  {
+    count = std::thread::hardware_concurrency();
+    if( count == 0 )
+    {
+      count = 1;
+    }
+  }
+
+  for( size_t i = 0; i < count; ++i )
+  {
+    queues_.push_back( std::make_unique<Queue>() );
+  }
+  for( size_t i = 0; i < count; ++i )
+  {
+    threads_.emplace_back( &WorkStealingPool::Work, this, i );
+  }
+}
+
+// Destructor
+// Waits for the queued tasks to finish, then stops the workers.
+WorkStealingPool::~WorkStealingPool()
+{
+  {
+    std::unique_lock<std::mutex> lock( done_mutex_ );
+    done_.wait( lock, [this]() { return unfinished_.load() == 0; } );
+  }
+  {
+    std::lock_guard<std::mutex> lock( sleep_mutex_ );
+    stop_ = true;
+  }
+  wake_.notify_all();
+  for( std::thread& t : threads_ )
+  {
+    t.join();
+  }
+}
+
+// This method returns the number of worker threads.
+size_t WorkStealingPool::Workers() const
+{
+  return threads_.size();
+}
+
+// This method queues a task on the given worker (modulo the number of
+// workers). Other workers steal it once they have none of their own.
+void WorkStealingPool::Submit( Task task, const size_t worker )
+{
+  unfinished_.fetch_add( 1 );
+  {
+    Queue& q = *queues_[worker % queues_.size()];
+    std::lock_guard<std::mutex> lock( q.mutex );
+    q.tasks.push_back( std::move(task) );
+  }
+  queued_.fetch_add( 1 );
+
+  // A worker going to sleep checks queued_ again while holding
+  // sleep_mutex_, so it either sees this task or is woken here.
+  if( sleeping_.load() > 0 )
+  {
+    std::lock_guard<std::mutex> lock( sleep_mutex_ );
+    wake_.notify_one();
+  }
+}
+
+// This method blocks until every submitted task has finished.
+// An exception is thrown if:
+//   A task threw an exception; the first one is thrown again, after
+//     every task has finished
+void WorkStealingPool::Wait()
+{
+  std::exception_ptr error;
+  {
+    std::unique_lock<std::mutex> lock( done_mutex_ );
+    done_.wait( lock, [this]() { return unfinished_.load() == 0; } );
+    std::swap( error, error_ );
+  }
+  if( error )
+  {
+    std::rethrow_exception( error );
+  }
+}
+
+// This method returns the number of tasks which have been stolen.
+std::uint64_t WorkStealingPool::Steals() const
+{
+  return steals_.load( std::memory_order_relaxed );
+}
+
+// PRIVATE METHODS:
+
+// This private method is run by each worker thread.
+void WorkStealingPool::Work( const size_t worker )
+{
+  Task task;
+  while( true )
+  {
+    if( Take(worker, task) )
+    {
+      try
+      {
+        task( worker );
+      }
+      catch( ... )
+      {
+        std::lock_guard<std::mutex> lock( done_mutex_ );
+        if( !error_ )
+        {
+          error_ = std::current_exception();
+        }
+      }
+      task = nullptr;
+
+      if( unfinished_.fetch_sub(1) == 1 )
+      {
+        std::lock_guard<std::mutex> lock( done_mutex_ );
+        done_.notify_all();
+      }
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock( sleep_mutex_ );
+    sleeping_.fetch_add( 1 );
+    wake_.wait( lock, [this]() { return stop_ || queued_.load() > 0; } );
+    sleeping_.fetch_sub( 1 );
+    if( stop_ && queued_.load() == 0 )
+    {
+      return;
+    }
+  }
+}
+
+// This private method takes a task for the given worker from its own
+// queue or, failing that, from another queue. Returns false if there
+// are none.
+bool WorkStealingPool::Take( const size_t worker, Task& task )
+{
+  {
+    Queue& own = *queues_[worker];
+    std::lock_guard<std::mutex> lock( own.mutex );
+    if( !own.tasks.empty() )
+    {
+      task = std::move( own.tasks.back() );
+      own.tasks.pop_back();
+      queued_.fetch_sub( 1 );
+      return true;
+    }
+  }
+
+  for( size_t i = 1; i < queues_.size(); ++i )
+  {
+    Queue& other = *queues_[(worker + i) % queues_.size()];
+    std::lock_guard<std::mutex> lock( other.mutex );
+    if( !other.tasks.empty() )
+    {
+      task = std::move( other.tasks.front() );
+      other.tasks.pop_front();
+      queued_.fetch_sub( 1 );
+      steals_.fetch_add( 1, std::memory_order_relaxed );
+      return true;
+    }
+  }
+  return false;
+}
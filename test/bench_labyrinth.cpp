@@ -0,0 +1,421 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ file benchmarks the core operations of the Labyrinth,
+ * LabyrinthMap, LabyrinthSolver and LabyrinthFile classes at several board
+ * sizes.
+ *
+ * Usage: ./output [--csv] [--quick]
+ *   --csv    prints one comma-separated line per benchmark, for scripts
+ *   --quick  runs each benchmark for less time
+ *
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/room.hpp"
+#include "../include/room_row.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_map.hpp"
+#include "../include/labyrinth_map_backend.hpp"
+#include "../include/labyrinth_generator.hpp"
+#include "../include/labyrinth_solver.hpp"
+#include "../include/labyrinth_file.hpp"
+#include "../include/labyrinth_analytics.hpp"
+
+namespace
+{
+
+// A board size which every benchmark is run at.
+struct BenchSize
+{
+  size_t x_size;
+  size_t y_size;
+  LabyrinthMode mode;
+};
+
+// How the benchmarks are run and reported.
+struct BenchConfig
+{
+  bool csv = false;
+  double min_seconds = 0.25;  // Each benchmark repeats for at least this
+};
+
+// Results are added here so that the compiler cannot remove the work.
+volatile size_t g_sink = 0;
+
+// This local function repeats a benchmark until it has run for the minimum
+// time, then prints its time per operation. body returns the number of
+// operations it performed.
+template <typename Body>
+void Measure( const char* const name,
+              const BenchSize& s,
+              const BenchConfig& c,
+              Body body );
+
+// This local function connects the Rooms in a spanning tree, row by row
+// (every Room to the east, and the first Room of each row to the south).
+void ConnectAll( Labyrinth& l );
+
+// This local function runs every benchmark at one board size.
+void RunSize( const BenchSize& s, const BenchConfig& c );
+
+// This local function repeats a benchmark until it has run for the minimum
+// time, then prints its time per operation.
+template <typename Body>
+void Measure( const char* const name,
+              const BenchSize& s,
+              const BenchConfig& c,
+              Body body )
+{
+  size_t iterations = 0;
+  size_t operations = 0;
+  const auto start = std::chrono::steady_clock::now();
+  double seconds = 0;
+  do
+  {
+    operations += body();
+    ++iterations;
+    seconds = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start ).count();
+  } while( seconds < c.min_seconds );
+
+  const double ns_per_op = seconds * 1e9 / static_cast<double>( operations );
+  if( c.csv )
+  {
+    std::cout << name << "," << s.x_size << "," << s.y_size << ","
+              << iterations << "," << operations << ","
+              << std::fixed << std::setprecision(3) << ns_per_op
+              << std::endl;
+  }
+  else
+  {
+    std::cout << "  " << std::left << std::setw(28) << name << std::right
+              << std::setw(6) << s.x_size << " x " << std::left
+              << std::setw(6) << s.y_size << std::right << std::setw(14)
+              << std::fixed << std::setprecision(3) << ns_per_op
+              << " ns/op" << std::endl;
+  }
+}
+
+// This local function connects the Rooms in a spanning tree, row by row.
+void ConnectAll( Labyrinth& l )
+{
+  for( size_t y = 0; y < l.YSize(); ++y )
+  {
+    for( size_t x = 0; x + 1 < l.XSize(); ++x )
+    {
+      l.ConnectRooms( Coordinate(x, y), Coordinate(x + 1, y) );
+    }
+    if( y + 1 < l.YSize() )
+    {
+      l.ConnectRooms( Coordinate(0, y), Coordinate(0, y + 1) );
+    }
+  }
+}
+
+// This local function runs every benchmark at one board size.
+void RunSize( const BenchSize& s, const BenchConfig& c )
+{
+  const size_t rooms = s.x_size * s.y_size;
+  const Direction directions[4] = { Direction::kNorth, Direction::kEast,
+                                    Direction::kSouth, Direction::kWest };
+
+  // The same random Rooms are used by every random-access benchmark.
+  std::mt19937_64 rng( 18 );
+  std::vector<Coordinate> random_rooms( 4096 );
+  for( Coordinate& rm : random_rooms )
+  {
+    rm = Coordinate( rng() % s.x_size, rng() % s.y_size );
+  }
+
+  // CONSTRUCTION AND SETUP:
+
+  Measure( "construct", s, c, [&s]()
+  {
+    Labyrinth l( s.x_size, s.y_size, s.mode );
+    g_sink = g_sink + l.XSize();
+    return size_t( 1 );
+  } );
+
+  Measure( "connect_rooms", s, c, [&s, rooms]()
+  {
+    Labyrinth l( s.x_size, s.y_size, s.mode );
+    ConnectAll( l );
+    g_sink = g_sink + l.TopologyVersion();
+    return rooms - 1;
+  } );
+
+  GeneratorOptions options;
+  options.bullets = rooms / 50;
+  options.minotaurs = rooms / 50;
+  options.mirrors = rooms / 50;
+  LabyrinthGenerator generator( options );
+  Measure( "generate_backtracker", s, c, [&s, &generator, rooms]()
+  {
+    Labyrinth l( s.x_size, s.y_size, s.mode );
+    generator.Generate( l );
+    g_sink = g_sink + l.TopologyVersion();
+    return rooms;
+  } );
+
+  Labyrinth l( s.x_size, s.y_size, s.mode );
+  generator.Generate( l );
+
+  // ROOM ACCESS:
+
+  Measure( "direction_check_sequential", s, c, [&l, &directions, rooms]()
+  {
+    size_t sum = 0;
+    for( size_t y = 0; y < l.YSize(); ++y )
+    {
+      for( size_t x = 0; x < l.XSize(); ++x )
+      {
+        sum += static_cast<size_t>(
+          l.DirectionCheck(Coordinate(x, y), directions[(x + y) % 4]) );
+      }
+    }
+    g_sink = g_sink + sum;
+    return rooms;
+  } );
+
+  Measure( "direction_check_random", s, c, [&l, &directions, &random_rooms]()
+  {
+    size_t sum = 0;
+    for( size_t i = 0; i < random_rooms.size(); ++i )
+    {
+      sum += static_cast<size_t>(
+        l.DirectionCheck(random_rooms[i], directions[i % 4]) );
+    }
+    g_sink = g_sink + sum;
+    return random_rooms.size();
+  } );
+
+  Measure( "room_at_sequential", s, c, [&l, rooms]()
+  {
+    size_t sum = 0;
+    for( size_t y = 0; y < l.YSize(); ++y )
+    {
+      for( const Room& rm : l.RowAt(y) )
+      {
+        sum += rm.Packed();
+      }
+    }
+    g_sink = g_sink + sum;
+    return rooms;
+  } );
+
+  Measure( "room_at_random", s, c, [&l, &random_rooms]()
+  {
+    size_t sum = 0;
+    for( const Coordinate& rm : random_rooms )
+    {
+      sum += l.RoomAtUnchecked( rm ).Packed();
+    }
+    g_sink = g_sink + sum;
+    return random_rooms.size();
+  } );
+
+  // MAP:
+  // Constructing a map costs the same at every board size; the first
+  // render builds every Border and Room (UpdateBorders() and
+  // UpdateRooms()), and rendering after one change only updates that Room.
+
+  Measure( "map_construct", s, c, [&l, &s]()
+  {
+    LabyrinthMap m( &l, s.x_size, s.y_size );
+    return size_t( 1 );
+  } );
+
+  Measure( "map_build", s, c, [&l, &s]()
+  {
+    LabyrinthMap m( &l, s.x_size, s.y_size );
+    g_sink = g_sink + m.RenderWindow( Coordinate(0, 0), 80, 24 ).size();
+    return size_t( 1 );
+  } );
+
+  {
+    LabyrinthMap m( &l, s.x_size, s.y_size );
+    Measure( "map_render_unchanged", s, c, [&m]()
+    {
+      g_sink = g_sink + m.Render().size();
+      return size_t( 1 );
+    } );
+
+    // A Room is changed and changed back, with a render after each.
+    size_t r = 0;
+    while( l.GetInhabitant(random_rooms[r]) != Inhabitant::kNone )
+    {
+      ++r;
+    }
+    const Coordinate changed = random_rooms[r];
+    Measure( "map_render_one_change", s, c, [&l, &m, &changed]()
+    {
+      const size_t checkpoint = l.Checkpoint();
+      l.SetInhabitant( changed, Inhabitant::kMirror );
+      g_sink = g_sink + m.Render().size();
+      l.Rollback( checkpoint );
+      g_sink = g_sink + m.Render().size();
+      return size_t( 2 );
+    } );
+    l.ReleaseCheckpoints();
+
+    std::ofstream null( "/dev/null" );
+    Measure( "map_display", s, c, [&m, &null]()
+    {
+      m.Display( null );
+      return size_t( 1 );
+    } );
+
+    // A window of an 80 x 24 terminal costs the same at every board size.
+    Measure( "map_render_window", s, c, [&m, &random_rooms]()
+    {
+      g_sink = g_sink + m.RenderWindow( random_rooms[0], 80, 24 ).size();
+      return size_t( 1 );
+    } );
+
+    Measure( "map_render_overview", s, c, [&m]()
+    {
+      g_sink = g_sink + m.RenderOverview( 80, 24 ).size();
+      return size_t( 1 );
+    } );
+
+    AsciiMapBackend ascii( null );
+    Measure( "map_render_ascii", s, c, [&m, &ascii]()
+    {
+      m.Render( ascii );
+      return size_t( 1 );
+    } );
+
+    PngMapBackend png( null );
+    Measure( "map_render_png", s, c, [&m, &png]()
+    {
+      m.Render( png );
+      return size_t( 1 );
+    } );
+  }
+
+  // SOLVER:
+
+  LabyrinthSolver solver( &l );
+  std::vector<Coordinate> path;
+  const SolverAlgorithm algorithms[3] = { SolverAlgorithm::kBreadthFirst,
+                                          SolverAlgorithm::kAStar,
+                                          SolverAlgorithm::kBidirectional };
+  const char* const solver_names[3] = { "solver_breadth_first",
+                                        "solver_a_star",
+                                        "solver_bidirectional" };
+  for( size_t a = 0; a < 3; ++a )
+  {
+    const SolverAlgorithm algorithm = algorithms[a];
+    Measure( solver_names[a], s, c,
+             [&solver, &path, &random_rooms, algorithm]()
+    {
+      for( size_t i = 0; i < 16; ++i )
+      {
+        solver.FindPath( random_rooms[2 * i], random_rooms[2 * i + 1],
+                         path, algorithm );
+        g_sink = g_sink + path.size();
+      }
+      return size_t( 16 );
+    } );
+  }
+
+  // ANALYTICS:
+
+  LabyrinthAnalytics analytics;
+  Measure( "maze_analytics", s, c, [&l, &analytics, rooms]()
+  {
+    g_sink = g_sink + analytics.Analyze( l ).solution_length;
+    return rooms;
+  } );
+
+  // SERIALIZATION:
+
+  const std::string path_name = "bench.laby";
+  Measure( "file_save", s, c, [&l, &path_name]()
+  {
+    LabyrinthFile::Save( l, path_name );
+    return size_t( 1 );
+  } );
+  Measure( "file_load", s, c, [&path_name]()
+  {
+    const Labyrinth loaded = LabyrinthFile::Load( path_name );
+    g_sink = g_sink + loaded.XSize();
+    return size_t( 1 );
+  } );
+  Measure( "file_map", s, c, [&path_name]()
+  {
+    const Labyrinth mapped = LabyrinthFile::Map( path_name );
+    g_sink = g_sink + mapped.XSize();
+    return size_t( 1 );
+  } );
+  std::remove( path_name.c_str() );
+}
+
+}  // Local namespace
+
+int main( int argc, char* argv[] )
+{
+  BenchConfig config;
+  for( int i = 1; i < argc; ++i )
+  {
+    if( std::strcmp(argv[i], "--csv") == 0 )
+    {
+      config.csv = true;
+    }
+    else if( std::strcmp(argv[i], "--quick") == 0 )
+    {
+      config.min_seconds = 0.02;
+    }
+    else
+    {
+      std::cerr << "Usage: " << argv[0] << " [--csv] [--quick]" << std::endl;
+      return 1;
+    }
+  }
+
+  const BenchSize sizes[3] =
+  {
+    { 20,   20,   LabyrinthMode::kSmall },
+    { 256,  256,  LabyrinthMode::kLarge },
+    { 1024, 1024, LabyrinthMode::kLarge },
+  };
+
+  if( config.csv )
+  {
+    std::cout << "benchmark,x_size,y_size,iterations,operations,ns_per_op"
+              << std::endl;
+  }
+  else
+  {
+    std::cout << std::endl
+              << "BENCHMARKING LABYRINTH OPERATIONS" << std::endl
+              << "________________________________________________"
+              << std::endl << std::endl;
+  }
+
+  for( const BenchSize& s : sizes )
+  {
+    RunSize( s, config );
+    if( !config.csv )
+    {
+      std::cout << std::endl;
+    }
+  }
+
+  return 0;
+}
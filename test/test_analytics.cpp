@@ -0,0 +1,180 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ file tests the LabyrinthAnalytics class implementation.
+ *
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_generator.hpp"
+#include "../include/labyrinth_query.hpp"
+#include "../include/labyrinth_solver.hpp"
+#include "../include/labyrinth_analytics.hpp"
+
+namespace
+{
+
+// This local function prints every measurement of a maze.
+void PrintStats( const MazeStats& stats );
+
+// This local function prints every measurement of a maze.
+void PrintStats( const MazeStats& stats )
+{
+  std::cout << "  Rooms: " << stats.rooms
+            << ", dead ends: " << stats.dead_ends
+            << ", junctions: " << stats.junctions << std::endl
+            << "  Corridors: " << stats.corridors
+            << ", longest: " << stats.longest_corridor
+            << ", lengths (1, 2-3, 4-7, ...):";
+  for( unsigned b = 0; b < MazeStats::kCorridorBuckets; ++b )
+  {
+    std::cout << " " << stats.corridor_lengths[b];
+  }
+  std::cout << std::endl << "  Solution: ";
+  if( stats.solution_length == MazeStats::kUnsolved )
+  {
+    std::cout << "none";
+  }
+  else
+  {
+    std::cout << stats.solution_length << " steps";
+  }
+  std::cout << ", " << stats.solution_rooms << " Rooms, "
+            << stats.solution_minotaurs << " Minotaurs, "
+            << stats.side_branches << " side branches" << std::endl
+            << "  Branching factor: " << stats.branching_factor
+            << ", river: " << stats.river
+            << ", turn ratio: " << stats.turn_ratio << std::endl;
+}
+
+}  // Local namespace
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING LABYRINTH_ANALYTICS.CPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+
+
+  std::cout << "Analysing a 3 x 2 Labyrinth which is a snake from spawn 1 at "
+            << "the top left to the exit at the bottom right, with the "
+            << "Treasure at the bottom center and a Minotaur at the bottom "
+            << "left:" << std::endl;
+  Labyrinth l( 3, 2 );
+  l.ConnectRooms( Coordinate(0, 0), Coordinate(0, 1) );
+  l.ConnectRooms( Coordinate(0, 1), Coordinate(1, 1) );
+  l.ConnectRooms( Coordinate(1, 1), Coordinate(1, 0) );
+  l.ConnectRooms( Coordinate(1, 0), Coordinate(2, 0) );
+  l.ConnectRooms( Coordinate(2, 0), Coordinate(2, 1) );
+  l.SetExit( Coordinate(2, 1), Direction::kSouth );
+  l.SetSpawn1( Coordinate(0, 0) );
+  l.SetItem( Coordinate(1, 1), Item::kTreasure );
+  l.SetInhabitant( Coordinate(0, 1), Inhabitant::kMinotaur );
+
+  LabyrinthAnalytics analytics;
+  PrintStats( analytics.Analyze(l) );
+  std::cout << "  (Expected: 6 Rooms, 1 dead end (the Room with the exit has "
+            << "only 2 Walls), 0 junctions; 1 corridor of length 4 in bucket "
+            << "4-7; a solution of 5 steps through all 6 Rooms with 1 "
+            << "Minotaur and no side branches; a river of 0.666667 and a "
+            << "turn ratio of 1.)" << std::endl;
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Analysing it after the Treasure is taken:" << std::endl;
+  l.TakeItem( Coordinate(1, 1) );
+  std::cout << "  Solution: "
+            << ( analytics.Analyze(l).solution_length ==
+                 MazeStats::kUnsolved ? "none" : "found" )
+            << " (none expected)." << std::endl;
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "________________________________________________"
+            << std::endl
+            << std::endl;
+
+  std::cout << "Analysing a generated 100 x 100 LabyrinthMode::kLarge "
+            << "Labyrinth with 40 Minotaurs:" << std::endl;
+  {
+    GeneratorOptions options;
+    options.seed = 29;
+    options.minotaurs = 40;
+    LabyrinthGenerator generator( options );
+    Labyrinth l_large( 100, 100, LabyrinthMode::kLarge );
+    generator.Generate( l_large );
+
+    const MazeStats stats = analytics.Analyze( l_large );
+    PrintStats( stats );
+
+    LabyrinthSolver solver( &l_large );
+    const size_t solution =
+      solver.Distance( l_large.GetSpawn1(), l_large.GetTreasure() ) +
+      solver.Distance( l_large.GetTreasure(), l_large.GetExit() );
+    std::uint32_t bucketed = 0;
+    for( unsigned b = 0; b < MazeStats::kCorridorBuckets; ++b )
+    {
+      bucketed += stats.corridor_lengths[b];
+    }
+    std::cout << "  The dead ends match LabyrinthQuery::DeadEnds(): "
+              << ( stats.dead_ends ==
+                   LabyrinthQuery::DeadEnds(l_large).Count() )
+              << std::endl
+              << "  The solution matches LabyrinthSolver::Distance(): "
+              << ( stats.solution_length == solution ) << std::endl
+              << "  Every corridor is in a bucket: "
+              << ( bucketed == stats.corridors ) << std::endl;
+    std::cout << "  (1 expected for each.)" << std::endl;
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Generating and analysing 1000 20 x 20 Labyrinths, keeping "
+            << "those whose solution is at least 60 steps:" << std::endl;
+  {
+    GeneratorOptions options;
+    options.minotaurs = 5;
+    LabyrinthGenerator generator( options );
+    size_t kept = 0;
+    std::chrono::steady_clock::duration analysis_time{};
+    for( std::uint64_t seed = 1; seed <= 1000; ++seed )
+    {
+      Labyrinth candidate( 20, 20 );
+      generator.SetSeed( seed );
+      generator.Generate( candidate );
+      const auto start = std::chrono::steady_clock::now();
+      const MazeStats stats = analytics.Analyze( candidate );
+      analysis_time += std::chrono::steady_clock::now() - start;
+      kept += stats.solution_length != MazeStats::kUnsolved &&
+              stats.solution_length >= 60;
+    }
+    std::cout << "  Kept " << kept << " Labyrinths; each analysis took "
+              << std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   analysis_time ).count() / 1000
+              << " ns on average (varies)." << std::endl;
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,257 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ file tests the LabyrinthArena class implementation, and
+ * allocating a Labyrinth and a LabyrinthMap from it.
+ *
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <new>
+#include <string>
+#include <utility>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_map.hpp"
+#include "../include/labyrinth_generator.hpp"
+#include "../include/labyrinth_arena.hpp"
+
+namespace
+{
+
+// Number of times operator new has been called.
+size_t g_allocations = 0;
+
+// This local function generates a 20 x 20 Labyrinth with the given seed,
+// with its Rooms (and the cells of a map of it) from the arena if one is
+// given, renders the map, and returns the text.
+std::string PlayGame( LabyrinthGenerator& generator,
+                      const std::uint64_t seed,
+                      LabyrinthArena* const arena );
+
+// This local function generates a Labyrinth and renders its map.
+std::string PlayGame( LabyrinthGenerator& generator,
+                      const std::uint64_t seed,
+                      LabyrinthArena* const arena )
+{
+  generator.SetSeed( seed );
+  if( arena != nullptr )
+  {
+    Labyrinth l( 20, 20, *arena );
+    LabyrinthMap m( &l, 20, 20, *arena );
+    generator.Generate( l );
+    return m.Render();
+  }
+  Labyrinth l( 20, 20 );
+  LabyrinthMap m( &l, 20, 20 );
+  generator.Generate( l );
+  return m.Render();
+}
+
+}  // Local namespace
+
+// Every allocation of the program is counted.
+void* operator new( const size_t size )
+{
+  ++g_allocations;
+  void* const p = std::malloc( size == 0 ? 1 : size );
+  if( p == nullptr )
+  {
+    throw std::bad_alloc();
+  }
+  return p;
+}
+
+void operator delete( void* const p ) noexcept
+{
+  std::free( p );
+}
+
+void operator delete( void* const p, const size_t ) noexcept
+{
+  std::free( p );
+}
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING LABYRINTH_ARENA.CPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+
+
+  std::cout << "Allocating from an arena with 256-byte blocks:" << std::endl;
+  {
+    LabyrinthArena arena( 256 );
+    std::cout << "  Blocks before the first allocation: " << arena.Blocks()
+              << " (0 expected)." << std::endl;
+    void* const a = arena.Allocate( 3, 1 );
+    void* const b = arena.Allocate( 8, 8 );
+    std::cout << "  Bytes used: " << arena.BytesUsed()
+              << " (16 expected: 3 bytes, 5 of padding, 8 bytes)." << std::endl
+              << "  The second allocation is aligned: "
+              << ( reinterpret_cast<std::uintptr_t>(b) % 8 == 0 )
+              << ", and follows the first: "
+              << ( static_cast<char*>(b) - static_cast<char*>(a) == 8 )
+              << " (1, 1 expected)." << std::endl;
+    arena.Allocate( 1000, 8 );
+    std::cout << "  Blocks after a 1000-byte allocation: " << arena.Blocks()
+              << " (2 expected)." << std::endl;
+    arena.Release();
+    std::cout << "  Blocks and bytes used after Release(): " << arena.Blocks()
+              << ", " << arena.BytesUsed() << " (1, 0 expected)." << std::endl;
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Allocating with an unsupported alignment "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    LabyrinthArena arena;
+    arena.Allocate( 8, 3 );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Creating an arena from a null buffer "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    LabyrinthArena arena( nullptr, 1024 );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "________________________________________________"
+            << std::endl
+            << std::endl;
+
+  GeneratorOptions options;
+  options.bullets = 4;
+  options.minotaurs = 4;
+  options.mirrors = 4;
+  LabyrinthGenerator generator( options );
+
+  std::cout << "Playing a 20 x 20 game with and without an arena in a "
+            << "buffer (The maps should be identical):" << std::endl;
+  {
+    alignas( std::max_align_t ) static unsigned char buffer[16 * 1024];
+    LabyrinthArena arena( buffer, sizeof(buffer) );
+    PlayGame( generator, 1, nullptr );  // Sizes the scratch of the generator
+    PlayGame( generator, 1, &arena );
+    arena.Release();
+
+    size_t before = g_allocations;
+    const std::string heap_map = PlayGame( generator, 2, nullptr );
+    const size_t heap_allocations = g_allocations - before;
+    before = g_allocations;
+    const std::string arena_map = PlayGame( generator, 2, &arena );
+    const size_t arena_allocations = g_allocations - before;
+
+    std::cout << "  Identical: " << ( heap_map == arena_map )
+              << " (1 expected)." << std::endl
+              << "  Heap allocations: " << heap_allocations
+              << " without the arena, " << arena_allocations
+              << " with it (Only the observer list and the rendered text "
+              << "should remain)." << std::endl
+              << "  Arena blocks: " << arena.Blocks()
+              << " (1 expected: the buffer), bytes used: "
+              << arena.BytesUsed() << "." << std::endl;
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Playing 10000 games from one arena, released after each:"
+            << std::endl;
+  {
+    LabyrinthArena arena;
+    size_t blocks = 0;
+    size_t most_used = 0;
+    for( std::uint64_t seed = 0; seed < 10000; ++seed )
+    {
+      PlayGame( generator, seed, &arena );
+      blocks = std::max( blocks, arena.Blocks() );
+      most_used = std::max( most_used, arena.BytesUsed() );
+      arena.Release();
+    }
+    std::cout << "  Most blocks held: " << blocks
+              << " (1 expected), most bytes used by a game: " << most_used
+              << "." << std::endl;
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Moving and cloning a Labyrinth from an arena:" << std::endl;
+  {
+    LabyrinthArena arena;
+    Labyrinth l( 10, 10, arena );
+    generator.Generate( l );
+    const size_t used = arena.BytesUsed();
+    const size_t before = g_allocations;
+    const Labyrinth moved( std::move(l) );
+    std::cout << "  Heap allocations of the move: " << g_allocations - before
+              << ", arena bytes used by it: " << arena.BytesUsed() - used
+              << " (0, 0 expected)." << std::endl;
+    const Labyrinth clone = moved.Clone();
+    std::cout << "  The clone has the same Treasure: "
+              << ( clone.GetTreasure() == moved.GetTreasure() )
+              << ", arena bytes used by it: " << arena.BytesUsed() - used
+              << " (1, 0 expected: clones are allocated normally)."
+              << std::endl;
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Constructing a map of a 1000 x 1000 Labyrinth from an arena, "
+            << "then rendering a window of it:" << std::endl;
+  {
+    LabyrinthArena arena;
+    Labyrinth l( 1000, 1000, LabyrinthMode::kLarge );
+    LabyrinthMap m( &l, 1000, 1000, arena );
+    std::cout << "  Arena bytes used by the constructor: "
+              << arena.BytesUsed() << " (0 expected)." << std::endl;
+    m.RenderWindow( Coordinate(0, 0), 80, 24 );
+    std::cout << "  More than 1 arena byte per Room used by the first "
+              << "window: " << ( arena.BytesUsed() > 1000 * 1000 )
+              << " (1 expected)." << std::endl;
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Creating a 21 x 5 Labyrinth in an arena "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    LabyrinthArena arena;
+    Labyrinth l( 21, 5, arena );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
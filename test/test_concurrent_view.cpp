@@ -0,0 +1,241 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ file tests the LabyrinthConcurrentView class implementation.
+ *
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <exception>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/room.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_generator.hpp"
+#include "../include/labyrinth_concurrent_view.hpp"
+
+namespace
+{
+
+// This local function returns true if every Room of the view is the same
+// as in the Labyrinth.
+bool SameRooms( const Labyrinth& l, const LabyrinthConcurrentView& v );
+
+// This local function returns true if the snapshot has the Treasure in
+// exactly the Room it records, or in no Room if it is not set.
+bool TreasureConsistent( const LabyrinthViewSnapshot& s,
+                         const size_t x_size );
+
+// This local function returns true if every Room of the view is the same
+// as in the Labyrinth.
+bool SameRooms( const Labyrinth& l, const LabyrinthConcurrentView& v )
+{
+  for( size_t y = 0; y < l.YSize(); ++y )
+  {
+    for( size_t x = 0; x < l.XSize(); ++x )
+    {
+      if( l.RowAt(y)[x].Packed() != v.RoomAt(Coordinate(x, y)).Packed() )
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// This local function returns true if the snapshot has the Treasure in
+// exactly the Room it records.
+bool TreasureConsistent( const LabyrinthViewSnapshot& s,
+                         const size_t x_size )
+{
+  size_t treasures = 0;
+  for( const Room& rm : s.rooms )
+  {
+    treasures += rm.GetItem() == Item::kTreasure;
+  }
+  if( !s.treasure_set )
+  {
+    return treasures == 0;
+  }
+  return treasures == 1 &&
+         s.rooms[s.treasure.y * x_size + s.treasure.x].GetItem() ==
+         Item::kTreasure;
+}
+
+}  // Local namespace
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING LABYRINTH_CONCURRENT_VIEW.CPP IMPLEMENTATION"
+            << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+
+
+  std::cout << "Viewing a generated 12 x 10 Labyrinth:" << std::endl;
+  GeneratorOptions options;
+  options.seed = 24;
+  options.bullets = 3;
+  options.minotaurs = 3;
+  options.mirrors = 3;
+  LabyrinthGenerator generator( options );
+  Labyrinth l( 12, 10 );
+  {
+    LabyrinthConcurrentView v( &l );
+    generator.Generate( l );
+
+    Coordinate treasure;
+    Coordinate exit;
+    Direction exit_direction = Direction::kNone;
+    const bool treasure_set = v.TryGetTreasure( treasure );
+    const bool exit_set = v.TryGetExit( exit, exit_direction );
+    std::cout << "  Rooms are the same as the Labyrinth: "
+              << SameRooms( l, v ) << " (1 expected)." << std::endl
+              << "  Treasure and exit are the same: "
+              << ( treasure_set && treasure == l.GetTreasure() &&
+                   exit_set && exit == l.GetExit() &&
+                   exit_direction == l.GetExitDirection() )
+              << " (1, 1 expected)." << std::endl;
+
+    l.TakeItem( treasure );
+    std::cout << "  After the Treasure is taken, it is in a Room: "
+              << v.TryGetTreasure( treasure ) << ", the Room has "
+              << ( v.ItemAt(treasure) == Item::kTreasureGone ?
+                   "Item::kTreasureGone" : "another Item" )
+              << " (0, Item::kTreasureGone expected)." << std::endl;
+    const size_t checkpoint = l.Checkpoint();
+    l.DropTreasure( Coordinate(0, 0) );
+    l.Rollback( checkpoint );
+    std::cout << "  After dropping the Treasure and rolling back, the Rooms "
+              << "are the same: " << SameRooms( l, v )
+              << ", the Treasure is in a Room: "
+              << v.TryGetTreasure( treasure )
+              << " (1, 0 expected)." << std::endl;
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Reading Room (12, 0) (An error should be thrown):"
+            << std::endl;
+  try
+  {
+    LabyrinthConcurrentView v( &l );
+    v.GetInhabitant( Coordinate(12, 0) );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Checking Direction::kNone (An error should be thrown):"
+            << std::endl;
+  try
+  {
+    LabyrinthConcurrentView v( &l );
+    v.DirectionCheck( Coordinate(0, 0), Direction::kNone );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "________________________________________________"
+            << std::endl
+            << std::endl;
+
+  std::cout << "Moving the Treasure 100000 times on the game thread while 4 "
+            << "spectator threads read and take snapshots:" << std::endl;
+  {
+    const size_t side = 16;
+    const unsigned moves = 100000;
+    Labyrinth game( side, side );
+    LabyrinthConcurrentView v( &game );
+
+    std::atomic<bool> done( false );
+    std::atomic<bool> consistent( true );
+    std::atomic<std::uint64_t> snapshots( 0 );
+    std::vector<std::thread> spectators;
+    for( unsigned t = 0; t < 4; ++t )
+    {
+      spectators.emplace_back( [&, t]()
+      {
+        LabyrinthViewSnapshot s;
+        do
+        {
+          if( t % 2 == 0 )
+          {
+            v.Snapshot( s );
+            if( !TreasureConsistent(s, side) )
+            {
+              consistent.store( false );
+            }
+            snapshots.fetch_add( 1 );
+          }
+          else
+          {
+            // Single reads may see different moments, but never a Room
+            // which was not written.
+            for( size_t i = 0; i < side * side; ++i )
+            {
+              const Item itm = v.ItemAt( Coordinate(i % side, i / side) );
+              if( itm != Item::kNone && itm != Item::kTreasure &&
+                  itm != Item::kTreasureGone )
+              {
+                consistent.store( false );
+              }
+            }
+          }
+        } while( !done.load() );
+      } );
+    }
+
+    for( unsigned k = 0; k < moves; ++k )
+    {
+      const Coordinate rm( k % side, (k / side) % side );
+      game.DropTreasure( rm );
+      game.TakeItem( rm );
+    }
+    done.store( true );
+    for( std::thread& t : spectators )
+    {
+      t.join();
+    }
+
+    LabyrinthViewSnapshot last;
+    v.Snapshot( last );
+    std::cout << "  Every read was consistent: " << consistent.load()
+              << ", snapshots were taken: " << ( snapshots.load() > 0 )
+              << " (1, 1 expected)." << std::endl
+              << "  Version: " << v.Version()
+              << " (200001 expected: 1 when created, and 1 for each drop and "
+              << "take)." << std::endl
+              << "  The last snapshot is the same as the Labyrinth: "
+              << ( SameRooms(game, v) && last.version == v.Version() &&
+                   !last.treasure_set )
+              << " (1 expected)." << std::endl;
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
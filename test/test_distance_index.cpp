@@ -0,0 +1,205 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ file tests the LabyrinthDistanceIndex class implementation.
+ *
+ */
+
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_generator.hpp"
+#include "../include/labyrinth_solver.hpp"
+#include "../include/labyrinth_distance_index.hpp"
+
+namespace
+{
+
+// This local function returns the given kind as a string.
+std::string KindPrint( DistanceIndexKind k );
+
+// This local function prints whether the index agrees with a
+// breadth-first search for a spread of pairs of Rooms.
+void CheckAgainstSolver( const Labyrinth& l, LabyrinthDistanceIndex& index );
+
+// This local function returns the given kind as a string.
+std::string KindPrint( DistanceIndexKind k )
+{
+  switch( k )
+  {
+    case( DistanceIndexKind::kNone ):
+      return "none";
+    case( DistanceIndexKind::kAllPairs ):
+      return "all-pairs";
+    case( DistanceIndexKind::kTree ):
+      return "tree";
+    case( DistanceIndexKind::kLandmarks ):
+      return "landmarks";
+  }
+  return "Error: KindPrint() was given a kind which could not be detected.";
+}
+
+// This local function prints whether the index agrees with a
+// breadth-first search for a spread of pairs of Rooms.
+void CheckAgainstSolver( const Labyrinth& l, LabyrinthDistanceIndex& index )
+{
+  LabyrinthSolver solver( &l );
+  const size_t x_size = l.XSize();
+  const size_t y_size = l.YSize();
+
+  bool equal = true;
+  size_t longest = 0;
+  for( size_t query = 0; query < 300; ++query )
+  {
+    const Coordinate start( (query * 17) % x_size, (query * 7) % y_size );
+    const Coordinate goal( (query * 13) % x_size, (query * 31) % y_size );
+    const size_t d = index.Distance( start, goal );
+    equal = equal && d == solver.Distance( start, goal );
+    if( d != LabyrinthDistanceIndex::kUnreachable && d > longest )
+    {
+      longest = d;
+    }
+  }
+  std::cout << "  Index kind: " << KindPrint( index.Kind() ) << "."
+            << std::endl
+            << "  300 queries: distances "
+            << ( equal ? "match" : "do NOT match" )
+            << " breadth-first search (longest " << longest << ")."
+            << std::endl;
+}
+
+}  // Local namespace
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING LABYRINTH_DISTANCE_INDEX.CPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+
+
+  GeneratorOptions options;
+  options.seed = 42;
+  options.minotaurs = 3;
+  LabyrinthGenerator generator( options );
+
+  std::cout << "Indexing a generated 20 x 20 Labyrinth:" << std::endl;
+  Labyrinth l_small( 20, 20 );
+  generator.Generate( l_small );
+  LabyrinthDistanceIndex index_small( &l_small );
+  std::cout << "  Before the first query, the index is "
+            << ( index_small.Stale() ? "stale" : "NOT stale" ) << "."
+            << std::endl;
+  CheckAgainstSolver( l_small, index_small );
+  std::cout << "  Distance from spawn 1 to the exit: "
+            << index_small.DistanceToExit( l_small.GetSpawn1() ) << "."
+            << std::endl;
+
+  std::vector<Coordinate> minotaurs;
+  for( size_t y = 0; y < 20; ++y )
+  {
+    for( size_t x = 0; x < 20; ++x )
+    {
+      if( l_small.GetInhabitant(Coordinate(x, y)) == Inhabitant::kMinotaur )
+      {
+        minotaurs.push_back( Coordinate(x, y) );
+      }
+    }
+  }
+  std::cout << "  Distance from spawn 1 to the nearest of "
+            << minotaurs.size() << " Minotaurs: "
+            << index_small.NearestDistance( l_small.GetSpawn1(), minotaurs )
+            << "." << std::endl;
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Indexing a generated 300 x 200 Labyrinth:" << std::endl;
+  Labyrinth l_large( 300, 200, LabyrinthMode::kLarge );
+  generator.Generate( l_large );
+  LabyrinthDistanceIndex index_large( &l_large );
+  CheckAgainstSolver( l_large, index_large );
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Connecting Rooms after the index is built "
+            << "(The index should be rebuilt):" << std::endl;
+  for( size_t x = 0; x + 1 < 300; x += 3 )
+  {
+    if( l_large.DirectionCheck(Coordinate(x, 100), Direction::kEast) !=
+        RoomBorder::kRoom )
+    {
+      l_large.ConnectRooms( Coordinate(x, 100), Coordinate(x + 1, 100) );
+    }
+  }
+  std::cout << "  After connecting, the index is "
+            << ( index_large.Stale() ? "stale" : "NOT stale" ) << "."
+            << std::endl;
+  CheckAgainstSolver( l_large, index_large );
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Indexing a 40 x 40 Labyrinth with no connections "
+            << "(Only a Room and itself should be reachable):" << std::endl;
+  Labyrinth l_walls( 40, 40, LabyrinthMode::kLarge );
+  LabyrinthDistanceIndex index_walls( &l_walls );
+  CheckAgainstSolver( l_walls, index_walls );
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "________________________________________________"
+            << std::endl
+            << std::endl;
+
+  std::cout << "Finding a distance to a Room outside of the Labyrinth "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    index_small.Distance( Coordinate(0, 0), Coordinate(0, 20) );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Finding the distance to the exit when it has not been set "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    index_walls.DistanceToExit( Coordinate(0, 0) );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Creating an index with 0 landmarks "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    LabyrinthDistanceIndex index_empty( &l_small, 0 );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
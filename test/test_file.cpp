@@ -0,0 +1,366 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ file tests the LabyrinthFile and LabyrinthFileSink class
+ * implementations.
+ *
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+#include "../include/room_properties.hpp"
+#include "../include/room.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/room_row.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_generator.hpp"
+#include "../include/labyrinth_stream.hpp"
+#include "../include/labyrinth_file.hpp"
+
+namespace
+{
+
+// This local function prints whether two Labyrinths have the same size,
+// Rooms, spawns, exit and Treasure.
+void CheckSame( const Labyrinth& l_1, const Labyrinth& l_2 );
+
+// This local function prints whether two Labyrinths have the same size,
+// Rooms, spawns, exit and Treasure.
+void CheckSame( const Labyrinth& l_1, const Labyrinth& l_2 )
+{
+  bool same = l_1.XSize() == l_2.XSize() && l_1.YSize() == l_2.YSize() &&
+              l_1.Mode() == l_2.Mode() &&
+              l_1.GetSpawn1() == l_2.GetSpawn1() &&
+              l_1.GetSpawn2() == l_2.GetSpawn2() &&
+              l_1.ExitSet() == l_2.ExitSet() &&
+              l_1.TreasureSet() == l_2.TreasureSet();
+  if( same && l_1.ExitSet() )
+  {
+    same = l_1.GetExit() == l_2.GetExit() &&
+           l_1.GetExitDirection() == l_2.GetExitDirection();
+  }
+  if( same && l_1.TreasureSet() )
+  {
+    same = l_1.GetTreasure() == l_2.GetTreasure();
+  }
+  for( size_t y = 0; same && y < l_1.YSize(); ++y )
+  {
+    const RoomRow row_1 = l_1.RowAt( y );
+    const RoomRow row_2 = l_2.RowAt( y );
+    for( size_t x = 0; same && x < row_1.size(); ++x )
+    {
+      same = row_1[x].Packed() == row_2[x].Packed();
+    }
+  }
+  std::cout << "  The Labyrinths are " << ( same ? "the same" : "NOT the same" )
+            << "." << std::endl;
+}
+
+// This local function copies the Labyrinth file at source to target,
+// replacing the packed Room at the given Coordinate (in a Labyrinth with
+// the given x size) with the given function of it.
+template <typename F>
+void CopyWithRoom( const char* const source,
+                   const char* const target,
+                   const Coordinate rm,
+                   const size_t x_size,
+                   const F change );
+
+// This local function copies the Labyrinth file at source to target,
+// replacing the packed Room at the given Coordinate (in a Labyrinth with
+// the given x size) with the given function of it.
+template <typename F>
+void CopyWithRoom( const char* const source,
+                   const char* const target,
+                   const Coordinate rm,
+                   const size_t x_size,
+                   const F change )
+{
+  std::ifstream in( source, std::ios::binary );
+  std::string bytes( (std::istreambuf_iterator<char>(in)),
+                     std::istreambuf_iterator<char>() );
+  const size_t offset =
+    LabyrinthFile::kHeaderSize + 2 * ( rm.y * x_size + rm.x );
+  std::uint16_t packed;
+  std::memcpy( &packed, &bytes[offset], sizeof(packed) );
+  packed = change( packed );
+  std::memcpy( &bytes[offset], &packed, sizeof(packed) );
+  std::ofstream out( target, std::ios::binary | std::ios::trunc );
+  out.write( bytes.data(), static_cast<std::streamsize>(bytes.size()) );
+}
+
+// This local function prints the error thrown by loading, then by
+// mapping, the file at the given path, or that none was thrown.
+void TryLoadAndMap( const char* const path );
+
+// This local function prints the error thrown by loading, then by
+// mapping, the file at the given path, or that none was thrown.
+void TryLoadAndMap( const char* const path )
+{
+  try
+  {
+    LabyrinthFile::Load( path );
+    std::cout << "  Load() threw no error." << std::endl;
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << "  " << e.what();
+  }
+  try
+  {
+    LabyrinthFile::Map( path );
+    std::cout << "  Map() threw no error." << std::endl;
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << "  " << e.what();
+  }
+}
+
+}  // Local namespace
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING LABYRINTH_FILE.CPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+
+
+  GeneratorOptions options;
+  options.seed = 42;
+  options.bullets = 4;
+  options.minotaurs = 2;
+  options.mirrors = 2;
+  LabyrinthGenerator generator( options );
+
+  std::cout << "Saving and loading a generated 20 x 20 Labyrinth:"
+            << std::endl;
+  Labyrinth l_small( 20, 20 );
+  generator.Generate( l_small );
+  LabyrinthFile::Save( l_small, "test_file_small.laby" );
+  const Labyrinth l_loaded = LabyrinthFile::Load( "test_file_small.laby" );
+  CheckSame( l_small, l_loaded );
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Mapping the same file:" << std::endl;
+  Labyrinth l_mapped = LabyrinthFile::Map( "test_file_small.laby" );
+  CheckSame( l_small, l_mapped );
+  std::cout << "  The Labyrinth is " << ( l_mapped.Mapped() ? "" : "NOT " )
+            << "mapped, with " << l_mapped.ResidentRooms()
+            << " Rooms with storage (0 expected)." << std::endl;
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Taking the Treasure from the mapped Labyrinth "
+            << "(The file should not change):" << std::endl;
+  const Coordinate treasure = l_mapped.GetTreasure();
+  l_mapped.TakeItem( treasure );
+  std::cout << "  The Labyrinth is " << ( l_mapped.Mapped() ? "" : "NOT " )
+            << "mapped (NOT mapped expected), and the Treasure is "
+            << ( l_mapped.ItemAt(treasure) == Item::kTreasureGone ?
+                 "gone" : "NOT gone" )
+            << "." << std::endl;
+  CheckSame( l_small, LabyrinthFile::Map("test_file_small.laby") );
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Saving, loading and mapping a generated 300 x 200 Labyrinth:"
+            << std::endl;
+  Labyrinth l_large( 300, 200, LabyrinthMode::kLarge );
+  generator.Generate( l_large );
+  LabyrinthFile::Save( l_large, "test_file_large.laby" );
+  CheckSame( l_large, LabyrinthFile::Load("test_file_large.laby") );
+  Labyrinth l_large_mapped = LabyrinthFile::Map( "test_file_large.laby" );
+  CheckSame( l_large, l_large_mapped );
+  if( l_large_mapped.DirectionCheck(Coordinate(0, 100), Direction::kSouth) !=
+      RoomBorder::kRoom )
+  {
+    l_large_mapped.ConnectRooms( Coordinate(0, 100), Coordinate(0, 101) );
+  }
+  else
+  {
+    l_large_mapped.SetInhabitant( Coordinate(0, 100), Inhabitant::kMirror );
+  }
+  std::cout << "  After connecting (0, 100) and (0, 101), Rooms with storage: "
+            << l_large_mapped.ResidentRooms() << " (19200 expected)."
+            << std::endl
+            << "  South of (0, 100) is a "
+            << ( l_large_mapped.DirectionCheck(Coordinate(0, 100),
+                                               Direction::kSouth) ==
+                 RoomBorder::kRoom ? "Room" : "Wall" )
+            << " (Room expected)." << std::endl;
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Loading a large Labyrinth with few changes "
+            << "(Blank bands should not be allocated):" << std::endl;
+  Labyrinth l_sparse( 1000, 1000, LabyrinthMode::kLarge );
+  l_sparse.ConnectRooms( Coordinate(500, 500), Coordinate(501, 500) );
+  l_sparse.SetSpawn1( Coordinate(500, 500) );
+  LabyrinthFile::Save( l_sparse, "test_file_sparse.laby" );
+  const Labyrinth l_sparse_loaded =
+    LabyrinthFile::Load( "test_file_sparse.laby" );
+  CheckSame( l_sparse, l_sparse_loaded );
+  std::cout << "  Rooms with storage: " << l_sparse_loaded.ResidentRooms()
+            << " (64000 expected)." << std::endl;
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Streaming a 2000 x 1500 maze into a file, then mapping it:"
+            << std::endl;
+  LabyrinthStreamGenerator stream( options, 16 );
+  LabyrinthFileSink sink( "test_file_stream.laby" );
+  stream.Generate( 2000, 1500, sink );
+  const Labyrinth l_streamed = LabyrinthFile::Map( "test_file_stream.laby" );
+  size_t openings = 0;
+  for( size_t y = 0; y < l_streamed.YSize(); ++y )
+  {
+    for( const Room& rm : l_streamed.RowAt(y) )
+    {
+      const std::uint8_t open = rm.OpenMask();
+      openings += ( open & 0x1 ) + ( (open >> 1) & 0x1 ) +
+                  ( (open >> 2) & 0x1 ) + ( (open >> 3) & 0x1 );
+    }
+  }
+  std::cout << "  The Labyrinth is " << l_streamed.XSize() << " x "
+            << l_streamed.YSize() << " and has " << openings / 2
+            << " connections (2999999 expected), and the exit is "
+            << ( l_streamed.ExitSet() ? "set" : "NOT set" ) << "." << std::endl;
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "________________________________________________"
+            << std::endl
+            << std::endl;
+
+  std::cout << "Loading a file which does not exist "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    LabyrinthFile::Load( "test_file_missing.laby" );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Mapping a file which is not a Labyrinth file "
+            << "(An error should be thrown):" << std::endl;
+  {
+    std::ofstream text( "test_file_text.laby" );
+    text << "This is not a Labyrinth." << std::endl;
+  }
+  try
+  {
+    LabyrinthFile::Map( "test_file_text.laby" );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Mapping a truncated file (An error should be thrown):"
+            << std::endl;
+  {
+    std::ifstream full( "test_file_small.laby", std::ios::binary );
+    std::ofstream cut( "test_file_cut.laby", std::ios::binary );
+    char bytes[100];
+    full.read( bytes, sizeof(bytes) );
+    cut.write( bytes, sizeof(bytes) );
+  }
+  try
+  {
+    LabyrinthFile::Map( "test_file_cut.laby" );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Loading and mapping a file whose Room (0, 0) has lost its "
+            << "north Wall, which faces the outside (An error should be "
+            << "thrown by each):" << std::endl;
+  CopyWithRoom( "test_file_small.laby", "test_file_bad.laby",
+                Coordinate(0, 0), 20,
+                []( const std::uint16_t packed )
+                {
+                  return static_cast<std::uint16_t>( packed & ~0x1u );
+                } );
+  TryLoadAndMap( "test_file_bad.laby" );
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Loading and mapping a file whose Room (5, 5) has an unused "
+            << "bit set (An error should be thrown by Load() only, as Map() "
+            << "checks only the Rooms on the edge):" << std::endl;
+  CopyWithRoom( "test_file_small.laby", "test_file_bad.laby",
+                Coordinate(5, 5), 20,
+                []( const std::uint16_t packed )
+                {
+                  return static_cast<std::uint16_t>( packed | 0x8000u );
+                } );
+  TryLoadAndMap( "test_file_bad.laby" );
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Loading and mapping a file whose header has an exit, but "
+            << "whose Rooms do not (An error should be thrown by each):"
+            << std::endl;
+  {
+    const unsigned exit_wall =
+      1u << ( static_cast<unsigned>(l_small.GetExitDirection()) - 1 );
+    CopyWithRoom( "test_file_small.laby", "test_file_bad.laby",
+                  l_small.GetExit(), 20,
+                  [exit_wall]( const std::uint16_t packed )
+                  {
+                    return static_cast<std::uint16_t>(
+                      (packed & ~Room::kExitMask) | exit_wall );
+                  } );
+  }
+  TryLoadAndMap( "test_file_bad.laby" );
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Streaming a maze larger than a large Labyrinth into a file "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    LabyrinthFileSink sink_too_big( "test_file_too_big.laby" );
+    stream.Generate( 65537, 1, sink_too_big );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+  for( const char* const path : { "test_file_small.laby",
+                                  "test_file_large.laby",
+                                  "test_file_sparse.laby",
+                                  "test_file_stream.laby",
+                                  "test_file_text.laby",
+                                  "test_file_cut.laby",
+                                  "test_file_bad.laby" } )
+  {
+    std::remove( path );
+  }
+
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
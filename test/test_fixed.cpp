@@ -0,0 +1,235 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ file tests the FixedLabyrinth class template.
+ *
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <exception>
+#include <iostream>
+#include <utility>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/room.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_map.hpp"
+#include "../include/labyrinth_generator.hpp"
+#include "../include/fixed_labyrinth.hpp"
+
+namespace
+{
+
+// This local function returns the number of open Walls of every Room,
+// through the FAST PATH methods of L (a Labyrinth or a FixedLabyrinth).
+template <typename L>
+size_t CountOpenings( const L& l );
+
+// This local function returns true if two Labyrinths have the same Rooms,
+// spawns, exit and Treasure.
+bool SameLabyrinth( const Labyrinth& a, const Labyrinth& b );
+
+// This local function returns the number of open Walls of every Room.
+template <typename L>
+size_t CountOpenings( const L& l )
+{
+  const Direction directions[4] = { Direction::kNorth, Direction::kEast,
+                                    Direction::kSouth, Direction::kWest };
+  size_t openings = 0;
+  for( size_t y = 0; y < l.YSize(); ++y )
+  {
+    for( size_t x = 0; x < l.XSize(); ++x )
+    {
+      for( const Direction d : directions )
+      {
+        openings += l.DirectionCheckUnchecked( Coordinate(x, y), d ) ==
+                    RoomBorder::kRoom;
+      }
+    }
+  }
+  return openings;
+}
+
+// This local function returns true if two Labyrinths have the same Rooms,
+// spawns, exit and Treasure.
+bool SameLabyrinth( const Labyrinth& a, const Labyrinth& b )
+{
+  if( a.XSize() != b.XSize() || a.YSize() != b.YSize() ||
+      !(a.GetSpawn1() == b.GetSpawn1()) ||
+      !(a.GetSpawn2() == b.GetSpawn2()) ||
+      a.ExitSet() != b.ExitSet() || a.TreasureSet() != b.TreasureSet() )
+  {
+    return false;
+  }
+  for( size_t y = 0; y < a.YSize(); ++y )
+  {
+    for( size_t x = 0; x < a.XSize(); ++x )
+    {
+      if( a.RowAt(y)[x].Packed() != b.RowAt(y)[x].Packed() )
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+}  // Local namespace
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING FIXED_LABYRINTH.HPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+
+
+  std::cout << "Comparing the size of an 8 x 8 Labyrinth:" << std::endl;
+  std::cout << "  Labyrinth: " << sizeof( Labyrinth ) << " bytes, and "
+            << 8 * 8 * sizeof( Room ) << " bytes in a separate allocation."
+            << std::endl
+            << "  FixedLabyrinth<8, 8>: "
+            << sizeof( FixedLabyrinth<8, 8> ) << " bytes, and no allocation."
+            << std::endl
+            << "  Sizes known at compile time: "
+            << FixedLabyrinth<8, 8>::kXSize << " x "
+            << FixedLabyrinth<8, 8>::YSize() << "." << std::endl;
+  static_assert( FixedLabyrinth<16, 16>::XSize() == 16,
+                 "The size of a FixedLabyrinth is a constant." );
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Generating the same seed into a FixedLabyrinth<8, 8> and an "
+            << "8 x 8 Labyrinth (They should be identical):" << std::endl;
+  GeneratorOptions options;
+  options.seed = 21;
+  options.bullets = 3;
+  options.minotaurs = 3;
+  options.mirrors = 2;
+  LabyrinthGenerator generator( options );
+  FixedLabyrinth<8, 8> fixed;
+  Labyrinth dynamic( 8, 8 );
+  generator.Generate( fixed );
+  generator.Generate( dynamic );
+  std::cout << "  Identical: " << SameLabyrinth( fixed, dynamic )
+            << " (1 expected)." << std::endl
+            << "  Openings: " << CountOpenings( fixed ) << ", "
+            << CountOpenings( dynamic ) << " (126, 126 expected: 2 for each "
+            << "of the 63 connections of a perfect maze)." << std::endl
+            << "  Mode is LabyrinthMode::kSmall: "
+            << ( fixed.Mode() == LabyrinthMode::kSmall )
+            << ", Rooms resident: " << fixed.ResidentRooms()
+            << " (1, 64 expected)." << std::endl;
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Checking Rooms outside the FixedLabyrinth:" << std::endl;
+  {
+    RoomBorder rb = RoomBorder::kWall;
+    const Labyrinth& base = fixed;
+    std::cout << "  TryDirectionCheck(8, 0) is out of bounds: "
+              << ( fixed.TryDirectionCheck(Coordinate(8, 0), Direction::kNorth,
+                                           rb) ==
+                   LabyrinthStatus::kOutOfBounds )
+              << ", through a Labyrinth&: "
+              << ( base.TryDirectionCheck(Coordinate(8, 0), Direction::kNorth,
+                                          rb) ==
+                   LabyrinthStatus::kOutOfBounds )
+              << " (1, 1 expected)." << std::endl;
+  }
+  std::cout << "DirectionCheck(0, 8) (An error should be thrown):"
+            << std::endl;
+  try
+  {
+    fixed.DirectionCheck( Coordinate(0, 8), Direction::kNorth );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "________________________________________________"
+            << std::endl
+            << std::endl;
+
+  std::cout << "Building a FixedLabyrinth<3, 2> by hand and displaying its "
+            << "map:" << std::endl;
+  {
+    FixedLabyrinth<3, 2> small;
+    small.ConnectRooms( Coordinate(0, 0), Coordinate(1, 0) );
+    small.ConnectRooms( Coordinate(1, 0), Coordinate(2, 0) );
+    small.ConnectRooms( Coordinate(2, 0), Coordinate(2, 1) );
+    small.ConnectRooms( Coordinate(2, 1), Coordinate(1, 1) );
+    small.ConnectRooms( Coordinate(1, 1), Coordinate(0, 1) );
+    small.SetInhabitant( Coordinate(1, 1), Inhabitant::kMinotaur );
+    small.SetItem( Coordinate(0, 1), Item::kTreasure );
+    small.SetExit( Coordinate(0, 0), Direction::kWest );
+    LabyrinthMap m( &small, small.XSize(), small.YSize() );
+    m.Display();
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Moving the FixedLabyrinth<8, 8> into a Labyrinth and "
+            << "changing the Labyrinth (The FixedLabyrinth should keep its "
+            << "Rooms):" << std::endl;
+  {
+    Labyrinth moved( std::move(fixed) );
+    const bool same = SameLabyrinth( moved, dynamic );
+    const Coordinate treasure = moved.GetTreasure();
+    moved.TakeItem( treasure );
+    std::cout << "  The Labyrinth is identical: " << same
+              << ", Treasure taken from it: " << !moved.TreasureSet()
+              << ", Treasure still in the FixedLabyrinth: "
+              << ( fixed.ItemAtUnchecked(treasure) == Item::kTreasure )
+              << " (1, 1, 1 expected)." << std::endl;
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Cloning a FixedLabyrinth<8, 8>:" << std::endl;
+  {
+    FixedLabyrinth<8, 8> original;
+    generator.Generate( original );
+    const Labyrinth clone = original.Clone();
+    std::cout << "  Identical: " << SameLabyrinth( original, clone )
+              << " (1 expected)." << std::endl;
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "________________________________________________"
+            << std::endl
+            << std::endl;
+
+  std::cout << "Generating 10000 FixedLabyrinth<8, 8> boards in a "
+            << "std::deque:" << std::endl;
+  {
+    std::deque< FixedLabyrinth<8, 8> > boards;
+    size_t openings = 0;
+    for( std::uint64_t i = 0; i < 10000; ++i )
+    {
+      boards.emplace_back();
+      generator.SetSeed( i );
+      generator.Generate( boards.back() );
+      openings += CountOpenings( boards.back() );
+    }
+    std::cout << "  Boards: " << boards.size() << ", openings: " << openings
+              << " (10000, 1260000 expected)." << std::endl;
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,305 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ file tests the LabyrinthGenerator class implementation.
+ *
+ */
+
+#include <chrono>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/room_row.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_map.hpp"
+#include "../include/labyrinth_generator.hpp"
+#include "../include/work_stealing_pool.hpp"
+
+namespace
+{
+
+// This local function returns the given algorithm as a string.
+std::string AlgorithmPrint( GeneratorAlgorithm a );
+
+// This local function prints whether the given Labyrinth is a perfect maze,
+// i.e. has exactly (Rooms - 1) connections which reach every Room.
+void CheckPerfect( const Labyrinth& l );
+
+// This local function returns the given algorithm as a string.
+std::string AlgorithmPrint( GeneratorAlgorithm a )
+{
+  switch( a )
+  {
+    case( GeneratorAlgorithm::kRecursiveBacktracker ):
+      return "recursive backtracker";
+    case( GeneratorAlgorithm::kKruskal ):
+      return "Kruskal";
+    case( GeneratorAlgorithm::kWilson ):
+      return "Wilson";
+    case( GeneratorAlgorithm::kEller ):
+      return "Eller";
+  }
+  return "Error: AlgorithmPrint() was given an algorithm which could not be "\
+         "detected.";
+}
+
+// This local function prints whether the given Labyrinth is a perfect maze,
+// i.e. has exactly (Rooms - 1) connections which reach every Room.
+void CheckPerfect( const Labyrinth& l )
+{
+  const size_t x_size = l.XSize();
+  const size_t rooms = x_size * l.YSize();
+
+  size_t connections = 0;
+  for( size_t y = 0; y < l.YSize(); ++y )
+  {
+    for( const Room& rm : l.RowAt(y) )
+    {
+      if( rm.DirectionCheck(Direction::kEast) == RoomBorder::kRoom )
+      {
+        ++connections;
+      }
+      if( rm.DirectionCheck(Direction::kSouth) == RoomBorder::kRoom )
+      {
+        ++connections;
+      }
+    }
+  }
+
+  std::vector<bool> seen( rooms, false );
+  std::vector<size_t> queue( 1, 0 );
+  seen[0] = true;
+  for( size_t head = 0; head < queue.size(); ++head )
+  {
+    const Coordinate c( queue[head] % x_size, queue[head] / x_size );
+    const Direction directions[4] = { Direction::kNorth, Direction::kEast,
+                                      Direction::kSouth, Direction::kWest };
+    const long offsets[4] = { -static_cast<long>(x_size), 1,
+                              static_cast<long>(x_size), -1 };
+    for( int k = 0; k < 4; ++k )
+    {
+      if( l.DirectionCheck(c, directions[k]) == RoomBorder::kRoom )
+      {
+        const size_t next = queue[head] + offsets[k];
+        if( !seen[next] )
+        {
+          seen[next] = true;
+          queue.push_back( next );
+        }
+      }
+    }
+  }
+
+  std::cout << "  " << connections << " connections, "
+            << queue.size() << " of " << rooms << " Rooms reachable: "
+            << ( connections == rooms - 1 && queue.size() == rooms ?
+                 "perfect maze" : "NOT a perfect maze" )
+            << "." << std::endl;
+}
+
+}  // Local namespace
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING LABYRINTH_GENERATOR.CPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+
+
+  const GeneratorAlgorithm algorithms[4] =
+  {
+    GeneratorAlgorithm::kRecursiveBacktracker,
+    GeneratorAlgorithm::kKruskal,
+    GeneratorAlgorithm::kWilson,
+    GeneratorAlgorithm::kEller,
+  };
+
+  for( const GeneratorAlgorithm a : algorithms )
+  {
+    std::cout << "Generating a 20 x 20 Labyrinth with the "
+              << AlgorithmPrint( a ) << " algorithm:" << std::endl;
+
+    GeneratorOptions options;
+    options.algorithm = a;
+    options.seed = 42;
+    options.bullets = 5;
+    options.minotaurs = 3;
+    options.mirrors = 2;
+    LabyrinthGenerator generator( options );
+
+    Labyrinth l( 20, 20 );
+    try
+    {
+      generator.Generate( l );
+    }
+    catch( const std::exception& e )
+    {
+      std::cout << e.what();
+    }
+    CheckPerfect( l );
+
+    Labyrinth l_again( 20, 20 );
+    generator.Generate( l_again );
+    bool same = true;
+    for( size_t y = 0; y < 20; ++y )
+    {
+      for( size_t x = 0; x < 20; ++x )
+      {
+        same = same && ( l.RowAt(y)[x].Packed() ==
+                         l_again.RowAt(y)[x].Packed() );
+      }
+    }
+    std::cout << "  Generating again with the same seed gives "
+              << ( same ? "the same" : "a DIFFERENT" ) << " maze."
+              << std::endl << std::endl;
+  }
+
+  std::cout << "________________________________________________"
+            << std::endl
+            << std::endl;
+
+  std::cout << "Generating and displaying an 8 x 5 Labyrinth with the "
+            << "Eller algorithm:" << std::endl;
+  GeneratorOptions options;
+  options.algorithm = GeneratorAlgorithm::kEller;
+  options.seed = 7;
+  options.bullets = 2;
+  options.minotaurs = 2;
+  options.mirrors = 1;
+  LabyrinthGenerator generator( options );
+  Labyrinth l_shown( 8, 5 );
+  generator.Generate( l_shown );
+  LabyrinthMap l_shown_map( &l_shown, 8, 5 );
+  l_shown_map.Display();
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Generating a 600 x 400 LabyrinthMode::kLarge Labyrinth "
+            << "under a map rebuilt on the calling thread and a map rebuilt "
+            << "on a pool of 4 workers:" << std::endl;
+  {
+    Labyrinth l_rebuilt( 600, 400, LabyrinthMode::kLarge );
+    LabyrinthMap serial_map( &l_rebuilt, 600, 400 );
+    LabyrinthMap pool_map( &l_rebuilt, 600, 400 );
+    WorkStealingPool pool( 4 );
+    pool_map.SetRebuildPool( &pool );
+
+    GeneratorOptions rebuilt_options;
+    rebuilt_options.seed = 28;
+    rebuilt_options.minotaurs = 50;
+    rebuilt_options.mirrors = 50;
+    LabyrinthGenerator( rebuilt_options ).Generate( l_rebuilt );
+
+    // A small window costs little more than the rebuild itself.
+    const Coordinate centre( 300, 200 );
+    auto start = std::chrono::steady_clock::now();
+    serial_map.RenderWindow( centre, 80, 24 );
+    const auto serial_time = std::chrono::steady_clock::now() - start;
+    start = std::chrono::steady_clock::now();
+    pool_map.RenderWindow( centre, 80, 24 );
+    const auto pool_time = std::chrono::steady_clock::now() - start;
+
+    std::cout << "  The maps are "
+              << ( serial_map.Render() == pool_map.Render() ?
+                   "the same" : "NOT the same" )
+              << " (the same expected)." << std::endl
+              << "  Rebuilt in "
+              << std::chrono::duration_cast<std::chrono::microseconds>(
+                   serial_time ).count()
+              << " us on the calling thread and "
+              << std::chrono::duration_cast<std::chrono::microseconds>(
+                   pool_time ).count()
+              << " us on the pool (varies with the number of cores)."
+              << std::endl;
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "________________________________________________"
+            << std::endl
+            << std::endl;
+
+  std::cout << "Generating a 2 x 2 Labyrinth with 10 bullets "
+            << "(An error should be thrown):" << std::endl;
+  options.bullets = 10;
+  LabyrinthGenerator generator_full( options );
+  Labyrinth l_full( 2, 2 );
+  try
+  {
+    generator_full.Generate( l_full );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Generating a 3 x 3 Labyrinth which already has an exit and "
+            << "a checkpoint (An error should be thrown, and the Labyrinth "
+            << "should be unchanged):" << std::endl;
+  {
+    options.bullets = 0;
+    LabyrinthGenerator generator_exit( options );
+    Labyrinth l_exit( 3, 3 );
+    l_exit.ConnectRooms( Coordinate(0, 0), Coordinate(1, 0) );
+    l_exit.SetExit( Coordinate(2, 2), Direction::kSouth );
+    const size_t checkpoint = l_exit.Checkpoint();
+    try
+    {
+      generator_exit.Generate( l_exit );
+    }
+    catch( const std::exception& e )
+    {
+      std::cout << e.what();
+    }
+    const bool walls_kept =
+      l_exit.DirectionCheck( Coordinate(0, 0), Direction::kEast ) ==
+        RoomBorder::kRoom &&
+      l_exit.DirectionCheck( Coordinate(1, 1), Direction::kNorth ) ==
+        RoomBorder::kWall &&
+      l_exit.DirectionCheck( Coordinate(1, 1), Direction::kWest ) ==
+        RoomBorder::kWall;
+    bool checkpoint_kept = true;
+    try
+    {
+      l_exit.Rollback( checkpoint );
+    }
+    catch( const std::exception& )
+    {
+      checkpoint_kept = false;
+    }
+    std::cout << "  Walls unchanged: " << walls_kept
+              << ", checkpoint kept: " << checkpoint_kept
+              << " (1, 1 expected)." << std::endl;
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Generating a large 3000 x 3000 Labyrinth with the Eller "
+            << "algorithm:" << std::endl;
+  options.bullets = 100;
+  options.minotaurs = 100;
+  options.mirrors = 100;
+  LabyrinthGenerator generator_large( options );
+  Labyrinth l_large( 3000, 3000, LabyrinthMode::kLarge );
+  generator_large.Generate( l_large );
+  CheckPerfect( l_large );
+
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
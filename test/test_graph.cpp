@@ -0,0 +1,227 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ file tests the LabyrinthGraph class implementation.
+ *
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <exception>
+#include <iostream>
+#include <string>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_generator.hpp"
+#include "../include/labyrinth_graph.hpp"
+
+namespace
+{
+
+// This local function returns the given Direction as a string.
+std::string DirectionPrint( const Direction d );
+
+// This local function returns true if the neighbours of every Room in the
+// graph are exactly the Rooms which DirectionCheck() reports as connected.
+bool MatchesLabyrinth( const Labyrinth& l, const LabyrinthGraph& g );
+
+// This local function returns the given Direction as a string.
+std::string DirectionPrint( const Direction d )
+{
+  switch( d )
+  {
+    case Direction::kNorth:
+      return "north";
+    case Direction::kEast:
+      return "east";
+    case Direction::kSouth:
+      return "south";
+    case Direction::kWest:
+      return "west";
+    default:
+      return "none";
+  }
+}
+
+// This local function returns true if the neighbours of every Room in the
+// graph are exactly the connected Rooms.
+bool MatchesLabyrinth( const Labyrinth& l, const LabyrinthGraph& g )
+{
+  const Direction directions[4] = { Direction::kNorth, Direction::kEast,
+                                    Direction::kSouth, Direction::kWest };
+  for( std::uint32_t i = 0; i < g.Rooms(); ++i )
+  {
+    const Coordinate rm = g.ToCoordinate( i );
+    const NeighbourRange n = g.Neighbours( i );
+    size_t k = 0;
+    for( const Direction d : directions )
+    {
+      if( l.DirectionCheck(rm, d) != RoomBorder::kRoom )
+      {
+        continue;
+      }
+      Coordinate next = rm;
+      switch( d )
+      {
+        case Direction::kNorth: --next.y; break;
+        case Direction::kEast:  ++next.x; break;
+        case Direction::kSouth: ++next.y; break;
+        default:                --next.x; break;
+      }
+      if( k >= n.size() || n.DirectionOf(k) != d ||
+          n[k] != g.IndexOf(next) )
+      {
+        return false;
+      }
+      ++k;
+    }
+    if( k != n.size() || g.Degree(i) != k )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // Local namespace
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING LABYRINTH_GRAPH.CPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+
+
+  std::cout << "Building the graph of a 3 x 2 Labyrinth connected by hand:"
+            << std::endl;
+  Labyrinth small( 3, 2 );
+  small.ConnectRooms( Coordinate(0, 0), Coordinate(1, 0) );
+  small.ConnectRooms( Coordinate(1, 0), Coordinate(1, 1) );
+  small.ConnectRooms( Coordinate(1, 1), Coordinate(2, 1) );
+  small.SetExit( Coordinate(2, 0), Direction::kEast );
+  LabyrinthGraph small_graph( &small );
+  for( std::uint32_t i = 0; i < small_graph.Rooms(); ++i )
+  {
+    const Coordinate rm = small_graph.ToCoordinate( i );
+    const NeighbourRange n = small_graph.Neighbours( i );
+    std::cout << "  Room " << i << " (" << rm.x << ", " << rm.y << "):";
+    for( size_t k = 0; k < n.size(); ++k )
+    {
+      std::cout << " " << DirectionPrint( n.DirectionOf(k) ) << " to "
+                << n[k] << ";";
+    }
+    std::cout << std::endl;
+  }
+  std::cout << "  Connections: " << small_graph.Connections()
+            << " (3 expected: Room 2 has only the exit, which is not a "
+            << "neighbour)." << std::endl;
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Connecting Rooms 2 and 5 and refreshing the graph:"
+            << std::endl;
+  std::cout << "  Stale before: " << small_graph.Stale();
+  small.ConnectRooms( Coordinate(2, 1), Coordinate(2, 0) );
+  std::cout << ", after connecting: " << small_graph.Stale()
+            << " (0, 1 expected)." << std::endl;
+  std::cout << "  Rebuilt by Refresh(): " << small_graph.Refresh()
+            << ", by a second Refresh(): " << small_graph.Refresh()
+            << " (1, 0 expected)." << std::endl
+            << "  Degree of Room 2: " << small_graph.Degree( 2 )
+            << ", connections: " << small_graph.Connections()
+            << " (1, 4 expected)." << std::endl;
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "________________________________________________"
+            << std::endl
+            << std::endl;
+
+  std::cout << "Generating Labyrinths with each algorithm and comparing "
+            << "their graphs with DirectionCheck():" << std::endl;
+  {
+    const GeneratorAlgorithm algorithms[4] =
+      { GeneratorAlgorithm::kRecursiveBacktracker,
+        GeneratorAlgorithm::kKruskal,
+        GeneratorAlgorithm::kWilson,
+        GeneratorAlgorithm::kEller };
+    const char* const names[4] =
+      { "Recursive backtracker", "Kruskal", "Wilson", "Eller" };
+    for( unsigned a = 0; a < 4; ++a )
+    {
+      GeneratorOptions options;
+      options.algorithm = algorithms[a];
+      options.seed = 23;
+      LabyrinthGenerator generator( options );
+      Labyrinth l( 20, 15 );
+      generator.Generate( l );
+      const LabyrinthGraph g( &l );
+      std::cout << "  " << names[a] << ": matches: "
+                << MatchesLabyrinth( l, g ) << ", connections: "
+                << g.Connections() << " (1, 299 expected)." << std::endl;
+    }
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Generating a 300 x 200 LabyrinthMode::kLarge Labyrinth and "
+            << "comparing its graph:" << std::endl;
+  {
+    GeneratorOptions options;
+    options.seed = 5;
+    LabyrinthGenerator generator( options );
+    Labyrinth l( 300, 200, LabyrinthMode::kLarge );
+    LabyrinthGraph g( &l );
+    std::cout << "  Connections before generating: " << g.Connections()
+              << " (0 expected)." << std::endl;
+    generator.Generate( l );
+    g.Refresh();
+    std::cout << "  Matches: " << MatchesLabyrinth( l, g )
+              << ", connections: " << g.Connections()
+              << " (1, 59999 expected)." << std::endl;
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "________________________________________________"
+            << std::endl
+            << std::endl;
+
+  std::cout << "Creating a graph of a null Labyrinth "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    LabyrinthGraph g( nullptr );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Finding the index of Room (3, 0) in a 3 x 2 Labyrinth "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    small_graph.IndexOf( Coordinate(3, 0) );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,352 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ file tests the WorkStealingPool and GameHost class
+ * implementations.
+ *
+ */
+
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_generator.hpp"
+#include "../include/work_stealing_pool.hpp"
+#include "../include/game_host.hpp"
+
+namespace
+{
+
+// This local class walks a single player through the Labyrinth, moving
+// only where there is a Room in the given Direction.
+class WalkingHandler : public GameSessionHandler
+{
+  public:
+
+    void Turn( Labyrinth& l, const std::vector<GameMove>& moves )
+    {
+      for( const GameMove& m : moves )
+      {
+        ++moves_;
+        RoomBorder rb = RoomBorder::kWall;
+        if( m.direction == Direction::kNone ||
+            l.TryDirectionCheck(location_, m.direction, rb) !=
+              LabyrinthStatus::kOk ||
+            rb != RoomBorder::kRoom )
+        {
+          continue;
+        }
+        switch( m.direction )
+        {
+          case Direction::kNorth: --location_.y; break;
+          case Direction::kEast:  ++location_.x; break;
+          case Direction::kSouth: ++location_.y; break;
+          default:                --location_.x; break;
+        }
+        ++steps_;
+      }
+    }
+
+    size_t moves_ = 0;
+    size_t steps_ = 0;
+    Coordinate location_;
+};
+
+// This local class throws on every turn.
+class ThrowingHandler : public GameSessionHandler
+{
+  public:
+
+    void Turn( Labyrinth&, const std::vector<GameMove>& )
+    {
+      throw std::runtime_error( "Error: Turn() was played by a handler "\
+        "which always throws.\n" );
+    }
+};
+
+// This local class submits one move to its own session from each turn,
+// which should be played in the next tick rather than the current one.
+class ResubmittingHandler : public GameSessionHandler
+{
+  public:
+
+    ResubmittingHandler( GameHost* const host ) :
+      host_(host)
+    {
+    }
+
+    void Turn( Labyrinth&, const std::vector<GameMove>& moves )
+    {
+      moves_ += moves.size();
+      host_->SubmitMove( session_, GameMove() );
+    }
+
+    GameHost* const host_;
+    size_t session_ = 0;
+    size_t moves_ = 0;
+};
+
+}  // Local namespace
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING GAME_HOST.CPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+
+
+  std::cout << "Running 10000 tasks, all queued on worker 0 of 4:"
+            << std::endl;
+  WorkStealingPool pool( 4 );
+  std::atomic<size_t> sum( 0 );
+  for( size_t i = 1; i <= 10000; ++i )
+  {
+    pool.Submit( [&sum, i]( const size_t )
+                 {
+                   sum.fetch_add( i );
+                 },
+                 0 );
+  }
+  pool.Wait();
+  std::cout << "  Sum: " << sum.load() << " (50005000 expected)." << std::endl;
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Running 64 slow tasks, all queued on worker 0 "
+            << "(Other workers should steal some):" << std::endl;
+  std::atomic<size_t> elsewhere( 0 );
+  for( size_t i = 0; i < 64; ++i )
+  {
+    pool.Submit( [&elsewhere]( const size_t worker )
+                 {
+                   std::this_thread::sleep_for(
+                     std::chrono::milliseconds(1) );
+                   if( worker != 0 )
+                   {
+                     elsewhere.fetch_add( 1 );
+                   }
+                 },
+                 0 );
+  }
+  pool.Wait();
+  std::cout << "  Tasks were " << ( elsewhere.load() > 0 ? "" : "NOT " )
+            << "run by other workers, and the pool "
+            << ( pool.Steals() > 0 ? "counted" : "did NOT count" )
+            << " the steals." << std::endl;
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Hosting 1000 generated 10 x 10 sessions on 4 workers, with "
+            << "moves submitted from 4 threads:" << std::endl;
+  GameHost host( 4 );
+  GeneratorOptions options;
+  LabyrinthGenerator generator( options );
+  std::vector<WalkingHandler*> handlers;
+  for( size_t i = 0; i < 1000; ++i )
+  {
+    generator.SetSeed( i );
+    Labyrinth l( 10, 10 );
+    generator.Generate( l );
+    std::unique_ptr<WalkingHandler> handler =
+      std::make_unique<WalkingHandler>();
+    handler->location_ = l.GetSpawn1();
+    handlers.push_back( handler.get() );
+    host.CreateSession( std::move(l), std::move(handler) );
+  }
+
+  const Direction directions[4] = { Direction::kNorth, Direction::kEast,
+                                    Direction::kSouth, Direction::kWest };
+  std::vector<std::thread> clients;
+  for( size_t t = 0; t < 4; ++t )
+  {
+    clients.emplace_back( [&host, &directions, t]()
+    {
+      for( size_t i = t; i < 1000; i += 4 )
+      {
+        for( size_t m = 0; m < 25; ++m )
+        {
+          GameMove move;
+          move.direction = directions[(i + m) % 4];
+          host.SubmitMove( i, move );
+        }
+      }
+    } );
+  }
+  for( std::thread& c : clients )
+  {
+    c.join();
+  }
+
+  const size_t turns = host.Tick();
+  size_t moves = 0;
+  size_t steps = 0;
+  for( const WalkingHandler* const h : handlers )
+  {
+    moves += h->moves_;
+    steps += h->steps_;
+  }
+  const GameHostStats stats = host.Stats();
+  std::cout << "  Turns in the tick: " << turns << " (1000 expected)."
+            << std::endl
+            << "  Moves played: " << moves << " (25000 expected), of which "
+            << ( steps > 0 && steps <= moves ? "some" : "an invalid number" )
+            << " moved to another Room." << std::endl
+            << "  Counters: " << stats.sessions << " sessions, "
+            << stats.ticks << " tick, " << stats.turns << " turns, "
+            << stats.moves << " moves (1000, 1, 1000, 25000 expected)."
+            << std::endl
+            << "  Turn times are "
+            << ( stats.max_turn_time <= stats.turn_time &&
+                 stats.turn_time > 0 ? "consistent" : "NOT consistent" )
+            << "." << std::endl;
+  std::cout << "  A tick without moves played " << host.Tick()
+            << " turns (0 expected)." << std::endl;
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Closing session 7 and creating another "
+            << "(Its identifier should be reused):" << std::endl;
+  host.CloseSession( 7 );
+  std::cout << "  New session: "
+            << host.CreateSession( Labyrinth(3, 3),
+                                   std::make_unique<WalkingHandler>() )
+            << " (7 expected)." << std::endl;
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Playing 3 ticks of a session whose handler submits a move "
+            << "to it from each turn (Each should be played in the next "
+            << "tick):" << std::endl;
+  {
+    std::unique_ptr<ResubmittingHandler> handler =
+      std::make_unique<ResubmittingHandler>( &host );
+    ResubmittingHandler* const resubmitting = handler.get();
+    resubmitting->session_ =
+      host.CreateSession( Labyrinth(3, 3), std::move(handler) );
+    host.SubmitMove( resubmitting->session_, GameMove() );
+    size_t ticked = 0;
+    for( size_t i = 0; i < 3; ++i )
+    {
+      ticked += host.Tick();
+    }
+    std::cout << "  Turns: " << ticked << ", moves played: "
+              << resubmitting->moves_ << " (3, 3 expected)." << std::endl;
+    host.CloseSession( resubmitting->session_ );
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Creating 2000 sessions and closing half of them while "
+            << "another thread submits moves to every identifier up to "
+            << "3000 (Moves to closed sessions should be refused):"
+            << std::endl;
+  {
+    std::atomic<bool> done( false );
+    std::atomic<size_t> submitted( 0 );
+    std::thread client( [&host, &done, &submitted]()
+    {
+      do
+      {
+        for( size_t i = 0; i < 3000; ++i )
+        {
+          try
+          {
+            host.SubmitMove( i, GameMove() );
+            submitted.fetch_add( 1 );
+          }
+          catch( const std::invalid_argument& )
+          {
+          }
+        }
+      } while( !done.load() );
+    } );
+    std::vector<size_t> created;
+    for( size_t i = 0; i < 2000; ++i )
+    {
+      created.push_back(
+        host.CreateSession( Labyrinth(3, 3),
+                            std::make_unique<WalkingHandler>() ) );
+      if( i % 2 == 1 )
+      {
+        host.CloseSession( created[i - 1] );
+      }
+    }
+    done.store( true );
+    client.join();
+    host.Tick();
+    for( size_t i = 1; i < created.size(); i += 2 )
+    {
+      host.CloseSession( created[i] );
+    }
+    std::cout << "  Moves were " << ( submitted.load() > 0 ? "" : "NOT " )
+              << "submitted, and the host has " << host.Stats().sessions
+              << " sessions (1000 expected)." << std::endl;
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "________________________________________________"
+            << std::endl
+            << std::endl;
+
+  std::cout << "Submitting a move to a session which does not exist "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    host.SubmitMove( 5000, GameMove() );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Creating a session with a null handler "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    host.CreateSession( Labyrinth(3, 3), nullptr );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Playing a tick with a handler which throws "
+            << "(An error should be thrown):" << std::endl;
+  const size_t throwing =
+    host.CreateSession( Labyrinth(3, 3), std::make_unique<ThrowingHandler>() );
+  host.SubmitMove( throwing, GameMove() );
+  host.SubmitMove( 0, GameMove() );
+  try
+  {
+    host.Tick();
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "  The other session's move was "
+            << ( handlers[0]->moves_ == 26 ? "" : "NOT " )
+            << "played." << std::endl;
+  std::cout << "Done." << std::endl << std::endl;
+
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
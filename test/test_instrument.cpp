@@ -0,0 +1,259 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ file tests the LabyrinthInstrument class implementation. It is
+ * compiled with LABYRINTH_INSTRUMENT defined.
+ *
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <exception>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_map.hpp"
+#include "../include/labyrinth_generator.hpp"
+#include "../include/labyrinth_instrument.hpp"
+
+namespace
+{
+
+// This local function returns the totals of one operation.
+InstrumentOpStats OpStats( const InstrumentOp op );
+
+// This local function returns the total of one counter.
+std::uint64_t CounterTotal( const InstrumentCounter counter );
+
+// This local function prints the totals of every operation and counter.
+void PrintSnapshot( const InstrumentSnapshot& s );
+
+// This local function returns the totals of one operation.
+InstrumentOpStats OpStats( const InstrumentOp op )
+{
+  return LabyrinthInstrument::Snapshot().ops[static_cast<size_t>(op)];
+}
+
+// This local function returns the total of one counter.
+std::uint64_t CounterTotal( const InstrumentCounter counter )
+{
+  return LabyrinthInstrument::Snapshot().counters[
+    static_cast<size_t>(counter)];
+}
+
+// This local function prints the totals of every operation and counter.
+void PrintSnapshot( const InstrumentSnapshot& s )
+{
+  for( size_t i = 0; i < kInstrumentOps; ++i )
+  {
+    const InstrumentOpStats& op = s.ops[i];
+    std::uint64_t histogram_calls = 0;
+    for( const std::uint64_t b : op.histogram )
+    {
+      histogram_calls += b;
+    }
+    std::cout << "  "
+              << LabyrinthInstrument::Name( static_cast<InstrumentOp>(i) )
+              << ": " << op.calls << " calls, " << op.errors << " errors, "
+              << op.total_time << " ns, " << histogram_calls
+              << " in the histogram." << std::endl;
+  }
+  for( size_t c = 0; c < kInstrumentCounters; ++c )
+  {
+    std::cout << "  " << LabyrinthInstrument::Name(
+                           static_cast<InstrumentCounter>(c) )
+              << ": " << s.counters[c] << std::endl;
+  }
+}
+
+}  // Local namespace
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING LABYRINTH_INSTRUMENT.CPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+
+
+  std::cout << "Checking that instrumentation is enabled "
+            << "(1 expected): " << LabyrinthInstrument::Enabled()
+            << std::endl;
+  std::cout << "Taking a snapshot before anything is counted "
+            << "(Every total should be 0):" << std::endl;
+  PrintSnapshot( LabyrinthInstrument::Snapshot() );
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Connecting the Rooms of a 3 x 2 Labyrinth:" << std::endl;
+  Labyrinth l( 3, 2 );
+  l.ConnectRooms( Coordinate(0, 0), Coordinate(1, 0) );
+  l.ConnectRooms( Coordinate(1, 0), Coordinate(2, 0) );
+  l.ConnectRooms( Coordinate(0, 0), Coordinate(0, 1) );
+  l.ConnectRooms( Coordinate(0, 1), Coordinate(1, 1) );
+  l.ConnectRooms( Coordinate(1, 1), Coordinate(2, 1) );
+  std::cout << "  ConnectRooms calls: "
+            << OpStats( InstrumentOp::kConnectRooms ).calls
+            << " (5 expected)." << std::endl;
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Connecting Rooms which are already connected and outside "
+            << "the Labyrinth (Each should be counted as an error):"
+            << std::endl;
+  try
+  {
+    l.ConnectRooms( Coordinate(0, 0), Coordinate(1, 0) );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << "  " << e.what();
+  }
+  try
+  {
+    l.ConnectRooms( Coordinate(2, 1), Coordinate(3, 1) );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << "  " << e.what();
+  }
+  const InstrumentOpStats connect = OpStats( InstrumentOp::kConnectRooms );
+  std::cout << "  ConnectRooms calls: " << connect.calls << ", errors: "
+            << connect.errors << " (7, 2 expected)." << std::endl;
+  std::cout << "  Bounds failures: "
+            << CounterTotal( InstrumentCounter::kBoundsFailures )
+            << " (At least 1 expected)." << std::endl;
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Checking 1000 Directions, setting the exit and taking an "
+            << "Item:" << std::endl;
+  for( size_t i = 0; i < 1000; ++i )
+  {
+    l.DirectionCheck( Coordinate(i % 3, i % 2), Direction::kEast );
+  }
+  l.SetExit( Coordinate(2, 1), Direction::kSouth );
+  l.SetItem( Coordinate(1, 1), Item::kBullet );
+  l.TakeItem( Coordinate(1, 1) );
+  std::cout << "  DirectionCheck calls: "
+            << OpStats( InstrumentOp::kDirectionCheck ).calls
+            << ", SetExit calls: " << OpStats( InstrumentOp::kSetExit ).calls
+            << ", TakeItem calls: " << OpStats( InstrumentOp::kTakeItem ).calls
+            << " (1000, 1, 1 expected)." << std::endl;
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "________________________________________________"
+            << std::endl
+            << std::endl;
+
+  std::cout << "Rendering a map, changing one Room and rendering it again:"
+            << std::endl;
+  {
+    LabyrinthMap m( &l, 3, 2 );
+    const size_t bytes = m.Render().size();
+    const std::uint64_t rebuilds =
+      CounterTotal( InstrumentCounter::kMapRebuilds );
+    l.SetInhabitant( Coordinate(2, 0), Inhabitant::kMinotaur );
+    m.Render();
+    const InstrumentSnapshot s = LabyrinthInstrument::Snapshot();
+    const InstrumentOpStats& display =
+      s.ops[static_cast<size_t>( InstrumentOp::kDisplay )];
+    std::cout << "  Display calls: " << display.calls << " (2 expected)."
+              << std::endl
+              << "  Map rebuilds after the change: "
+              << s.counters[static_cast<size_t>(
+                   InstrumentCounter::kMapRebuilds )] - rebuilds
+              << " (0 expected)." << std::endl
+              << "  Rooms redrawn: "
+              << s.counters[static_cast<size_t>(
+                   InstrumentCounter::kRoomsRedrawn )]
+              << " (1 expected)." << std::endl
+              << "  Bytes rendered: "
+              << s.counters[static_cast<size_t>(
+                   InstrumentCounter::kRenderBytes )]
+              << " (" << 2 * bytes << " expected)." << std::endl
+              << "  UpdateBorders and UpdateRooms calls are equal: "
+              << ( s.ops[static_cast<size_t>(
+                     InstrumentOp::kUpdateBorders )].calls ==
+                   s.ops[static_cast<size_t>(
+                     InstrumentOp::kUpdateRooms )].calls )
+              << " (1 expected)." << std::endl;
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Generating a Labyrinth under a map and rendering it "
+            << "(The map should be rebuilt):" << std::endl;
+  {
+    Labyrinth g( 10, 10 );
+    LabyrinthMap m( &g, 10, 10 );
+    const std::uint64_t rebuilds =
+      CounterTotal( InstrumentCounter::kMapRebuilds );
+    GeneratorOptions options;
+    LabyrinthGenerator generator( options );
+    generator.Generate( g );
+    m.Render();
+    std::cout << "  Map rebuilds: "
+              << CounterTotal( InstrumentCounter::kMapRebuilds ) - rebuilds
+              << " (1 expected)." << std::endl;
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "________________________________________________"
+            << std::endl
+            << std::endl;
+
+  std::cout << "Generating 20 x 20 Labyrinths on 4 threads, 10 on each:"
+            << std::endl;
+  const std::uint64_t exits_before = OpStats( InstrumentOp::kSetExit ).calls;
+  {
+    std::vector<std::thread> threads;
+    for( unsigned t = 0; t < 4; ++t )
+    {
+      threads.emplace_back( [t]()
+      {
+        GeneratorOptions options;
+        LabyrinthGenerator generator( options );
+        for( unsigned i = 0; i < 10; ++i )
+        {
+          generator.SetSeed( t * 10 + i );
+          Labyrinth g( 20, 20 );
+          generator.Generate( g );
+        }
+      } );
+    }
+    for( std::thread& thread : threads )
+    {
+      thread.join();
+    }
+  }
+  const InstrumentSnapshot s = LabyrinthInstrument::Snapshot();
+  std::cout << "  SetExit calls of the threads: "
+            << s.ops[static_cast<size_t>( InstrumentOp::kSetExit )].calls
+               - exits_before
+            << " (40 expected: 1 per Labyrinth)." << std::endl
+            << "  Threads still counting: " << s.threads
+            << " (1 expected: the exited threads are kept in the totals)."
+            << std::endl;
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Printing the totals of every operation and counter:"
+            << std::endl;
+  PrintSnapshot( s );
+  std::cout << "Completed." << std::endl << std::endl;
+
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
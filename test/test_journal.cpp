@@ -0,0 +1,273 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ file tests the LabyrinthJournal class implementation.
+ *
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+#include "../include/room_properties.hpp"
+#include "../include/room.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/room_row.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_generator.hpp"
+#include "../include/labyrinth_journal.hpp"
+
+namespace
+{
+
+// This local function prints whether two Labyrinths have the same size,
+// Rooms, spawns, exit and Treasure.
+void CheckSame( const Labyrinth& l_1, const Labyrinth& l_2 );
+
+// This local function prints whether two Labyrinths have the same size,
+// Rooms, spawns, exit and Treasure.
+void CheckSame( const Labyrinth& l_1, const Labyrinth& l_2 )
+{
+  bool same = l_1.XSize() == l_2.XSize() && l_1.YSize() == l_2.YSize() &&
+              l_1.Mode() == l_2.Mode() &&
+              l_1.GetSpawn1() == l_2.GetSpawn1() &&
+              l_1.GetSpawn2() == l_2.GetSpawn2() &&
+              l_1.ExitSet() == l_2.ExitSet() &&
+              l_1.TreasureSet() == l_2.TreasureSet();
+  if( same && l_1.ExitSet() )
+  {
+    same = l_1.GetExit() == l_2.GetExit() &&
+           l_1.GetExitDirection() == l_2.GetExitDirection();
+  }
+  if( same && l_1.TreasureSet() )
+  {
+    same = l_1.GetTreasure() == l_2.GetTreasure();
+  }
+  for( size_t y = 0; same && y < l_1.YSize(); ++y )
+  {
+    const RoomRow row_1 = l_1.RowAt( y );
+    const RoomRow row_2 = l_2.RowAt( y );
+    for( size_t x = 0; same && x < row_1.size(); ++x )
+    {
+      same = row_1[x].Packed() == row_2[x].Packed();
+    }
+  }
+  std::cout << "  The Labyrinths are " << ( same ? "the same" : "NOT the same" )
+            << "." << std::endl;
+}
+
+}  // Local namespace
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING LABYRINTH_JOURNAL.CPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+
+
+  GeneratorOptions options;
+  options.seed = 25;
+  options.bullets = 3;
+  options.minotaurs = 3;
+  options.mirrors = 3;
+  LabyrinthGenerator generator( options );
+
+  std::cout << "Journaling the generation and play of a 12 x 10 Labyrinth:"
+            << std::endl;
+  Labyrinth l( 12, 10 );
+  size_t generated_events = 0;
+  {
+    LabyrinthJournal journal( &l, "test_journal_small.ljnl" );
+    std::cout << "  Events recorded for an empty Labyrinth: "
+              << journal.Recorded() << " (2 expected: the spawns)."
+              << std::endl;
+
+    generator.Generate( l );
+    generated_events = journal.Recorded();
+    const Labyrinth generated = l.Clone();
+
+    // Play: move the Treasure, attack every enemy and change a spawn, then
+    // undo some of it.
+    const Coordinate treasure = l.GetTreasure();
+    l.TakeItem( treasure );
+    l.DropTreasure( Coordinate(0, 0) );
+    for( size_t y = 0; y < l.YSize(); ++y )
+    {
+      for( size_t x = 0; x < l.XSize(); ++x )
+      {
+        const Inhabitant inh = l.GetInhabitant( Coordinate(x, y) );
+        if( inh == Inhabitant::kMinotaur || inh == Inhabitant::kMirror )
+        {
+          l.AttackEnemy( Coordinate(x, y) );
+        }
+      }
+    }
+    l.SetSpawn1( Coordinate(11, 9) );
+    const size_t checkpoint = l.Checkpoint();
+    l.TakeItem( Coordinate(0, 0) );
+    l.DropTreasure( Coordinate(5, 5) );
+    l.Rollback( checkpoint );
+
+    std::cout << "  Every event is written: " << journal.Flush()
+              << ", and none waited for the flush thread: "
+              << ( journal.Stalls() == 0 ) << " (1, 1 expected)."
+              << std::endl;
+    std::cout << "  Replaying every event:" << std::endl;
+    CheckSame( l, LabyrinthJournal::Replay("test_journal_small.ljnl") );
+    std::cout << "  Replaying the events up to the end of the generation:"
+              << std::endl;
+    CheckSame( generated,
+               LabyrinthJournal::Replay("test_journal_small.ljnl",
+                                        generated_events) );
+  }
+  std::cout << "  (The same expected for each.)" << std::endl;
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Journaling a generated Labyrinth from its current state:"
+            << std::endl;
+  {
+    LabyrinthJournal journal( &l, "test_journal_current.ljnl" );
+    l.SetSpawn2( Coordinate(3, 4) );
+  }
+  CheckSame( l, LabyrinthJournal::Replay("test_journal_current.ljnl") );
+  std::cout << "  (The same expected.)" << std::endl;
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Journaling a 300 x 300 LabyrinthMode::kLarge Labyrinth "
+            << "through a ring buffer of 64 events:" << std::endl;
+  {
+    Labyrinth l_large( 300, 300, LabyrinthMode::kLarge );
+    {
+      LabyrinthJournal journal( &l_large, "test_journal_large.ljnl", 64 );
+      const auto start = std::chrono::steady_clock::now();
+      generator.Generate( l_large );
+      const auto end = std::chrono::steady_clock::now();
+      std::cout << "  Recorded " << journal.Recorded() << " events in "
+                << std::chrono::duration_cast<std::chrono::microseconds>(
+                     end - start ).count()
+                << " us, including generation; the game thread waited "
+                << journal.Stalls() << " times (varies)." << std::endl;
+    }
+    CheckSame( l_large, LabyrinthJournal::Replay("test_journal_large.ljnl") );
+    std::cout << "  (The same expected.)" << std::endl;
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "________________________________________________"
+            << std::endl
+            << std::endl;
+
+  std::cout << "Journaling with a capacity of 100 (An error should be "
+            << "thrown):" << std::endl;
+  try
+  {
+    LabyrinthJournal journal( &l, "test_journal_error.ljnl", 100 );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Journaling into a missing directory (An error should be "
+            << "thrown):" << std::endl;
+  try
+  {
+    LabyrinthJournal journal( &l, "missing_directory/test_journal.ljnl" );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Replaying a missing file (An error should be thrown):"
+            << std::endl;
+  try
+  {
+    LabyrinthJournal::Replay( "test_journal_missing.ljnl" );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Replaying a file which is not a journal (An error should be "
+            << "thrown):" << std::endl;
+  {
+    std::ofstream text( "test_journal_text.ljnl" );
+    text << "This is not a journal of a Labyrinth." << std::endl;
+  }
+  try
+  {
+    LabyrinthJournal::Replay( "test_journal_text.ljnl" );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Replaying a journal with a truncated event:" << std::endl;
+  {
+    std::ifstream in( "test_journal_small.ljnl", std::ios::binary );
+    const std::string bytes( (std::istreambuf_iterator<char>(in)),
+                             std::istreambuf_iterator<char>() );
+    std::ofstream out( "test_journal_truncated.ljnl", std::ios::binary );
+    out.write( bytes.data(),
+               LabyrinthJournal::kHeaderSize +
+               generated_events * sizeof(JournalEvent) + 3 );
+  }
+  CheckSame( LabyrinthJournal::Replay("test_journal_small.ljnl",
+                                      generated_events),
+             LabyrinthJournal::Replay("test_journal_truncated.ljnl") );
+  std::cout << "  (The same expected: the partial event is ignored.)"
+            << std::endl;
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Replaying a journal whose only event breaks every Wall of "
+            << "Room (0, 0) (An error should be thrown):" << std::endl;
+  {
+    std::ifstream in( "test_journal_small.ljnl", std::ios::binary );
+    const std::string bytes( (std::istreambuf_iterator<char>(in)),
+                             std::istreambuf_iterator<char>() );
+    std::ofstream out( "test_journal_open.ljnl", std::ios::binary );
+    out.write( bytes.data(), LabyrinthJournal::kHeaderSize );
+    JournalEvent e = {};
+    e.before = Room::kWallMask;
+    e.after = 0;
+    e.kind = JournalEventKind::kWalls;
+    out.write( reinterpret_cast<const char*>(&e), sizeof(e) );
+  }
+  try
+  {
+    LabyrinthJournal::Replay( "test_journal_open.ljnl" );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
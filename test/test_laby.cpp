@@ -1,7 +1,7 @@
 /*
  *
  * Author: Jeffrey Leung
- * Last edited: 2016-01-15
+ * Last edited: 2026-10-14
  *
  * This C++ file tests the Labyrinth class implementation.
  *
@@ -10,11 +10,57 @@
 #include <exception>
 #include <iostream>
 #include <stdexcept>
+#include <string>
 
 #include "../include/room_properties.hpp"
 #include "../include/coordinate.hpp"
+#include "../include/room_row.hpp"
+#include "../include/labyrinth_observer.hpp"
 #include "../include/labyrinth.hpp"
 
+namespace
+{
+
+// This local class prints every change it is notified of.
+class PrintingObserver : public LabyrinthObserver
+{
+  public:
+
+    void RoomChanged( const Coordinate rm )
+    {
+      std::cout << "  Room (" << rm.x << ", " << rm.y << ") changed."
+                << std::endl;
+    }
+
+    void AllRoomsChanged()
+    {
+      std::cout << "  All Rooms changed." << std::endl;
+    }
+};
+
+// This local function returns the given status as a string.
+std::string StatusPrint( LabyrinthStatus s );
+
+// This local function returns the given status as a string.
+std::string StatusPrint( LabyrinthStatus s )
+{
+  switch( s )
+  {
+    case( LabyrinthStatus::kOk ):
+      return "kOk";
+    case( LabyrinthStatus::kOutOfBounds ):
+      return "kOutOfBounds";
+    case( LabyrinthStatus::kInvalidArgument ):
+      return "kInvalidArgument";
+    case( LabyrinthStatus::kInvalidState ):
+      return "kInvalidState";
+  }
+  return "Error: StatusPrint() was given a status which could not be "\
+         "detected.";
+}
+
+}  // Local namespace
+
 int main()
 {
   std::cout << std::endl
@@ -212,6 +258,297 @@ int main()
 
 
 
+  std::cout << "________________________________________________"
+            << std::endl << std::endl
+            << "TESTING ROWAT():"
+            << std::endl << std::endl;
+
+  std::cout << "The Labyrinth has size " << l1.XSize() << " x " << l1.YSize()
+            << "." << std::endl;
+
+  std::cout << "Checking the east side of every Room in row 0 "
+            << "(Room, Wall, Wall expected):" << std::endl;
+  const RoomRow row_0 = l1.RowAt( 0 );
+  for( const Room& rm : row_0 )
+  {
+    std::cout << "  "
+              << ( rm.DirectionCheck(Direction::kEast) == RoomBorder::kRoom ?
+                   "Room" : "Wall" )
+              << std::endl;
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Getting row 5, outside of the Labyrinth "
+            << "(An error should be thrown):"
+            << std::endl;
+  try
+  {
+    l1.RowAt( 5 );
+  }
+  catch (const std::exception& e)
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+
+
+  std::cout << "________________________________________________"
+            << std::endl << std::endl
+            << "TESTING LARGE LABYRINTHS:"
+            << std::endl << std::endl;
+
+  std::cout << "Creating a small Labyrinth with x size = 21 "
+            << "(An error should be thrown):"
+            << std::endl;
+  try
+  {
+    Labyrinth l_too_big( 21, 1 );
+  }
+  catch (const std::exception& e)
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Creating a large Labyrinth with x size = y size = 10000:"
+            << std::endl;
+  Labyrinth l_large( 10000, 10000, LabyrinthMode::kLarge );
+  std::cout << "  Rooms with storage: " << l_large.ResidentRooms()
+            << " (0 expected)." << std::endl;
+
+  Coordinate c_far_1(9998, 9999);
+  Coordinate c_far_2(9999, 9999);
+  try
+  {
+    l_large.ConnectRooms( c_far_1, c_far_2 );
+  }
+  catch (const std::exception& e)
+  {
+    std::cout << e.what();
+  }
+  std::cout << "  After connecting (9998, 9999) and (9999, 9999), rooms with "
+            << "storage: " << l_large.ResidentRooms()
+            << " (160000 expected)." << std::endl;
+  std::cout << "  East of (9998, 9999) is a "
+            << ( l_large.DirectionCheck(c_far_1, Direction::kEast) ==
+                 RoomBorder::kRoom ? "Room" : "Wall" )
+            << " (Room expected)." << std::endl;
+  std::cout << "  East of (0, 0) is a "
+            << ( l_large.DirectionCheck(c_0_0, Direction::kEast) ==
+                 RoomBorder::kRoom ? "Room" : "Wall" )
+            << " (Wall expected)." << std::endl;
+  std::cout << "Done." << std::endl << std::endl;
+
+
+
+  std::cout << "________________________________________________"
+            << std::endl << std::endl
+            << "TESTING OBSERVERS:"
+            << std::endl << std::endl;
+
+  std::cout << "Observing a Labyrinth while connecting (0, 0) and (1, 0), "
+            << "then placing and taking a bullet in (1, 0):" << std::endl;
+  Labyrinth l_observed( 2, 2 );
+  PrintingObserver observer;
+  l_observed.AddObserver( &observer );
+  try
+  {
+    l_observed.ConnectRooms( Coordinate(0, 0), Coordinate(1, 0) );
+    l_observed.SetItem( Coordinate(1, 0), Item::kBullet );
+    l_observed.TakeItem( Coordinate(1, 0) );
+  }
+  catch (const std::exception& e)
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Removing the observer, then placing a Minotaur "
+            << "(Nothing should be printed):" << std::endl;
+  l_observed.RemoveObserver( &observer );
+  l_observed.SetInhabitant( Coordinate(0, 1), Inhabitant::kMinotaur );
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Adding a null observer (An error should be thrown):"
+            << std::endl;
+  try
+  {
+    l_observed.AddObserver( nullptr );
+  }
+  catch (const std::exception& e)
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+
+
+  std::cout << "________________________________________________"
+            << std::endl << std::endl
+            << "TESTING FAST PATH:"
+            << std::endl << std::endl;
+
+  std::cout << "Probing a 3 x 3 Labyrinth with the Try methods:" << std::endl;
+  Labyrinth l_fast( 3, 3 );
+  l_fast.ConnectRooms( Coordinate(0, 0), Coordinate(1, 0) );
+  l_fast.SetInhabitant( Coordinate(1, 0), Inhabitant::kMirror );
+  l_fast.SetItem( Coordinate(2, 2), Item::kTreasure );
+
+  Inhabitant inh = Inhabitant::kNone;
+  Item itm = Item::kNone;
+  RoomBorder rb = RoomBorder::kWall;
+  std::cout << "  TryGetInhabitant (1, 0): "
+            << StatusPrint( l_fast.TryGetInhabitant(Coordinate(1, 0), inh) )
+            << ( inh == Inhabitant::kMirror ? ", a Mirror" : ", NOT a Mirror" )
+            << " (kOk, a Mirror expected)." << std::endl;
+  std::cout << "  TryItemAt (3, 0): "
+            << StatusPrint( l_fast.TryItemAt(Coordinate(3, 0), itm) )
+            << " (kOutOfBounds expected)." << std::endl;
+  std::cout << "  TryDirectionCheck east of (0, 0): "
+            << StatusPrint( l_fast.TryDirectionCheck(Coordinate(0, 0),
+                                                     Direction::kEast, rb) )
+            << ( rb == RoomBorder::kRoom ? ", a Room" : ", a Wall" )
+            << " (kOk, a Room expected)." << std::endl;
+  std::cout << "  TryDirectionCheck kNone of (0, 0): "
+            << StatusPrint( l_fast.TryDirectionCheck(Coordinate(0, 0),
+                                                     Direction::kNone, rb) )
+            << " (kInvalidArgument expected)." << std::endl;
+  std::cout << "  TrySetExit east of (0, 0): "
+            << StatusPrint( l_fast.TrySetExit(Coordinate(0, 0),
+                                              Direction::kEast) )
+            << " (kInvalidArgument expected)." << std::endl;
+  std::cout << "  TrySetExit west of (0, 0): "
+            << StatusPrint( l_fast.TrySetExit(Coordinate(0, 0),
+                                              Direction::kWest) )
+            << " (kOk expected)." << std::endl;
+  std::cout << "  TrySetExit west of (0, 1): "
+            << StatusPrint( l_fast.TrySetExit(Coordinate(0, 1),
+                                              Direction::kWest) )
+            << " (kInvalidState expected)." << std::endl;
+  std::cout << "  TryAttackEnemy (1, 0) twice: "
+            << StatusPrint( l_fast.TryAttackEnemy(Coordinate(1, 0)) ) << ", "
+            << StatusPrint( l_fast.TryAttackEnemy(Coordinate(1, 0)) )
+            << " (kOk, kInvalidArgument expected)." << std::endl;
+  std::cout << "  TryTakeItem (2, 2) twice: "
+            << StatusPrint( l_fast.TryTakeItem(Coordinate(2, 2)) ) << ", "
+            << StatusPrint( l_fast.TryTakeItem(Coordinate(2, 2)) )
+            << " (kOk, kInvalidState expected)." << std::endl;
+  std::cout << "  TryTakeItem (0, 3): "
+            << StatusPrint( l_fast.TryTakeItem(Coordinate(0, 3)) )
+            << " (kOutOfBounds expected)." << std::endl;
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Reading the same Rooms with the Unchecked methods:"
+            << std::endl;
+  std::cout << "  (1, 0) holds a "
+            << ( l_fast.GetInhabitantUnchecked(Coordinate(1, 0)) ==
+                 Inhabitant::kMirrorCracked ? "cracked Mirror" : "NOT cracked" )
+            << " (cracked Mirror expected)." << std::endl;
+  std::cout << "  The Treasure in (2, 2) is "
+            << ( l_fast.ItemAtUnchecked(Coordinate(2, 2)) ==
+                 Item::kTreasureGone ? "gone" : "NOT gone" )
+            << " (gone expected)." << std::endl;
+  std::cout << "  West of (0, 0) is "
+            << ( l_fast.DirectionCheckUnchecked(Coordinate(0, 0),
+                                                Direction::kWest) ==
+                 RoomBorder::kExit ? "the exit" : "NOT the exit" )
+            << " (the exit expected)." << std::endl;
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Attacking an empty Room with the checked method "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    l_fast.AttackEnemy( Coordinate(2, 1) );
+  }
+  catch (const std::exception& e)
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+
+
+  std::cout << "________________________________________________"
+            << std::endl << std::endl
+            << "TESTING SNAPSHOTS:"
+            << std::endl << std::endl;
+
+  std::cout << "Cloning a large Labyrinth, then connecting Rooms in the clone "
+            << "(The original should not change):" << std::endl;
+  Labyrinth l_original( 1000, 1000, LabyrinthMode::kLarge );
+  l_original.ConnectRooms( Coordinate(0, 0), Coordinate(1, 0) );
+  l_original.SetItem( Coordinate(1, 0), Item::kBullet );
+  Labyrinth l_clone = l_original.Clone();
+  std::cout << "  The clone has " << l_clone.ResidentRooms()
+            << " Rooms with storage (64000 expected), and a "
+            << ( l_clone.ItemAt(Coordinate(1, 0)) == Item::kBullet ?
+                 "bullet" : "missing bullet" )
+            << " in (1, 0)." << std::endl;
+  l_clone.ConnectRooms( Coordinate(0, 0), Coordinate(0, 1) );
+  l_clone.TakeItem( Coordinate(1, 0) );
+  std::cout << "  South of (0, 0) is a "
+            << ( l_clone.DirectionCheck(c_0_0, Direction::kSouth) ==
+                 RoomBorder::kRoom ? "Room" : "Wall" )
+            << " in the clone (Room expected) and a "
+            << ( l_original.DirectionCheck(c_0_0, Direction::kSouth) ==
+                 RoomBorder::kRoom ? "Room" : "Wall" )
+            << " in the original (Wall expected)." << std::endl;
+  std::cout << "  The bullet in (1, 0) is "
+            << ( l_original.ItemAt(Coordinate(1, 0)) == Item::kBullet ?
+                 "still" : "NOT" )
+            << " in the original (still expected)." << std::endl;
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Playing a 3 x 3 Labyrinth from a checkpoint, then rolling "
+            << "back twice:" << std::endl;
+  Labyrinth l_journal( 3, 3 );
+  l_journal.SetItem( Coordinate(2, 2), Item::kTreasure );
+  l_journal.SetInhabitant( Coordinate(1, 1), Inhabitant::kMinotaur );
+  l_journal.AddObserver( &observer );
+  const size_t before = l_journal.Checkpoint();
+  l_journal.TakeItem( Coordinate(2, 2) );
+  const size_t taken = l_journal.Checkpoint();
+  l_journal.AttackEnemy( Coordinate(1, 1) );
+  l_journal.DropTreasure( Coordinate(0, 0) );
+  l_journal.ConnectRooms( Coordinate(0, 0), Coordinate(0, 1) );
+  std::cout << " Rolling back to after the Treasure was taken:" << std::endl;
+  l_journal.Rollback( taken );
+  std::cout << "  The Minotaur is "
+            << ( l_journal.GetInhabitant(Coordinate(1, 1)) ==
+                 Inhabitant::kMinotaur ? "alive" : "NOT alive" )
+            << ", and the Treasure is "
+            << ( l_journal.TreasureSet() ? "in a Room" : "held" )
+            << " (alive, held expected)." << std::endl;
+  std::cout << " Rolling back to before the Treasure was taken:" << std::endl;
+  l_journal.Rollback( before );
+  std::cout << "  The Treasure is "
+            << ( l_journal.TreasureSet() &&
+                 l_journal.GetTreasure() == Coordinate(2, 2) &&
+                 l_journal.ItemAt(Coordinate(2, 2)) == Item::kTreasure ?
+                 "back in (2, 2)" : "NOT back in (2, 2)" )
+            << ", and south of (0, 0) is a "
+            << ( l_journal.DirectionCheck(c_0_0, Direction::kSouth) ==
+                 RoomBorder::kRoom ? "Room" : "Wall" )
+            << " (Wall expected)." << std::endl;
+  l_journal.RemoveObserver( &observer );
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Rolling back to a discarded checkpoint "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    l_journal.Rollback( taken );
+  }
+  catch (const std::exception& e)
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+
+
   std::cout << "________________________________________________" << std::endl;
   std::cout << std::endl;
   std::cout << "All tests completed." << std::endl;
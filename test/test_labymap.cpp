@@ -7,15 +7,47 @@
  *
  */
 
+#include <cstdio>
 #include <exception>
 #include <iostream>
+#include <sstream>
 #include <stdexcept>
+#include <string>
 
 #include "../include/room_properties.hpp"
 #include "../include/coordinate.hpp"
 #include "../include/labyrinth.hpp"
+#include "../include/labyrinth_visibility.hpp"
 #include "../include/labyrinth_map.hpp"
 
+namespace
+{
+
+// This local class counts the cells of a rendered map which are the exit.
+class ExitCounter : public LabyrinthMapBackend
+{
+  public:
+
+    void Begin( const size_t width, const size_t )
+    {
+      width_ = width;
+      exits_ = 0;
+    }
+
+    void Row( const MapCell* const cells )
+    {
+      for( size_t x = 0; x < width_; ++x )
+      {
+        exits_ += cells[x] == MapCell::kExit;
+      }
+    }
+
+    size_t width_ = 0;
+    size_t exits_ = 0;
+};
+
+}  // Local namespace
+
 int main()
 {
   std::cout << std::endl
@@ -139,6 +171,298 @@ int main()
   std::cout << std::endl;
 
 
+  std::cout << "________________________________________________"
+            << std::endl
+            << std::endl;
+
+  std::cout << "Taking the bullet and attacking both Inhabitants of the "
+            << "top row." << std::endl;
+  try
+  {
+    l1.TakeItem( c1 );
+    l1.AttackEnemy( c1 );
+    l1.AttackEnemy( c5 );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Completed." << std::endl;
+
+  std::cout << "Displaying the Map of the Labyrinth (Only the changed "
+            << "Rooms are updated):" << std::endl << std::endl;
+  try
+  {
+    l1_map.Display();
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Completed." << std::endl;
+  std::cout << std::endl;
+
+  std::cout << "Creating and displaying a new Map of the same Labyrinth "
+            << "(Should match the Map above):" << std::endl << std::endl;
+  try
+  {
+    LabyrinthMap l1_map_new( &l1, l1_xsize, l1_ysize );
+    l1_map_new.Display();
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Completed." << std::endl;
+  std::cout << std::endl;
+
+
+  std::cout << "________________________________________________"
+            << std::endl
+            << std::endl;
+
+  std::cout << "Displaying the Map into a string stream and a temporary file "
+            << "(Both should match Render()):" << std::endl;
+  try
+  {
+    const std::string frame = l1_map.Render();
+
+    std::ostringstream os;
+    l1_map.Display( os );
+    std::cout << "  Stream: " << ( os.str() == frame ? "matches" : "DIFFERS" )
+              << " (" << frame.size() << " bytes)." << std::endl;
+
+    FILE* const f = std::tmpfile();
+    if( f != nullptr )
+    {
+      l1_map.Display( fileno(f) );
+      std::rewind( f );
+      std::string written( frame.size() + 1, '\0' );
+      written.resize( std::fread(&written[0], 1, written.size(), f) );
+      std::fclose( f );
+      std::cout << "  File: " << ( written == frame ? "matches" : "DIFFERS" )
+                << "." << std::endl;
+    }
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Completed." << std::endl;
+  std::cout << std::endl;
+
+  std::cout << "Creating a 2 x 1 Labyrinth, setting an exit to the west of "
+            << "(0, 0) after a checkpoint, then rolling back (The exit "
+            << "should be drawn, then removed):" << std::endl;
+  {
+    Labyrinth l_exit( 2, 1 );
+    LabyrinthMap exit_map( &l_exit, 2, 1 );
+    ExitCounter counter;
+    exit_map.Render( counter );
+    const size_t checkpoint = l_exit.Checkpoint();
+    l_exit.SetExit( Coordinate(0, 0), Direction::kWest );
+    std::cout << "  Exits drawn: " << counter.exits_;
+    exit_map.Render( counter );
+    std::cout << ", " << counter.exits_;
+    l_exit.Rollback( checkpoint );
+    exit_map.Render( counter );
+    std::cout << ", " << counter.exits_ << " (0, 1, 0 expected)."
+              << std::endl;
+  }
+  std::cout << "Completed." << std::endl;
+  std::cout << std::endl;
+
+  std::cout << "Displaying the Map into an invalid file descriptor "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    l1_map.Display( -1 );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl;
+  std::cout << std::endl;
+
+  std::cout << "Creating a 10 x 10 Map of a 3 x 3 Labyrinth "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    Labyrinth l_small( 3, 3 );
+    LabyrinthMap too_big( &l_small, 10, 10 );
+    too_big.Render();
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl;
+  std::cout << std::endl;
+
+
+  std::cout << "________________________________________________"
+            << std::endl
+            << std::endl;
+
+  std::cout << "Creating a 40 x 30 LabyrinthMode::kLarge Labyrinth whose "
+            << "rows are connected to the west column (a comb), with a "
+            << "Treasure at (20, 15), a live Minotaur at (39, 29) and the exit "
+            << "east of (39, 0):" << std::endl;
+  const size_t l2_xsize = 40;
+  const size_t l2_ysize = 30;
+  Labyrinth l2( l2_xsize, l2_ysize, LabyrinthMode::kLarge );
+  for( size_t y = 0; y < l2_ysize; ++y )
+  {
+    for( size_t x = 1; x < l2_xsize; ++x )
+    {
+      l2.ConnectRooms( Coordinate(x - 1, y), Coordinate(x, y) );
+    }
+    if( y > 0 )
+    {
+      l2.ConnectRooms( Coordinate(0, y - 1), Coordinate(0, y) );
+    }
+  }
+  l2.SetItem( Coordinate(20, 15), Item::kTreasure );
+  l2.SetInhabitant( Coordinate(39, 29), Inhabitant::kMinotaur );
+  l2.SetExit( Coordinate(39, 0), Direction::kEast );
+  LabyrinthMap l2_map( &l2, l2_xsize, l2_ysize );
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Displaying a window of 31 x 11 characters around the "
+            << "Treasure (10 x 5 Rooms, from (15, 13)):" << std::endl;
+  try
+  {
+    l2_map.DisplayWindow( std::cout, Coordinate(20, 15), 31, 11 );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Displaying a window of 16 x 7 characters around the "
+            << "Minotaur (5 x 3 Rooms, moved inside the Labyrinth to "
+            << "(35, 27)):" << std::endl;
+  try
+  {
+    l2_map.DisplayWindow( std::cout, Coordinate(39, 29), 16, 7 );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Displaying an overview in 20 x 10 characters (Blocks of 3 x "
+            << "3 Rooms; 14 x 10 characters with the exit at the top "
+            << "right, the Treasure at (6, 5) and the Minotaur at the bottom "
+            << "right):" << std::endl;
+  try
+  {
+    l2_map.DisplayOverview( std::cout, 20, 10 );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Displaying the same window after taking the Treasure and "
+            << "attacking the Minotaur (Only the changed Rooms are updated):"
+            << std::endl;
+  try
+  {
+    l2.TakeItem( Coordinate(20, 15) );
+    l2.AttackEnemy( Coordinate(39, 29) );
+    l2_map.DisplayWindow( std::cout, Coordinate(39, 29), 16, 7 );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Displaying a window of 80 x 24 characters of the first "
+            << "Labyrinth (The whole Labyrinth, without axes or legend):"
+            << std::endl;
+  try
+  {
+    l1_map.DisplayWindow( std::cout, Coordinate(1, 1), 80, 24 );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Displaying a window of the Rooms revealed to Player 0, "
+            << "(0, 0) to (2, 0) and (0, 1):" << std::endl;
+  try
+  {
+    LabyrinthVisibility v( l2_xsize, l2_ysize, 1 );
+    v.Reveal( 0, Coordinate(0, 0) );
+    v.Reveal( 0, Coordinate(1, 0) );
+    v.Reveal( 0, Coordinate(2, 0) );
+    v.Reveal( 0, Coordinate(0, 1) );
+    l2_map.DisplayWindow( std::cout, v, 0, Coordinate(0, 0), 13, 7 );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Displaying an overview of the first Labyrinth in 80 x 24 "
+            << "characters (One character per Room):" << std::endl;
+  try
+  {
+    l1_map.DisplayOverview( std::cout, 80, 24 );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Displaying a window around (40, 0) (An error should be "
+            << "thrown):" << std::endl;
+  try
+  {
+    l2_map.DisplayWindow( std::cout, Coordinate(40, 0), 80, 24 );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Displaying a window of 3 x 3 characters (An error should be "
+            << "thrown):" << std::endl;
+  try
+  {
+    l2_map.DisplayWindow( std::cout, Coordinate(0, 0), 3, 3 );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Displaying an overview of 0 x 10 characters (An error should "
+            << "be thrown):" << std::endl;
+  try
+  {
+    l2_map.DisplayOverview( std::cout, 0, 10 );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl;
+  std::cout << std::endl;
+
+
 
   std::cout << "________________________________________________" << std::endl;
   std::cout << std::endl;
@@ -0,0 +1,199 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ file tests the LabyrinthMap backends: AsciiMapBackend,
+ * PbmMapBackend and PngMapBackend.
+ *
+ */
+
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_map.hpp"
+#include "../include/labyrinth_map_backend.hpp"
+#include "../include/labyrinth_generator.hpp"
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING LABYRINTH_MAP_BACKEND.CPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+
+
+  std::cout << "Creating a 3 x 2 Labyrinth which is a snake from the top "
+            << "left to the bottom right, with the exit at the bottom right, "
+            << "a Minotaur (live) and a bullet at the top left, a Minotaur "
+            << "(dead) at the bottom left, a Treasure at the bottom center, "
+            << "a mirror (intact) at the top right and a mirror (cracked) at "
+            << "the bottom right." << std::endl;
+  Labyrinth l( 3, 2 );
+  l.ConnectRooms( Coordinate(0, 0), Coordinate(0, 1) );
+  l.ConnectRooms( Coordinate(0, 1), Coordinate(1, 1) );
+  l.ConnectRooms( Coordinate(1, 1), Coordinate(1, 0) );
+  l.ConnectRooms( Coordinate(1, 0), Coordinate(2, 0) );
+  l.ConnectRooms( Coordinate(2, 0), Coordinate(2, 1) );
+  l.SetExit( Coordinate(2, 1), Direction::kSouth );
+  l.SetInhabitant( Coordinate(0, 0), Inhabitant::kMinotaur );
+  l.SetInhabitant( Coordinate(0, 1), Inhabitant::kMinotaurDead );
+  l.SetInhabitant( Coordinate(2, 0), Inhabitant::kMirror );
+  l.SetInhabitant( Coordinate(2, 1), Inhabitant::kMirrorCracked );
+  l.SetItem( Coordinate(0, 0), Item::kBullet );
+  l.SetItem( Coordinate(1, 1), Item::kTreasure );
+  LabyrinthMap l_map( &l, 3, 2 );
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Rendering the map as ASCII:" << std::endl;
+  std::ostringstream ascii;
+  {
+    AsciiMapBackend backend( ascii );
+    l_map.Render( backend );
+  }
+  std::cout << ascii.str();
+  std::cout << "  (A 7 x 5 snake expected, with M at the top left, m below "
+            << "it, T at the bottom center, O at the top right, 0 below it "
+            << "and E below that.)" << std::endl;
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Rendering the map as a PBM bitmap:" << std::endl;
+  std::ostringstream pbm;
+  {
+    PbmMapBackend backend( pbm );
+    l_map.Render( backend );
+  }
+  const std::string pbm_bytes = pbm.str();
+  std::cout << "  Header: "
+            << ( pbm_bytes.compare(0, 7, "P4\n7 5\n") == 0 ? "P4 7 5" :
+                                                           "incorrect" )
+            << ", size: " << pbm_bytes.size()
+            << " bytes (P4 7 5, 12 bytes expected)." << std::endl;
+  std::cout << "  Rows:";
+  for( size_t i = 7; i < pbm_bytes.size(); ++i )
+  {
+    std::cout << " " << static_cast<unsigned>(
+      static_cast<unsigned char>(pbm_bytes[i]) );
+  }
+  std::cout << " (254 162 170 138 250 expected)." << std::endl;
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Rendering the map as a PNG image to test_map_backend.png:"
+            << std::endl;
+  {
+    std::ofstream png( "test_map_backend.png", std::ios::binary );
+    PngMapBackend backend( png );
+    l_map.Render( backend );
+  }
+  {
+    std::ifstream png( "test_map_backend.png", std::ios::binary );
+    const std::string bytes( (std::istreambuf_iterator<char>(png)),
+                             std::istreambuf_iterator<char>() );
+    std::cout << "  Signature: "
+              << ( bytes.compare(1, 3, "PNG") == 0 ? "PNG" : "incorrect" )
+              << ", ends with IEND: "
+              << ( bytes.size() >= 12 &&
+                   bytes.compare(bytes.size() - 8, 4, "IEND") == 0 )
+              << " (PNG, 1 expected)." << std::endl;
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "________________________________________________"
+            << std::endl
+            << std::endl;
+
+  std::cout << "Comparing the sizes of each format of a generated 100 x 100 "
+            << "LabyrinthMode::kLarge Labyrinth:" << std::endl;
+  {
+    GeneratorOptions options;
+    options.seed = 27;
+    options.bullets = 10;
+    options.minotaurs = 10;
+    options.mirrors = 10;
+    LabyrinthGenerator generator( options );
+    Labyrinth l_large( 100, 100, LabyrinthMode::kLarge );
+    generator.Generate( l_large );
+    LabyrinthMap large_map( &l_large, 100, 100 );
+
+    std::ostringstream text;
+    large_map.Display( text );
+    std::ostringstream ascii_large;
+    std::ostringstream pbm_large;
+    std::ostringstream png_large;
+    AsciiMapBackend ascii_backend( ascii_large );
+    PbmMapBackend pbm_backend( pbm_large );
+    PngMapBackend png_backend( png_large );
+    large_map.Render( ascii_backend );
+    large_map.Render( pbm_backend );
+    large_map.Render( png_backend );
+
+    const size_t text_size = text.str().size();
+    std::cout << "  UTF-8 text: " << text_size << " bytes" << std::endl
+              << "  ASCII: " << ascii_large.str().size() << " bytes ("
+              << ( ascii_large.str().size() == 201 * 202 ) << ")"
+              << std::endl
+              << "  PBM: " << pbm_large.str().size() << " bytes ("
+              << ( pbm_large.str().size() == 11 + 26 * 201 ) << ")"
+              << std::endl
+              << "  PNG: " << png_large.str().size() << " bytes ("
+              << ( png_large.str().size() < ascii_large.str().size() )
+              << ")" << std::endl;
+    std::cout << "  (1 expected for each: the ASCII and PBM sizes are exact, "
+              << "and the PNG is smaller than the ASCII.)" << std::endl;
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "________________________________________________"
+            << std::endl
+            << std::endl;
+
+  std::cout << "Rendering the map as ASCII to a failed stream (An error "
+            << "should be thrown):" << std::endl;
+  try
+  {
+    std::ofstream bad( "missing_directory/test_map_backend.txt" );
+    AsciiMapBackend backend( bad );
+    l_map.Render( backend );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Rendering the map as a PNG image to a failed stream (An "
+            << "error should be thrown):" << std::endl;
+  try
+  {
+    std::ofstream bad( "missing_directory/test_map_backend.png" );
+    PngMapBackend backend( bad );
+    l_map.Render( backend );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,199 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ file tests the LabyrinthPipeline class implementation.
+ *
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_generator.hpp"
+#include "../include/labyrinth_file.hpp"
+#include "../include/labyrinth_pipeline.hpp"
+
+namespace
+{
+
+// This local function returns the contents of a file.
+std::string ReadFile( const std::string& path );
+
+// This local function prints the checks of a Labyrinth.
+void PrintValidation( const MazeValidation& v );
+
+// This local function returns the contents of a file.
+std::string ReadFile( const std::string& path )
+{
+  std::ifstream file( path, std::ios::binary );
+  return std::string( std::istreambuf_iterator<char>(file),
+                      std::istreambuf_iterator<char>() );
+}
+
+// This local function prints the checks of a Labyrinth.
+void PrintValidation( const MazeValidation& v )
+{
+  std::cout << "  Connected: " << v.connected
+            << ", perfect: " << v.perfect
+            << ", exit reachable: " << v.exit_reachable
+            << ", Treasure reachable: " << v.treasure_reachable
+            << ", valid: " << v.Valid() << "." << std::endl;
+}
+
+}  // Local namespace
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING LABYRINTH_PIPELINE.CPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+
+
+  std::cout << "Making 64 mazes of 30 x 30 on 4 workers:" << std::endl;
+  PipelineOptions options;
+  options.x_size = 30;
+  options.y_size = 30;
+  options.generator.bullets = 5;
+  options.generator.minotaurs = 5;
+  options.directory = ".";
+  options.prefix = "pipeline_4_";
+  options.workers = 4;
+
+  std::vector<std::uint64_t> seeds;
+  for( std::uint64_t s = 0; s < 64; ++s )
+  {
+    seeds.push_back( 1000 + s );
+  }
+
+  LabyrinthPipeline pipeline( options );
+  const auto start = std::chrono::steady_clock::now();
+  const std::vector<PipelineResult> results = pipeline.Run( seeds );
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  size_t valid = 0;
+  size_t saved = 0;
+  bool ordered = true;
+  for( size_t i = 0; i < results.size(); ++i )
+  {
+    valid += results[i].validation.Valid() && results[i].error.empty();
+    saved += !results[i].path.empty();
+    ordered = ordered && results[i].seed == seeds[i];
+  }
+  std::cout << "  Valid: " << valid << ", saved: " << saved
+            << " (64, 64 expected), in "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(
+                 elapsed ).count() << " ms." << std::endl
+            << "  Results are " << ( ordered ? "" : "NOT " )
+            << "in the order of the seeds." << std::endl;
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Making the same mazes on 1 worker "
+            << "(The files should be identical):" << std::endl;
+  options.prefix = "pipeline_1_";
+  options.workers = 1;
+  LabyrinthPipeline serial( options );
+  const std::vector<PipelineResult> serial_results = serial.Run( seeds );
+  size_t identical = 0;
+  for( size_t i = 0; i < seeds.size(); ++i )
+  {
+    const std::string data = ReadFile( results[i].path );
+    identical += !data.empty() && data == ReadFile( serial_results[i].path );
+  }
+  std::cout << "  Identical files: " << identical << " (64 expected)."
+            << std::endl;
+  const Labyrinth loaded = LabyrinthFile::Load( results[0].path );
+  std::cout << "  The first file loads as a " << loaded.XSize() << " x "
+            << loaded.YSize() << " Labyrinth which is "
+            << ( LabyrinthPipeline::Validate(loaded).Valid() ? "" : "NOT " )
+            << "valid." << std::endl;
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Validating a 2 x 2 Labyrinth with a loop and no exit:"
+            << std::endl;
+  {
+    Labyrinth l( 2, 2 );
+    l.ConnectRooms( Coordinate(0, 0), Coordinate(1, 0) );
+    l.ConnectRooms( Coordinate(1, 0), Coordinate(1, 1) );
+    l.ConnectRooms( Coordinate(1, 1), Coordinate(0, 1) );
+    l.ConnectRooms( Coordinate(0, 1), Coordinate(0, 0) );
+    l.SetSpawn1( Coordinate(0, 0) );
+    l.SetSpawn2( Coordinate(1, 1) );
+    l.SetItem( Coordinate(1, 0), Item::kTreasure );
+    PrintValidation( LabyrinthPipeline::Validate(l) );
+    std::cout << "  (1, 0, 0, 1, 0 expected)." << std::endl;
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Validating a 3 x 1 Labyrinth with spawn 2 cut off:"
+            << std::endl;
+  {
+    Labyrinth l( 3, 1 );
+    l.ConnectRooms( Coordinate(0, 0), Coordinate(1, 0) );
+    l.SetSpawn1( Coordinate(0, 0) );
+    l.SetSpawn2( Coordinate(2, 0) );
+    l.SetItem( Coordinate(1, 0), Item::kTreasure );
+    l.SetExit( Coordinate(1, 0), Direction::kNorth );
+    PrintValidation( LabyrinthPipeline::Validate(l) );
+    std::cout << "  (0, 0, 1, 0, 0 expected)." << std::endl;
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "________________________________________________"
+            << std::endl
+            << std::endl;
+
+  std::cout << "Making mazes with more Items than Rooms "
+            << "(Each error should be reported in its result):"
+            << std::endl;
+  {
+    PipelineOptions bad;
+    bad.x_size = 2;
+    bad.y_size = 2;
+    bad.generator.bullets = 10;
+    bad.workers = 2;
+    LabyrinthPipeline p( bad );
+    const std::vector<PipelineResult> r = p.Run( { 1, 2 } );
+    for( const PipelineResult& result : r )
+    {
+      std::cout << "  Seed " << result.seed << ": " << result.error;
+    }
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Creating a pipeline with a size of 0 "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    PipelineOptions bad;
+    bad.x_size = 0;
+    LabyrinthPipeline p( bad );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
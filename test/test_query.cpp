@@ -0,0 +1,218 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ file tests the LabyrinthQuery and RoomBitset class
+ * implementations.
+ *
+ */
+
+#include <array>
+#include <chrono>
+#include <exception>
+#include <iostream>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_generator.hpp"
+#include "../include/labyrinth_query.hpp"
+
+namespace
+{
+
+// This local function returns true if every query of the Labyrinth agrees
+// with the Room-by-Room Labyrinth methods.
+bool QueriesMatch( const Labyrinth& l );
+
+// This local function returns true if every query of the Labyrinth agrees
+// with the Room-by-Room Labyrinth methods.
+bool QueriesMatch( const Labyrinth& l )
+{
+  const RoomBitset minotaurs =
+    LabyrinthQuery::FindInhabitants( l, Inhabitant::kMinotaur );
+  const RoomBitset bullets = LabyrinthQuery::FindItems( l, Item::kBullet );
+  const RoomBitset dead_ends = LabyrinthQuery::DeadEnds( l );
+  const std::array<size_t, 5> degrees = LabyrinthQuery::DegreeHistogram( l );
+
+  const Direction directions[4] = { Direction::kNorth, Direction::kEast,
+                                    Direction::kSouth, Direction::kWest };
+  std::array<size_t, 5> expected_degrees = {};
+  size_t expected_minotaurs = 0;
+  size_t expected_bullets = 0;
+  for( size_t y = 0; y < l.YSize(); ++y )
+  {
+    for( size_t x = 0; x < l.XSize(); ++x )
+    {
+      const Coordinate rm( x, y );
+      size_t walls = 0;
+      size_t rooms = 0;
+      for( const Direction d : directions )
+      {
+        const RoomBorder rb = l.DirectionCheck( rm, d );
+        walls += rb == RoomBorder::kWall;
+        rooms += rb == RoomBorder::kRoom;
+      }
+      ++expected_degrees[rooms];
+
+      const bool minotaur = l.GetInhabitant(rm) == Inhabitant::kMinotaur;
+      const bool bullet = l.ItemAt(rm) == Item::kBullet;
+      expected_minotaurs += minotaur;
+      expected_bullets += bullet;
+      if( minotaurs.Test(rm) != minotaur || bullets.Test(rm) != bullet ||
+          dead_ends.Test(rm) != (walls == 3) )
+      {
+        return false;
+      }
+    }
+  }
+
+  return degrees == expected_degrees &&
+         minotaurs.Count() == expected_minotaurs &&
+         LabyrinthQuery::CountInhabitants( l, Inhabitant::kMinotaur ) ==
+           expected_minotaurs &&
+         LabyrinthQuery::CountItems( l, Item::kBullet ) == expected_bullets;
+}
+
+}  // Local namespace
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING LABYRINTH_QUERY.CPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+  std::cout << "Scans are compiled for: "
+            << LabyrinthQuery::InstructionSet() << std::endl << std::endl;
+
+
+
+  std::cout << "Querying a 3 x 3 Labyrinth with a corridor along the top:"
+            << std::endl;
+  {
+    Labyrinth l( 3, 3 );
+    l.ConnectRooms( Coordinate(0, 0), Coordinate(1, 0) );
+    l.ConnectRooms( Coordinate(1, 0), Coordinate(2, 0) );
+    l.SetExit( Coordinate(2, 0), Direction::kEast );
+    l.SetInhabitant( Coordinate(1, 0), Inhabitant::kMinotaur );
+    l.SetInhabitant( Coordinate(2, 2), Inhabitant::kMinotaur );
+    l.SetItem( Coordinate(0, 2), Item::kTreasure );
+
+    std::cout << "  Minotaurs: "
+              << LabyrinthQuery::CountInhabitants( l, Inhabitant::kMinotaur )
+              << " (2 expected)." << std::endl;
+    std::cout << "  Dead ends:";
+    for( const Coordinate& rm : LabyrinthQuery::DeadEnds(l).Coordinates() )
+    {
+      std::cout << " (" << rm.x << ", " << rm.y << ")";
+    }
+    std::cout << " ((0, 0) expected)." << std::endl;
+    const std::vector<Coordinate> treasure =
+      LabyrinthQuery::FindItems( l, Item::kTreasure ).Coordinates();
+    std::cout << "  Treasure: " << treasure.size() << " Room, ("
+              << treasure[0].x << ", " << treasure[0].y
+              << ") ((0, 2) expected)." << std::endl;
+    const std::array<size_t, 5> degrees =
+      LabyrinthQuery::DegreeHistogram( l );
+    std::cout << "  Degrees:";
+    for( const size_t d : degrees )
+    {
+      std::cout << " " << d;
+    }
+    std::cout << " (6 2 1 0 0 expected)." << std::endl;
+    std::cout << "  All queries "
+              << ( QueriesMatch(l) ? "match" : "do NOT match" )
+              << " the Labyrinth." << std::endl;
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Querying generated Labyrinths of sizes which are not "
+            << "multiples of 64:" << std::endl;
+  {
+    GeneratorOptions options;
+    options.bullets = 40;
+    options.minotaurs = 40;
+    options.mirrors = 40;
+    LabyrinthGenerator generator( options );
+    const size_t sizes[3][2] = { {63, 3}, {65, 7}, {130, 129} };
+    for( const auto& size : sizes )
+    {
+      Labyrinth l( size[0], size[1], LabyrinthMode::kLarge );
+      generator.Generate( l );
+      std::cout << "  " << size[0] << " x " << size[1] << ": queries "
+                << ( QueriesMatch(l) ? "match" : "do NOT match" )
+                << " the Labyrinth." << std::endl;
+    }
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Querying a generated 4096 x 4096 Labyrinth:" << std::endl;
+  {
+    GeneratorOptions options;
+    options.algorithm = GeneratorAlgorithm::kEller;
+    options.minotaurs = 1000;
+    options.bullets = 1000;
+    Labyrinth l( 4096, 4096, LabyrinthMode::kLarge );
+    LabyrinthGenerator generator( options );
+    generator.Generate( l );
+
+    const auto start = std::chrono::steady_clock::now();
+    const size_t minotaurs =
+      LabyrinthQuery::CountInhabitants( l, Inhabitant::kMinotaur );
+    const auto counted = std::chrono::steady_clock::now();
+    const size_t dead_ends = LabyrinthQuery::DeadEnds( l ).Count();
+    const auto found = std::chrono::steady_clock::now();
+    const std::array<size_t, 5> degrees =
+      LabyrinthQuery::DegreeHistogram( l );
+    const auto histogram = std::chrono::steady_clock::now();
+
+    size_t rooms = 0;
+    for( const size_t d : degrees )
+    {
+      rooms += d;
+    }
+    std::cout << "  Minotaurs: " << minotaurs << " (1000 expected), in "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(
+                   counted - start ).count() << " ms." << std::endl
+              << "  Dead ends: " << dead_ends << ", in "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(
+                   found - counted ).count() << " ms." << std::endl
+              << "  Degree histogram of " << rooms
+              << " Rooms (16777216 expected), in "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(
+                   histogram - found ).count() << " ms." << std::endl;
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "________________________________________________"
+            << std::endl
+            << std::endl;
+
+  std::cout << "Testing a Room outside of a bitset "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    RoomBitset b( 3, 3 );
+    b.Test( Coordinate(3, 0) );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
@@ -1,7 +1,7 @@
 /*
  *
  * Author: Jeffrey Leung
- * Last edited: 2016-01-08
+ * Last edited: 2026-10-14
  *
  * This C++ file tests the functionality of room.cpp.
  *
@@ -169,6 +169,21 @@ int main()
             << RoomBorderPrint( rm_1.DirectionCheck(Direction::kWest) )
             << "." << std::endl;
 
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+
+
+
+  std::cout << "Testing Packed():" << std::endl;
+
+  std::cout << "  A Room occupies " << sizeof(Room) << " bytes." << std::endl;
+  std::cout << "  The packed encoding of the room is 0x" << std::hex
+            << rm_1.Packed() << std::dec
+            << " (0xe14 expected)." << std::endl;
+  std::cout << "  The packed encoding of an empty room is 0x" << std::hex
+            << Room().Packed() << std::dec
+            << " (0xf expected)." << std::endl;
+
 
 
   std::cout << "________________________________________________" << std::endl;
@@ -0,0 +1,238 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ file tests the LabyrinthSolver class implementation.
+ *
+ */
+
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_generator.hpp"
+#include "../include/labyrinth_solver.hpp"
+
+namespace
+{
+
+// This local function returns the given algorithm as a string.
+std::string AlgorithmPrint( SolverAlgorithm a );
+
+// This local function prints whether the given path is a valid walk
+// through connected Rooms from start to goal.
+void CheckPath( const Labyrinth& l,
+                const std::vector<Coordinate>& path,
+                const Coordinate start,
+                const Coordinate goal );
+
+// This local function returns the given algorithm as a string.
+std::string AlgorithmPrint( SolverAlgorithm a )
+{
+  switch( a )
+  {
+    case( SolverAlgorithm::kBreadthFirst ):
+      return "breadth-first";
+    case( SolverAlgorithm::kAStar ):
+      return "A*";
+    case( SolverAlgorithm::kBidirectional ):
+      return "bidirectional";
+  }
+  return "Error: AlgorithmPrint() was given an algorithm which could not be "\
+         "detected.";
+}
+
+// This local function prints whether the given path is a valid walk
+// through connected Rooms from start to goal.
+void CheckPath( const Labyrinth& l,
+                const std::vector<Coordinate>& path,
+                const Coordinate start,
+                const Coordinate goal )
+{
+  bool valid = !path.empty() && path.front() == start && path.back() == goal;
+  const Direction directions[4] = { Direction::kNorth, Direction::kEast,
+                                    Direction::kSouth, Direction::kWest };
+  for( size_t i = 1; valid && i < path.size(); ++i )
+  {
+    bool connected = false;
+    for( const Direction d : directions )
+    {
+      if( l.DirectionCheck(path[i - 1], d) == RoomBorder::kRoom )
+      {
+        Coordinate next = path[i - 1];
+        switch( d )
+        {
+          case Direction::kNorth: --next.y; break;
+          case Direction::kEast:  ++next.x; break;
+          case Direction::kSouth: ++next.y; break;
+          default:                --next.x; break;
+        }
+        connected = connected || next == path[i];
+      }
+    }
+    valid = connected;
+  }
+  std::cout << "  " << path.size() - 1 << " steps, "
+            << ( valid ? "valid" : "NOT a valid" ) << " path." << std::endl;
+}
+
+}  // Local namespace
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING LABYRINTH_SOLVER.CPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+
+
+  const SolverAlgorithm algorithms[3] =
+  {
+    SolverAlgorithm::kBreadthFirst,
+    SolverAlgorithm::kAStar,
+    SolverAlgorithm::kBidirectional,
+  };
+
+  GeneratorOptions options;
+  options.seed = 42;
+  LabyrinthGenerator generator( options );
+  Labyrinth l( 20, 20 );
+  generator.Generate( l );
+  LabyrinthSolver solver( &l );
+  std::vector<Coordinate> path;
+
+  std::cout << "Finding paths across a generated 20 x 20 Labyrinth:"
+            << std::endl;
+  for( const SolverAlgorithm a : algorithms )
+  {
+    std::cout << " With the " << AlgorithmPrint( a ) << " algorithm:"
+              << std::endl;
+    solver.FindPath( Coordinate(0, 0), Coordinate(19, 19), path, a );
+    CheckPath( l, path, Coordinate(0, 0), Coordinate(19, 19) );
+  }
+  std::cout << "  Distance(): "
+            << solver.Distance( Coordinate(0, 0), Coordinate(19, 19) )
+            << " steps." << std::endl;
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Finding the routes between the spawns, Treasure and exit:"
+            << std::endl;
+  const SolverRoute routes[5] =
+  {
+    SolverRoute::kSpawn1ToTreasure,
+    SolverRoute::kSpawn2ToTreasure,
+    SolverRoute::kTreasureToExit,
+    SolverRoute::kSpawn1ToExit,
+    SolverRoute::kSpawn2ToExit,
+  };
+  const Coordinate starts[5] = { l.GetSpawn1(), l.GetSpawn2(),
+                                 l.GetTreasure(), l.GetSpawn1(),
+                                 l.GetSpawn2() };
+  const Coordinate goals[5] = { l.GetTreasure(), l.GetTreasure(),
+                                l.GetExit(), l.GetExit(), l.GetExit() };
+  for( size_t i = 0; i < 5; ++i )
+  {
+    solver.FindRoute( routes[i], path, SolverAlgorithm::kAStar );
+    CheckPath( l, path, starts[i], goals[i] );
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Comparing path lengths in a maze with loops "
+            << "(All should be equal):" << std::endl;
+  for( size_t i = 0; i < 19; ++i )
+  {
+    if( l.DirectionCheck(Coordinate(i, 10), Direction::kEast) !=
+        RoomBorder::kRoom )
+    {
+      l.ConnectRooms( Coordinate(i, 10), Coordinate(i + 1, 10) );
+    }
+  }
+  bool equal = true;
+  for( size_t query = 0; query < 200; ++query )
+  {
+    const Coordinate start( query % 20, (query * 7) % 20 );
+    const Coordinate goal( (query * 13) % 20, (query * 3) % 20 );
+    size_t lengths[3];
+    for( size_t k = 0; k < 3; ++k )
+    {
+      solver.FindPath( start, goal, path, algorithms[k] );
+      lengths[k] = path.size();
+    }
+    equal = equal && lengths[0] == lengths[1] && lengths[1] == lengths[2] &&
+            lengths[0] - 1 == solver.Distance( start, goal );
+  }
+  std::cout << "  200 queries: path lengths are "
+            << ( equal ? "equal" : "NOT equal" ) << "." << std::endl;
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Finding a path between two unconnected Rooms "
+            << "(No path should be found):" << std::endl;
+  Labyrinth l_walls( 3, 3 );
+  LabyrinthSolver solver_walls( &l_walls );
+  std::cout << "  FindPath() returned "
+            << solver_walls.FindPath( Coordinate(0, 0), Coordinate(2, 2), path )
+            << ", Distance() returned "
+            << ( solver_walls.Distance(Coordinate(0, 0), Coordinate(2, 2)) ==
+                 LabyrinthSolver::kUnreachable ? "kUnreachable" : "a number" )
+            << "." << std::endl;
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "________________________________________________"
+            << std::endl
+            << std::endl;
+
+  std::cout << "Finding a path to a Room outside of the Labyrinth "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    solver.FindPath( Coordinate(0, 0), Coordinate(20, 0), path );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Finding a route to the exit when it has not been set "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    solver_walls.FindRoute( SolverRoute::kSpawn1ToExit, path );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Creating a solver with a null Labyrinth "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    LabyrinthSolver solver_null( nullptr );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,199 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ file tests the LabyrinthStreamGenerator class implementation.
+ *
+ */
+
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/room.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth_generator.hpp"
+#include "../include/labyrinth_stream.hpp"
+
+namespace
+{
+
+// This local class counts the contents of a streamed maze, and keeps a
+// union-find of its Rooms if it is small enough.
+class CountingSink : public RoomRowSink
+{
+  public:
+
+    void Begin( const LabyrinthStreamInfo& info )
+    {
+      info_ = info;
+      keep_sets_ = info.x_size * info.y_size <= 1000000;
+      if( keep_sets_ )
+      {
+        parent_.resize( info.x_size * info.y_size );
+        for( size_t i = 0; i < parent_.size(); ++i )
+        {
+          parent_[i] = i;
+        }
+      }
+    }
+
+    void Rows( const size_t y, const Room* const rooms, const size_t rows )
+    {
+      if( y != rows_seen_ )
+      {
+        std::cout << "  Error: rows were given out of order." << std::endl;
+      }
+      rows_seen_ += rows;
+
+      for( size_t i = 0; i < rows * info_.x_size; ++i )
+      {
+        const Room& rm = rooms[i];
+        const size_t index = y * info_.x_size + i;
+        if( rm.DirectionCheck(Direction::kEast) == RoomBorder::kRoom )
+        {
+          ++connections_;
+          Join( index, index + 1 );
+        }
+        if( rm.DirectionCheck(Direction::kSouth) == RoomBorder::kRoom )
+        {
+          ++connections_;
+          Join( index, index + info_.x_size );
+        }
+        for( const Direction d : { Direction::kNorth, Direction::kEast,
+                                   Direction::kSouth, Direction::kWest } )
+        {
+          if( rm.DirectionCheck(d) == RoomBorder::kExit )
+          {
+            ++exits_;
+          }
+        }
+        if( rm.GetItem() == Item::kTreasure ) ++treasures_;
+        if( rm.GetItem() == Item::kBullet ) ++bullets_;
+        if( rm.GetInhabitant() == Inhabitant::kMinotaur ) ++minotaurs_;
+      }
+    }
+
+    void Print() const
+    {
+      const size_t rooms = info_.x_size * info_.y_size;
+      std::cout << "  " << rows_seen_ << " rows, " << connections_
+                << " connections (" << rooms - 1 << " expected), "
+                << exits_ << " exit, " << treasures_ << " Treasure, "
+                << bullets_ << " bullets, " << minotaurs_ << " Minotaurs."
+                << std::endl;
+      if( keep_sets_ )
+      {
+        size_t sets = 0;
+        for( size_t i = 0; i < parent_.size(); ++i )
+        {
+          if( parent_[i] == i ) ++sets;
+        }
+        std::cout << "  All Rooms are connected: "
+                  << ( sets == 1 ? "yes" : "NO" ) << "." << std::endl;
+      }
+    }
+
+  private:
+
+    LabyrinthStreamInfo info_;
+    bool keep_sets_ = false;
+    std::vector<size_t> parent_;
+    size_t rows_seen_ = 0;
+    size_t connections_ = 0;
+    size_t exits_ = 0;
+    size_t treasures_ = 0;
+    size_t bullets_ = 0;
+    size_t minotaurs_ = 0;
+
+    size_t Find( size_t i )
+    {
+      while( parent_[i] != i )
+      {
+        parent_[i] = parent_[parent_[i]];
+        i = parent_[i];
+      }
+      return i;
+    }
+
+    void Join( const size_t a, const size_t b )
+    {
+      if( keep_sets_ )
+      {
+        parent_[Find(a)] = Find(b);
+      }
+    }
+};
+
+}  // Local namespace
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING LABYRINTH_STREAM.CPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+
+
+  GeneratorOptions options;
+  options.seed = 1234;
+  options.bullets = 10;
+  options.minotaurs = 4;
+
+  std::cout << "Streaming a 40 x 25 maze one row at a time:" << std::endl;
+  LabyrinthStreamGenerator stream_1( options );
+  CountingSink sink_1;
+  stream_1.Generate( 40, 25, sink_1 );
+  sink_1.Print();
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Streaming a 1000 x 1000 maze in bands of 64 rows:"
+            << std::endl;
+  LabyrinthStreamGenerator stream_2( options, 64 );
+  CountingSink sink_2;
+  stream_2.Generate( 1000, 1000, sink_2 );
+  sink_2.Print();
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Streaming a 4000 x 4000 maze in bands of 16 rows:"
+            << std::endl;
+  options.bullets = 1000;
+  options.minotaurs = 1000;
+  LabyrinthStreamGenerator stream_3( options, 16 );
+  CountingSink sink_3;
+  stream_3.Generate( 4000, 4000, sink_3 );
+  sink_3.Print();
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "________________________________________________"
+            << std::endl
+            << std::endl;
+
+  std::cout << "Creating a stream with bands of 0 rows "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    LabyrinthStreamGenerator stream_empty( options, 0 );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
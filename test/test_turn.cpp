@@ -0,0 +1,327 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ file tests the Player and TurnEngine class implementations.
+ *
+ */
+
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_generator.hpp"
+#include "../include/player.hpp"
+#include "../include/game_host.hpp"
+#include "../include/turn_engine.hpp"
+
+namespace
+{
+
+// This local function sets up a 5 x 1 corridor:
+//   (0, 0): Primary spawn
+//   (1, 0): Secondary spawn, a Mirror and a bullet
+//   (2, 0): A Minotaur
+//   (3, 0): The Treasure
+//   (4, 0): A Minotaur, and the exit to the east
+void BuildCorridor( Labyrinth& l );
+
+// This local function returns a move.
+GameMove Move( const std::uint32_t player,
+               const Direction d,
+               const bool shoot );
+
+// This local function prints the events of a batch.
+void PrintEvents( const std::vector<TurnEvent>& events );
+
+// This local function sets up a 5 x 1 corridor.
+void BuildCorridor( Labyrinth& l )
+{
+  for( size_t x = 0; x < 4; ++x )
+  {
+    l.ConnectRooms( Coordinate(x, 0), Coordinate(x + 1, 0) );
+  }
+  l.SetSpawn1( Coordinate(0, 0) );
+  l.SetSpawn2( Coordinate(1, 0) );
+  l.SetInhabitant( Coordinate(1, 0), Inhabitant::kMirror );
+  l.SetItem( Coordinate(1, 0), Item::kBullet );
+  l.SetInhabitant( Coordinate(2, 0), Inhabitant::kMinotaur );
+  l.SetItem( Coordinate(3, 0), Item::kTreasure );
+  l.SetInhabitant( Coordinate(4, 0), Inhabitant::kMinotaur );
+  l.SetExit( Coordinate(4, 0), Direction::kEast );
+}
+
+// This local function returns a move.
+GameMove Move( const std::uint32_t player,
+               const Direction d,
+               const bool shoot )
+{
+  GameMove m;
+  m.player = player;
+  m.direction = d;
+  m.shoot = shoot;
+  return m;
+}
+
+// This local function prints the events of a batch.
+void PrintEvents( const std::vector<TurnEvent>& events )
+{
+  static const char* const kNames[] =
+  {
+    "rejected", "stayed", "blocked", "exit locked", "moved", "escaped",
+    "took bullet", "took Treasure", "shot Minotaur", "cracked Mirror",
+    "misfired", "killed", "dropped Treasure", "respawned", "lost",
+  };
+  for( const TurnEvent& e : events )
+  {
+    std::cout << "  Player " << e.player << " "
+              << kNames[static_cast<size_t>(e.kind)]
+              << " at (" << e.x << ", " << e.y << ")." << std::endl;
+  }
+}
+
+}  // Local namespace
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING TURN_ENGINE.CPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+
+
+  std::cout << "Playing one player through the corridor, one move per "
+            << "batch:" << std::endl;
+  {
+    Labyrinth l( 5, 1 );
+    BuildCorridor( l );
+    TurnEngine engine( l, 1 );
+    std::vector<TurnEvent> events;
+
+    const GameMove moves[] =
+    {
+      Move( 0, Direction::kWest, false ),  // Blocked
+      Move( 0, Direction::kEast, true ),   // Cracks the Mirror
+      Move( 0, Direction::kEast, false ),  // Killed; respawns in (1, 0)
+      Move( 0, Direction::kEast, true ),   // Shoots the Minotaur
+      Move( 0, Direction::kEast, false ),  // Takes the Treasure
+      Move( 0, Direction::kEast, true ),   // Misfires, killed and lost
+      Move( 0, Direction::kNone, false ),  // Rejected
+    };
+    for( const GameMove& m : moves )
+    {
+      engine.Resolve( l, &m, 1, events );
+      PrintEvents( events );
+    }
+    const Player& p = engine.PlayerAt( 0 );
+    std::cout << "  The player has " << p.Bullets() << " bullets and "
+              << p.ExtraLives() << " extra lives (0, 0 expected), and has "
+              << ( p.Status() == PlayerStatus::kLost ? "" : "NOT " )
+              << "lost." << std::endl
+              << "  The Treasure is "
+              << ( l.TreasureSet() && l.GetTreasure() == Coordinate(3, 0) ?
+                   "" : "NOT " )
+              << "back in (3, 0)." << std::endl;
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Playing two players through the corridor in one batch:"
+            << std::endl;
+  {
+    Labyrinth l( 5, 1 );
+    BuildCorridor( l );
+    TurnEngine engine( l, 2 );
+    std::vector<TurnEvent> events;
+
+    const std::vector<GameMove> moves =
+    {
+      Move( 0, Direction::kEast, false ),  // Holds fire at the Mirror
+      Move( 1, Direction::kEast, false ),  // The bullet is already taken
+      Move( 0, Direction::kEast, true ),
+      Move( 1, Direction::kEast, false ),  // The Minotaur is already dead
+      Move( 0, Direction::kEast, false ),
+      Move( 0, Direction::kEast, true ),
+      Move( 1, Direction::kEast, false ),  // The Treasure is already taken
+      Move( 1, Direction::kEast, false ),
+      Move( 1, Direction::kEast, false ),  // Exit locked
+      Move( 0, Direction::kEast, false ),  // Escapes
+      Move( 0, Direction::kWest, false ),  // Rejected
+    };
+    engine.Resolve( l, moves, events );
+    PrintEvents( events );
+    std::cout << "  Player 0 has "
+              << ( engine.PlayerAt(0).Status() == PlayerStatus::kWon ?
+                   "" : "NOT " )
+              << "won, and player 1 is "
+              << ( engine.PlayerAt(1).Status() == PlayerStatus::kPlaying ?
+                   "" : "NOT " )
+              << "still playing." << std::endl;
+    const TurnEngineStats stats = engine.Stats();
+    std::cout << "  Counters: " << stats.batches << " batch, "
+              << stats.moves << " moves, " << stats.rejected << " rejected, "
+              << stats.events << " events (1, 11, 1, " << events.size()
+              << " expected)." << std::endl;
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Resolving 1000 batches of 1024 random moves by 64 players "
+            << "in a generated 200 x 200 Labyrinth:" << std::endl;
+  {
+    GeneratorOptions options;
+    options.algorithm = GeneratorAlgorithm::kEller;
+    options.seed = 15;
+    options.bullets = 2000;
+    options.minotaurs = 1000;
+    options.mirrors = 1000;
+    Labyrinth l( 200, 200, LabyrinthMode::kLarge );
+    LabyrinthGenerator generator( options );
+    generator.Generate( l );
+
+    TurnRules rules;
+    rules.bullets = 2;
+    rules.extra_lives = 1000000;
+    TurnEngine engine( l, 64, rules );
+
+    std::vector<GameMove> moves( 1024 );
+    std::vector<TurnEvent> events;
+    std::uint32_t state = 15;
+    for( size_t batch = 0; batch < 1000; ++batch )
+    {
+      for( GameMove& m : moves )
+      {
+        state = state * 1664525u + 1013904223u;
+        m.player = ( state >> 8 ) % 64;
+        m.direction = static_cast<Direction>( 1 + (state >> 16) % 4 );
+        m.shoot = ( state >> 24 ) % 2 == 0;
+      }
+      engine.Resolve( l, moves, events );
+    }
+    const TurnEngineStats stats = engine.Stats();
+    std::cout << "  Moves: " << stats.moves << " (1024000 expected), "
+              << stats.rejected << " rejected." << std::endl
+              << "  Throughput: " << static_cast<std::uint64_t>(
+                   engine.MovesPerSecond() ) << " moves per second."
+              << std::endl;
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Playing 16 GameHost sessions with TurnEngineHandlers:"
+            << std::endl;
+  {
+    GameHost host( 4 );
+    GeneratorOptions options;
+    options.minotaurs = 5;
+    LabyrinthGenerator generator( options );
+    std::vector<const TurnEngineHandler*> handlers;
+    for( size_t i = 0; i < 16; ++i )
+    {
+      generator.SetSeed( i );
+      Labyrinth l( 10, 10 );
+      generator.Generate( l );
+      std::unique_ptr<TurnEngineHandler> handler =
+        std::make_unique<TurnEngineHandler>( l, 2 );
+      handlers.push_back( handler.get() );
+      host.CreateSession( std::move(l), std::move(handler) );
+    }
+    for( size_t i = 0; i < 16; ++i )
+    {
+      for( size_t m = 0; m < 20; ++m )
+      {
+        host.SubmitMove( i, Move(m % 2, static_cast<Direction>(1 + m % 4),
+                                 true) );
+      }
+    }
+    host.Tick();
+    std::uint64_t moves = 0;
+    for( const TurnEngineHandler* const h : handlers )
+    {
+      moves += h->Engine().Stats().moves;
+    }
+    std::cout << "  Moves resolved: " << moves << " (320 expected)."
+              << std::endl;
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "________________________________________________"
+            << std::endl
+            << std::endl;
+
+  std::cout << "Resolving moves with an unknown player and an invalid "
+            << "Direction (Both should be rejected):" << std::endl;
+  {
+    Labyrinth l( 5, 1 );
+    BuildCorridor( l );
+    TurnEngine engine( l, 1 );
+    std::vector<TurnEvent> events;
+    const std::vector<GameMove> moves =
+    {
+      Move( 5, Direction::kEast, false ),
+      Move( 0, static_cast<Direction>(9), false ),
+    };
+    engine.Resolve( l, moves, events );
+    PrintEvents( events );
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Resolving moves against a Labyrinth of another size "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    Labyrinth l( 5, 1 );
+    BuildCorridor( l );
+    TurnEngine engine( l, 1 );
+    Labyrinth other( 3, 3 );
+    std::vector<TurnEvent> events;
+    engine.Resolve( other, std::vector<GameMove>(1), events );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Creating an engine with no players "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    Labyrinth l( 3, 3 );
+    TurnEngine engine( l, 0 );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Taking a bullet from a player with none "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    Player p( Coordinate(0, 0), 0, 0 );
+    p.UseBullet();
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
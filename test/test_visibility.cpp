@@ -0,0 +1,235 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-14
+ *
+ * This C++ file tests the LabyrinthVisibility class implementation, and
+ * rendering a LabyrinthMap from it.
+ *
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <exception>
+#include <iostream>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_map.hpp"
+#include "../include/game_host.hpp"
+#include "../include/turn_engine.hpp"
+#include "../include/labyrinth_visibility.hpp"
+
+namespace
+{
+
+// This local function sets up a 3 x 2 Labyrinth:
+//   (0, 0): Primary spawn, open to the east and south
+//   (1, 0): A bullet, open to the east and west
+//   (2, 0): The Treasure, open to the west
+//   (0, 1): Secondary spawn, open to the north and east
+//   (1, 1): A Mirror, open to the west and east
+//   (2, 1): The exit to the south, open to the west
+void BuildLabyrinth( Labyrinth& l );
+
+// This local function returns a move.
+GameMove Move( const std::uint32_t player, const Direction d );
+
+// This local function sets up a 3 x 2 Labyrinth.
+void BuildLabyrinth( Labyrinth& l )
+{
+  l.ConnectRooms( Coordinate(0, 0), Coordinate(1, 0) );
+  l.ConnectRooms( Coordinate(1, 0), Coordinate(2, 0) );
+  l.ConnectRooms( Coordinate(0, 0), Coordinate(0, 1) );
+  l.ConnectRooms( Coordinate(0, 1), Coordinate(1, 1) );
+  l.ConnectRooms( Coordinate(1, 1), Coordinate(2, 1) );
+  l.SetSpawn1( Coordinate(0, 0) );
+  l.SetSpawn2( Coordinate(0, 1) );
+  l.SetItem( Coordinate(1, 0), Item::kBullet );
+  l.SetItem( Coordinate(2, 0), Item::kTreasure );
+  l.SetInhabitant( Coordinate(1, 1), Inhabitant::kMirror );
+  l.SetExit( Coordinate(2, 1), Direction::kSouth );
+}
+
+// This local function returns a move.
+GameMove Move( const std::uint32_t player, const Direction d )
+{
+  GameMove m;
+  m.player = player;
+  m.direction = d;
+  return m;
+}
+
+}  // Local namespace
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING LABYRINTH_VISIBILITY.CPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+
+
+  std::cout << "Creating a 3 x 2 Labyrinth, a map, a TurnEngine with 2 "
+            << "Players, and their visibility:" << std::endl;
+  Labyrinth l( 3, 2 );
+  BuildLabyrinth( l );
+  LabyrinthMap m( &l, 3, 2 );
+  TurnEngine engine( l, 2 );
+  LabyrinthVisibility v( 3, 2, 2 );
+  std::cout << "  Revealed Rooms: " << v.RevealedCount( 0 ) << ", "
+            << v.RevealedCount( 1 ) << " (0, 0 expected)." << std::endl;
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Revealing the primary spawn to both Players (Only the "
+            << "first reveal of each should be new):" << std::endl;
+  std::cout << "  New: " << v.Reveal( 0, l.GetSpawn1() ) << ", "
+            << v.Reveal( 1, l.GetSpawn1() ) << ", "
+            << v.Reveal( 1, l.GetSpawn1() ) << " (1, 1, 0 expected)."
+            << std::endl;
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Displaying the map of Player 0 (Only the primary spawn "
+            << "should be shown):" << std::endl;
+  m.Display( std::cout, v, 0 );
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "________________________________________________"
+            << std::endl
+            << std::endl;
+
+  std::cout << "Moving Player 0 east twice and Player 1 south, and "
+            << "revealing the Rooms entered:" << std::endl;
+  std::vector<TurnEvent> events;
+  size_t revealed = 0;
+  engine.Resolve( l, { Move(0, Direction::kEast),
+                       Move(1, Direction::kSouth) }, events );
+  revealed += v.Reveal( events );
+  engine.Resolve( l, { Move(0, Direction::kEast),
+                       Move(1, Direction::kNone) }, events );
+  revealed += v.Reveal( events );
+  std::cout << "  New Rooms: " << revealed << " (3 expected)." << std::endl
+            << "  Revealed Rooms: " << v.RevealedCount( 0 ) << ", "
+            << v.RevealedCount( 1 ) << " (3, 2 expected)." << std::endl
+            << "  Player 0 has revealed (2, 0): "
+            << v.Revealed( 0, Coordinate(2, 0) )
+            << ", (0, 1): " << v.Revealed( 0, Coordinate(0, 1) )
+            << " (1, 0 expected)." << std::endl;
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Displaying the map of Player 0 (The top row should be "
+            << "shown, with its bullet and Treasure taken):" << std::endl;
+  m.Display( std::cout, v, 0 );
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Displaying the map of Player 1 (The west column should be "
+            << "shown):" << std::endl;
+  m.Display( std::cout, v, 1 );
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Displaying the whole map:" << std::endl;
+  m.Display( std::cout );
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "Hiding every Room from Player 0 again:" << std::endl;
+  v.Clear( 0 );
+  std::cout << "  Revealed Rooms: " << v.RevealedCount( 0 ) << ", "
+            << v.RevealedCount( 1 ) << " (0, 2 expected)." << std::endl;
+  std::cout << "Completed." << std::endl << std::endl;
+
+  std::cout << "________________________________________________"
+            << std::endl
+            << std::endl;
+
+  std::cout << "Revealing a Room outside the Labyrinth "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    v.Reveal( 0, Coordinate(3, 0) );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Checking a Room of a Player which does not exist "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    v.Revealed( 2, Coordinate(0, 0) );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Rendering a map from the visibility of a 4 x 2 Labyrinth "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    const LabyrinthVisibility other( 4, 2, 1 );
+    m.Render( other, 0 );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Creating a visibility with a size of 0 "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    const LabyrinthVisibility empty( 0, 2, 1 );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "________________________________________________"
+            << std::endl
+            << std::endl;
+
+  std::cout << "Revealing a diagonal of a 256 x 256 Labyrinth to each of "
+            << "1000 Players:" << std::endl;
+  {
+    const size_t players = 1000;
+    LabyrinthVisibility many( 256, 256, players );
+    for( size_t p = 0; p < players; ++p )
+    {
+      for( size_t i = 0; i < 256; ++i )
+      {
+        many.Reveal( p, Coordinate((i + p) % 256, i) );
+      }
+    }
+    size_t total = 0;
+    for( size_t p = 0; p < players; ++p )
+    {
+      total += many.RevealedCount( p );
+    }
+    std::cout << "  Revealed Rooms: " << total << " (256000 expected)."
+              << std::endl
+              << "  Memory per Player: " << 256 * 256 / 8
+              << " bytes (1 bit per Room)." << std::endl;
+  }
+  std::cout << "Completed." << std::endl << std::endl;
+
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}